@@ -0,0 +1,78 @@
+/*
+ * ============================================================================
+ * RADAR TURRET STATIC ASSETS
+ * ============================================================================
+ *
+ * Serves the dashboard from the pre-gzipped copy in web_gz.h (built by
+ * tools/gzip_web.py) with a strong ETag, so a page load costs ~5KB and a
+ * reload costs a 304 with no body.
+ *
+ * The uncompressed page is only sent to clients that do not accept gzip,
+ * under its own ETag (the gzip one plus "-id"). Every reply carries
+ * Vary: Accept-Encoding, so a shared cache keeps the two apart.
+ *
+ * USAGE:
+ *   assetsBegin(server);             // in setup(), before server.begin()
+ *   server.on("/", []() {
+ *     sendAsset(server, V3_INDEX_GZ, V3_INDEX_GZ_LEN, V3_INDEX_ETAG, INDEX_HTML);
+ *   });
+ *
+ * ============================================================================
+ */
+
+#ifndef ASSETS_H
+#define ASSETS_H
+
+#include <WebServer.h>
+#include "web_gz.h"
+
+// Revalidated by ETag after a day, so a firmware update shows up quickly
+#define ASSET_CACHE_CONTROL  "public, max-age=86400"
+
+/*
+ * assetsBegin(srv)
+ * ----------------
+ * Asks the server to keep the request headers sendAsset() looks at.
+ */
+void assetsBegin(WebServer &srv) {
+  static const char *keys[] = { "If-None-Match", "Accept-Encoding" };
+  srv.collectHeaders(keys, 2);
+}
+
+/*
+ * sendAsset(srv, gz, len, etag, raw)
+ * ----------------------------------
+ * Replies 304 if the client already has the variant it accepts,
+ * otherwise sends the gzipped body (or raw if gzip is not accepted)
+ * with cache headers. etag is the quoted tag of the gzipped body.
+ */
+void sendAsset(WebServer &srv, const uint8_t *gz, size_t len,
+               const char *etag, const char *raw) {
+  bool gzip = srv.header("Accept-Encoding").indexOf("gzip") >= 0;
+
+  // Identity body: "<tag>-id" inside the same quotes
+  char idTag[32];
+  if (!gzip) {
+    snprintf(idTag, sizeof(idTag), "%.*s-id\"", (int)strlen(etag) - 1, etag);
+    etag = idTag;
+  }
+
+  srv.sendHeader("ETag", etag);
+  srv.sendHeader("Cache-Control", ASSET_CACHE_CONTROL);
+  srv.sendHeader("Vary", "Accept-Encoding");
+
+  if (srv.header("If-None-Match") == etag) {
+    srv.send_P(304, "text/html", "");
+    return;
+  }
+
+  if (!gzip) {
+    srv.send_P(200, "text/html", raw);   // Straight from flash, no String copy
+    return;
+  }
+
+  srv.sendHeader("Content-Encoding", "gzip");
+  srv.send_P(200, "text/html", (const char*)gz, len);
+}
+
+#endif // ASSETS_H
@@ -0,0 +1,205 @@
+/*
+ * ============================================================================
+ * RADAR TURRET AUDIO SEQUENCER
+ * ============================================================================
+ *
+ * Owns the buzzer. Tunes are Note tables in PROGMEM played off an
+ * esp_timer, so note lengths no longer stretch when the sketch's loop
+ * stalls. Each note is timed from the previous note's end, not from
+ * when the callback got to run, so a late callback never drifts the
+ * rest of the tune.
+ *
+ * Two voices share the one buzzer:
+ *   tune   audioPlay()  - startup melody, mode switch effects
+ *   alert  audioTone()  - distance alerts, confirmation beeps
+ *
+ * An alert preempts the tune: the tune pauses mid-note and picks up
+ * where it left off once the alert is released with audioTone(0).
+ * Requesting the frequency that is already sounding is a no-op, so
+ * alert handlers can call audioTone() on every pass.
+ *
+ * Until audioBegin() runs (boards without a buzzer) every call is a
+ * no-op. The LEDC channel is the last one so it stays clear of the servos,
+ * which ESP32Servo allocates from channel 0 up. This replaces tone(),
+ * which must not be used on the same pin.
+ *
+ * ============================================================================
+ */
+
+#ifndef AUDIO_H
+#define AUDIO_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#define AUDIO_LEDC_CH     15
+#define AUDIO_LEDC_BITS   10
+
+struct Note {
+  uint16_t hz;    // 0 = rest
+  uint16_t ms;
+};
+
+esp_timer_handle_t audioTuneTimer = nullptr;
+esp_timer_handle_t audioAlertTimer = nullptr;
+SemaphoreHandle_t audioLock = nullptr;    // Timer task vs. radar side
+
+const Note *audioTune = nullptr;
+uint8_t audioLen = 0;
+uint8_t audioIdx = 0;
+volatile bool audioTunePlaying = false;
+int64_t audioNoteEnd = 0;                 // esp_timer_get_time() deadline
+int64_t audioNoteLeft = 0;                // Rest of the note while paused
+
+volatile uint16_t audioAlertHz = 0;
+bool audioAlertTimed = false;             // Beep, ends on its own
+uint16_t audioHz = 0;                     // What the buzzer is playing
+
+// Writes the buzzer only when the frequency changes
+static void audioOut(uint16_t hz) {
+  if (hz == audioHz) return;
+  audioHz = hz;
+  ledcWriteTone(AUDIO_LEDC_CH, hz);
+}
+
+// Starts note audioIdx at time start and arms the timer for its end
+static void audioNote(int64_t start) {
+  uint16_t hz = pgm_read_word(&audioTune[audioIdx].hz);
+  uint16_t ms = pgm_read_word(&audioTune[audioIdx].ms);
+  audioNoteEnd = start + ms * 1000LL;
+  esp_timer_start_once(audioTuneTimer, max(audioNoteEnd - esp_timer_get_time(), (int64_t)1));
+  audioOut(hz);
+}
+
+// Picks the tune back up after an alert, or goes silent
+static void audioResume() {
+  if (!audioTunePlaying) {
+    audioOut(0);
+    return;
+  }
+  int64_t now = esp_timer_get_time();
+  audioNoteEnd = now + max(audioNoteLeft, (int64_t)1);
+  esp_timer_start_once(audioTuneTimer, audioNoteEnd - now);
+  audioOut(pgm_read_word(&audioTune[audioIdx].hz));
+}
+
+static void audioTuneCb(void *) {
+  xSemaphoreTake(audioLock, portMAX_DELAY);
+  if (audioTunePlaying && audioAlertHz == 0) {
+    if (++audioIdx >= audioLen) {
+      audioTunePlaying = false;
+      audioOut(0);
+    } else {
+      audioNote(audioNoteEnd);
+    }
+  }
+  xSemaphoreGive(audioLock);
+}
+
+static void audioAlertCb(void *) {
+  xSemaphoreTake(audioLock, portMAX_DELAY);
+  audioAlertHz = 0;
+  audioAlertTimed = false;
+  audioResume();
+  xSemaphoreGive(audioLock);
+}
+
+/*
+ * audioBegin(pin)
+ * ---------------
+ * Attaches the buzzer pin to the sequencer's LEDC channel.
+ */
+void audioBegin(uint8_t pin) {
+  ledcSetup(AUDIO_LEDC_CH, 1000, AUDIO_LEDC_BITS);
+  ledcAttachPin(pin, AUDIO_LEDC_CH);
+  ledcWriteTone(AUDIO_LEDC_CH, 0);
+
+  audioLock = xSemaphoreCreateMutex();
+
+  esp_timer_create_args_t args = {};
+  args.callback = audioTuneCb;
+  args.name = "tune";
+  esp_timer_create(&args, &audioTuneTimer);
+  args.callback = audioAlertCb;
+  args.name = "alert";
+  esp_timer_create(&args, &audioAlertTimer);
+}
+
+/*
+ * audioPlay(tune, len)
+ * --------------------
+ * Starts a PROGMEM tune from its first note, replacing any tune that is
+ * playing. Under an alert it starts paused.
+ */
+void audioPlay(const Note *tune, uint8_t len) {
+  if (len == 0 || audioLock == nullptr) return;
+  xSemaphoreTake(audioLock, portMAX_DELAY);
+  esp_timer_stop(audioTuneTimer);
+  audioTune = tune;
+  audioLen = len;
+  audioIdx = 0;
+  audioTunePlaying = true;
+  if (audioAlertHz == 0) audioNote(esp_timer_get_time());
+  else audioNoteLeft = pgm_read_word(&tune[0].ms) * 1000LL;
+  xSemaphoreGive(audioLock);
+}
+
+/*
+ * audioTone(hz, ms)
+ * -----------------
+ * Sounds an alert tone, pausing the tune. hz = 0 releases the alert and
+ * resumes the tune. ms > 0 makes it a beep that releases itself after
+ * ms and ignores hz = 0 until then (a newer tone still replaces it).
+ */
+void audioTone(uint16_t hz, uint16_t ms = 0) {
+  if (audioLock == nullptr || (hz == audioAlertHz && ms == 0)) return;
+
+  xSemaphoreTake(audioLock, portMAX_DELAY);
+  if (hz == 0 && audioAlertTimed) {
+    xSemaphoreGive(audioLock);
+    return;
+  }
+  if (hz > 0 && audioAlertHz == 0 && audioTunePlaying) {
+    esp_timer_stop(audioTuneTimer);
+    audioNoteLeft = audioNoteEnd - esp_timer_get_time();
+  }
+
+  esp_timer_stop(audioAlertTimer);
+  audioAlertTimed = hz > 0 && ms > 0;
+  if (audioAlertTimed) esp_timer_start_once(audioAlertTimer, ms * 1000ULL);
+
+  audioAlertHz = hz;
+  if (hz > 0) audioOut(hz);
+  else audioResume();
+  xSemaphoreGive(audioLock);
+}
+
+/*
+ * audioStop()
+ * -----------
+ * Silences tune and alert.
+ */
+void audioStop() {
+  if (audioLock == nullptr) return;
+  xSemaphoreTake(audioLock, portMAX_DELAY);
+  esp_timer_stop(audioTuneTimer);
+  esp_timer_stop(audioAlertTimer);
+  audioTunePlaying = false;
+  audioAlertHz = 0;
+  audioAlertTimed = false;
+  audioOut(0);
+  xSemaphoreGive(audioLock);
+}
+
+/*
+ * audioPlaying()
+ * --------------
+ * True while a tune is still going (paused under an alert counts).
+ */
+bool audioPlaying() {
+  return audioTunePlaying;
+}
+
+#endif // AUDIO_H
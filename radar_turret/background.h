@@ -0,0 +1,181 @@
+/*
+ * ============================================================================
+ * RADAR TURRET BACKGROUND MODEL
+ * ============================================================================
+ *
+ * Per-degree model of what the sensor normally sees (walls, door frames,
+ * furniture). Detection fires on a deviation from it instead of on any
+ * single reading inside range, so fixed objects stop re-triggering a lock
+ * on every pass.
+ *
+ * MODEL:
+ *   Each degree keeps a running mean and variance of its distance
+ *   (Welford's update, sample count capped at BG_WINDOW so the model keeps
+ *   following slow changes). No-echo readings count as BG_FAR_CM.
+ *
+ *   A reading is a target when it is closer than
+ *     mean - max(BG_MIN_MARGIN_CM, BG_SIGMA_K * stddev)
+ *   Cells still learning (fewer than BG_LEARN_SAMPLES) never fire.
+ *
+ *   Target readings are not learned. If a cell deviates BG_ABSORB_HITS
+ *   times in a row the scene has changed (something was moved there) and
+ *   the cell is relearned from scratch.
+ *
+ * SCAN SCHEDULE:
+ *   bgStride() lets the sweep step BG_COARSE_DEG at a time across quiet,
+ *   fully learned sectors and drop to 1 degree where cells are still
+ *   learning or a sector saw a target in the last BG_HOT_MS. The sonar
+ *   cone is ~15 degrees wide, so a coarse pass still sees a newcomer,
+ *   it just gets there several times sooner.
+ *
+ *   bgQuiet() tells whether the whole sweep range is learned and has
+ *   seen no target for a while, for power.h's slow pace.
+ *
+ * Radar side only.
+ *
+ * ============================================================================
+ */
+
+#ifndef BACKGROUND_H
+#define BACKGROUND_H
+
+#include <Arduino.h>
+#include "frame.h"
+
+#define BG_FAR_CM          400   // Stand-in distance for "no echo"
+#define BG_LEARN_SAMPLES   3     // Samples before a cell may fire
+#define BG_WINDOW          32    // Sample count cap (adaptation rate)
+#define BG_SIGMA_K         3.0f  // Deviation threshold in stddevs
+#define BG_MIN_MARGIN_CM   8     // Floor for sensor jitter
+#define BG_ABSORB_HITS     20    // Consecutive hits before relearning
+#define BG_COARSE_DEG      5     // Step across quiet sectors
+#define BG_SECTOR_DEG      5     // Sector width for change tracking
+#define BG_SECTORS         (ANGLE_CELLS / BG_SECTOR_DEG + 1)
+#define BG_HOT_MS          5000  // Fine stepping after a target
+
+float   bgMean[ANGLE_CELLS];
+float   bgM2[ANGLE_CELLS];
+uint8_t bgCount[ANGLE_CELLS];
+uint8_t bgHits[ANGLE_CELLS];
+unsigned long bgHot[BG_SECTORS];   // millis() of the last target per sector
+unsigned long bgLastHot = 0;       // ... and anywhere, 0 = never
+
+/*
+ * bgReset()
+ * ---------
+ * Forgets the whole background. Every cell relearns over the next sweeps.
+ */
+void bgReset() {
+  memset(bgCount, 0, sizeof(bgCount));
+  memset(bgHits, 0, sizeof(bgHits));
+  memset(bgHot, 0, sizeof(bgHot));
+  bgLastHot = 0;
+}
+
+static inline void bgMarkHot(int angle) {
+  unsigned long now = millis() | 1;   // 0 means never
+  int s = angle / BG_SECTOR_DEG;
+  bgLastHot = now;
+  for (int i = s - 1; i <= s + 1; i++) {
+    if (i >= 0 && i < BG_SECTORS) bgHot[i] = now;
+  }
+}
+
+static inline bool bgSettled(int angle) {
+  if (bgCount[angle] < BG_LEARN_SAMPLES) return false;
+  unsigned long t = bgHot[angle / BG_SECTOR_DEG];
+  return t == 0 || millis() - t >= BG_HOT_MS;
+}
+
+static inline void bgLearn(int a, float x) {
+  if (bgCount[a] == 0) {
+    bgMean[a] = x;
+    bgM2[a] = 0;
+    bgCount[a] = 1;
+    return;
+  }
+
+  if (bgCount[a] < BG_WINDOW) {
+    bgCount[a]++;
+  } else {
+    bgM2[a] -= bgM2[a] / BG_WINDOW;   // Age out old spread at the cap
+  }
+
+  float d = x - bgMean[a];
+  bgMean[a] += d / bgCount[a];
+  bgM2[a] += d * (x - bgMean[a]);
+}
+
+/*
+ * bgThreshold(angle)
+ * ------------------
+ * Distance below which a reading at this angle counts as a target.
+ * Returns 0 while the cell is still learning.
+ */
+int bgThreshold(int angle) {
+  if (angle < 0 || angle >= ANGLE_CELLS) return 0;
+  if (bgCount[angle] < BG_LEARN_SAMPLES) return 0;
+
+  float sd = sqrtf(bgM2[angle] / (bgCount[angle] - 1));
+  float margin = fmaxf(BG_MIN_MARGIN_CM, BG_SIGMA_K * sd);
+  return (int)(bgMean[angle] - margin);
+}
+
+/*
+ * bgCheck(angle, dist, range)
+ * ---------------------------
+ * Feeds one reading (dist = -1 for no echo) into the model and returns
+ * true if it is a target: inside range and closer than the background.
+ */
+bool bgCheck(int angle, int dist, int range) {
+  if (angle < 0 || angle >= ANGLE_CELLS) return false;
+
+  float x = dist > 0 ? dist : BG_FAR_CM;
+  bool target = dist > 0 && dist < range && dist < bgThreshold(angle);
+
+  if (!target) {
+    bgHits[angle] = 0;
+    bgLearn(angle, x);
+    return false;
+  }
+
+  bgMarkHot(angle);
+  if (++bgHits[angle] >= BG_ABSORB_HITS) {
+    bgHits[angle] = 0;
+    bgCount[angle] = 0;
+    bgLearn(angle, x);
+    return false;
+  }
+  return true;
+}
+
+/*
+ * bgStride(from, dir)
+ * -------------------
+ * Degrees to step next from angle "from" in direction dir (+1/-1):
+ * BG_COARSE_DEG if every cell up to that far is settled, else 1.
+ */
+int bgStride(int from, int dir) {
+  for (int k = 1; k <= BG_COARSE_DEG; k++) {
+    int a = from + dir * k;
+    if (a < 0 || a >= ANGLE_CELLS) break;
+    if (!bgSettled(a)) return 1;
+  }
+  return BG_COARSE_DEG;
+}
+
+/*
+ * bgQuiet(minAngle, maxAngle, ms)
+ * -------------------------------
+ * True if every cell in the range is learned and no reading deviated
+ * for ms: an empty scene.
+ */
+bool bgQuiet(int minAngle, int maxAngle, unsigned long ms) {
+  if (bgLastHot != 0 && millis() - bgLastHot < ms) return false;
+  for (int a = max(minAngle, 0); a <= min(maxAngle, ANGLE_CELLS - 1); a++) {
+    if (bgCount[a] < BG_LEARN_SAMPLES) return false;
+  }
+  return true;
+}
+
+#endif // BACKGROUND_H
@@ -0,0 +1,134 @@
+/*
+ * ============================================================================
+ * RADAR TURRET STAGED BOOT
+ * ============================================================================
+ *
+ * setup() used to mount (and on first boot format) SPIFFS, bring up the
+ * AP and register routes before the radar side got to run. Now only what
+ * the radar needs stays on the critical path; the rest is queued and run
+ * by the web side, one stage per pass:
+ *
+ *   setup():   ...config...        bootMark("config")
+ *              ...servos, LEDs...  bootMark("hw")
+ *              bootDefer("fs", bootFs)  ...
+ *              ...jobs...          bootRadarUp()
+ *   web side:  if (!bootPump()) return;     top of webStep()
+ *
+ * Every stage is timed from reset (esp_timer) and the breakdown goes to
+ * Serial once the last deferred stage is done, and to /metrics as
+ * radar_boot_* gauges.
+ *
+ * Intrusions seen before the log is mounted wait in the log's RAM batch.
+ * Without THREADED_MODE a deferred stage still runs inside loop(), so a
+ * first-boot format holds up that one pass; with it, the web task on
+ * core 0 absorbs it.
+ *
+ * ============================================================================
+ */
+
+#ifndef BOOT_H
+#define BOOT_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+
+#define BOOT_STAGES_MAX   10
+
+typedef void (*BootFn)();
+
+struct BootStage {
+  const char *name;
+  BootFn fn;          // nullptr for critical-path marks
+  uint32_t atUs;      // Finished, since reset
+  uint32_t us;        // Duration
+};
+
+BootStage bootStages[BOOT_STAGES_MAX];
+uint8_t bootCount = 0;
+uint8_t bootNext = 0;               // Next deferred stage to look at
+uint32_t bootLastUs = 0;
+uint32_t bootRadarUs = 0;           // Radar side live, since reset
+uint32_t bootDoneUs = 0;
+volatile bool bootComplete = false; // Written by the web side
+
+/*
+ * bootMark(name)
+ * --------------
+ * Closes a critical-path stage: everything since the previous mark.
+ */
+void bootMark(const char *name) {
+  if (bootCount >= BOOT_STAGES_MAX) return;
+  uint32_t now = esp_timer_get_time();
+  BootStage &s = bootStages[bootCount++];
+  s.name = name;
+  s.fn = nullptr;
+  s.atUs = now;
+  s.us = now - bootLastUs;
+  bootLastUs = now;
+}
+
+/*
+ * bootDefer(name, fn)
+ * -------------------
+ * Queues fn to run from bootPump(), in the order queued.
+ */
+void bootDefer(const char *name, BootFn fn) {
+  if (bootCount >= BOOT_STAGES_MAX) {
+    fn();           // No room to defer, run it now
+    return;
+  }
+  BootStage &s = bootStages[bootCount++];
+  s.name = name;
+  s.fn = fn;
+  s.atUs = 0;
+  s.us = 0;
+}
+
+/*
+ * bootRadarUp()
+ * -------------
+ * Marks the end of the critical path. Call last in setup().
+ */
+void bootRadarUp() {
+  bootMark("radar");
+  bootRadarUs = bootLastUs;
+  Serial.printf("[BOOT] Radar up at %lu ms\n", (unsigned long)(bootRadarUs / 1000));
+}
+
+static void bootReport() {
+  Serial.println("[BOOT] Stage      took       done at");
+  for (uint8_t i = 0; i < bootCount; i++) {
+    const BootStage &s = bootStages[i];
+    Serial.printf("[BOOT] %-8s %7lu us %7lu ms%s\n", s.name, (unsigned long)s.us,
+                  (unsigned long)(s.atUs / 1000), s.fn ? "  (deferred)" : "");
+  }
+  Serial.printf("[BOOT] Complete at %lu ms\n", (unsigned long)(bootDoneUs / 1000));
+}
+
+/*
+ * bootPump()
+ * ----------
+ * Runs the next deferred stage. Returns true once all of them are done.
+ * Web side only.
+ */
+bool bootPump() {
+  if (bootComplete) return true;
+
+  while (bootNext < bootCount && bootStages[bootNext].fn == nullptr) bootNext++;
+
+  if (bootNext < bootCount) {
+    BootStage &s = bootStages[bootNext++];
+    uint32_t start = esp_timer_get_time();
+    s.fn();
+    s.atUs = esp_timer_get_time();
+    s.us = s.atUs - start;
+    return false;
+  }
+
+  bootDoneUs = esp_timer_get_time();
+  bootComplete = true;
+  bootReport();
+  return true;
+}
+
+#endif // BOOT_H
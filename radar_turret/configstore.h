@@ -0,0 +1,145 @@
+/*
+ * ============================================================================
+ * RADAR TURRET CONFIG STORE
+ * ============================================================================
+ *
+ * Keeps the sketch's Config struct in NVS as one versioned blob instead
+ * of a key per field, and coalesces saves:
+ *
+ *   web side:  cfgStoreSave()    stage the new config (cheap, no flash)
+ *              cfgStorePump()    commit once saves have gone quiet
+ *
+ * A commit happens CFG_COMMIT_MS after the last save (a dragged slider
+ * fires a save per step), or CFG_COMMIT_MAX_MS after the first one so
+ * a steady stream of saves still lands. A config identical to the one
+ * already in flash is never written. A save that is still pending when
+ * power goes is lost; the previous blob stays intact.
+ *
+ * BLOB FORMAT ("cfg"):
+ *   version u16    bump CONFIG_VERSION in the sketch when Config changes
+ *   size u16       sizeof(Config), a second guard against layout changes
+ *   payload        the Config struct as laid out in RAM
+ *
+ * A blob with the wrong version or size is ignored, so the sketch falls
+ * back to its defaults (or migrates from the old per-key layout).
+ *
+ * ============================================================================
+ */
+
+#ifndef CONFIGSTORE_H
+#define CONFIGSTORE_H
+
+#include <Arduino.h>
+#include <Preferences.h>
+
+#define CFG_BLOB_KEY       "cfg"
+#define CFG_BLOB_MAX       64      // Largest Config payload
+#define CFG_COMMIT_MS      1500    // Quiet time before a commit
+#define CFG_COMMIT_MAX_MS  10000   // Commit anyway after this long
+
+struct CfgBlobHeader {
+  uint16_t version;
+  uint16_t size;
+};
+
+Preferences *cfgPrefs = nullptr;
+uint16_t cfgVersion = 0;
+
+uint8_t cfgStaged[sizeof(CfgBlobHeader) + CFG_BLOB_MAX];
+uint8_t cfgStored[sizeof(CfgBlobHeader) + CFG_BLOB_MAX];   // What is in flash
+size_t cfgStagedLen = 0;
+size_t cfgStoredLen = 0;                                    // 0 = nothing valid
+
+bool cfgPending = false;
+unsigned long tCfgFirst = 0;
+unsigned long tCfgLast = 0;
+
+/*
+ * cfgStoreLoad(prefs, version, cfg, len)
+ * --------------------------------------
+ * Reads the blob with a single NVS lookup. Returns false (cfg
+ * untouched) if it is missing or from another build's layout.
+ */
+bool cfgStoreLoad(Preferences &prefs, uint16_t version, void *cfg, size_t len) {
+  cfgPrefs = &prefs;
+  cfgVersion = version;
+  cfgStoredLen = 0;
+  if (len > CFG_BLOB_MAX) return false;
+
+  size_t total = sizeof(CfgBlobHeader) + len;
+  if (prefs.getBytes(CFG_BLOB_KEY, cfgStored, total) != total) return false;
+
+  CfgBlobHeader h;
+  memcpy(&h, cfgStored, sizeof(h));
+  if (h.version != version || h.size != len) return false;
+
+  memcpy(cfg, cfgStored + sizeof(h), len);
+  cfgStoredLen = total;
+  return true;
+}
+
+/*
+ * cfgStoreSave(cfg, len)
+ * ----------------------
+ * Stages cfg for the next commit. No flash access.
+ */
+void cfgStoreSave(const void *cfg, size_t len) {
+  if (len > CFG_BLOB_MAX) return;
+
+  CfgBlobHeader h = { cfgVersion, (uint16_t)len };
+  memcpy(cfgStaged, &h, sizeof(h));
+  memcpy(cfgStaged + sizeof(h), cfg, len);
+  cfgStagedLen = sizeof(h) + len;
+
+  unsigned long now = millis();
+  if (!cfgPending) tCfgFirst = now;
+  tCfgLast = now;
+  cfgPending = true;
+}
+
+/*
+ * cfgStoreCommit()
+ * ----------------
+ * Writes the staged config now if it differs from flash.
+ */
+void cfgStoreCommit() {
+  if (!cfgPending || cfgPrefs == nullptr) return;
+  cfgPending = false;
+
+  if (cfgStagedLen == cfgStoredLen &&
+      memcmp(cfgStaged, cfgStored, cfgStagedLen) == 0) return;
+
+  // Any old per-key fields go with the first blob write
+  if (cfgStoredLen == 0) cfgPrefs->clear();
+  if (cfgPrefs->putBytes(CFG_BLOB_KEY, cfgStaged, cfgStagedLen) != cfgStagedLen) return;
+
+  memcpy(cfgStored, cfgStaged, cfgStagedLen);
+  cfgStoredLen = cfgStagedLen;
+  Serial.println("[+] Config saved");
+}
+
+/*
+ * cfgStorePump()
+ * --------------
+ * Commits the staged config once it is due. Call every web loop pass.
+ */
+void cfgStorePump() {
+  if (!cfgPending) return;
+  unsigned long now = millis();
+  if (now - tCfgLast >= CFG_COMMIT_MS || now - tCfgFirst >= CFG_COMMIT_MAX_MS) {
+    cfgStoreCommit();
+  }
+}
+
+/*
+ * cfgStoreClear()
+ * ---------------
+ * Erases the stored config and drops any pending save.
+ */
+void cfgStoreClear() {
+  cfgPending = false;
+  cfgStoredLen = 0;
+  if (cfgPrefs) cfgPrefs->clear();
+}
+
+#endif // CONFIGSTORE_H
@@ -0,0 +1,258 @@
+/*
+ * ============================================================================
+ * RADAR TURRET ECHO ENGINE
+ * ============================================================================
+ *
+ * Non-blocking HC-SR04 driver. Replaces pulseIn() so the main loop never
+ * stalls while a ping is in flight.
+ *
+ * HOW IT WORKS:
+ *   1. echoTrigger() fires the 10us trigger pulse and returns immediately
+ *   2. A CHANGE interrupt on the echo pin timestamps the rising and
+ *      falling edges with micros()
+ *   3. echoPoll() is called on later loop passes and reports the distance
+ *      once the falling edge has arrived (or -1 after ECHO_TIMEOUT_US)
+ *
+ * USAGE:
+ *   echoBegin(TRIG, ECHO);            // once, in setup()
+ *   echoTrigger();                    // start a ping
+ *   int cm;
+ *   if (echoPoll(cm) == ECHO_READY) { ... }
+ *
+ * BURSTS:
+ *   One ping is noisy (spurious short returns, missed echoes). A burst
+ *   fires up to N pings for one step and reports their median:
+ *
+ *   echoBurstStart(n, range, retryMiss);
+ *   if (echoBurstPoll(cm) == ECHO_READY) { ... }
+ *
+ *   The burst ends early so a quiet sweep costs no extra time:
+ *     - after one ping if it is beyond range (or a miss, unless
+ *       retryMiss), since there is nothing to confirm
+ *     - as soon as two consecutive pings agree within ECHO_AGREE_CM
+ *
+ * ============================================================================
+ */
+
+#ifndef ECHO_H
+#define ECHO_H
+
+#include <Arduino.h>
+#include "metrics.h"
+
+#define ECHO_TIMEOUT_US   25000   // 25ms timeout (~4m max)
+#define ECHO_BURST_MAX    5       // Upper bound on pings per burst
+#define ECHO_AGREE_CM     3       // Consecutive pings this close end a burst
+#define ECHO_GAP_US       5000    // Quiet time between pings (ringing dies out)
+#define ECHO_FOCUS_DEG    10      // Full bursts this close to the last target
+
+enum EchoStatus {
+  ECHO_IDLE,      // No ping in flight
+  ECHO_PENDING,   // Waiting for the echo
+  ECHO_READY      // Result delivered to the caller
+};
+
+// Pins
+uint8_t echoTrigPin = 0;
+uint8_t echoPin = 0;
+
+// Written by the ISR
+volatile unsigned long echoRiseUs = 0;
+volatile unsigned long echoFallUs = 0;
+volatile bool echoDone = false;
+
+// Owned by the loop
+unsigned long echoTrigUs = 0;
+bool echoBusy = false;
+
+// Burst state
+int echoSamples[ECHO_BURST_MAX];
+uint8_t echoCount = 0;          // Pings taken in the current/last burst
+uint8_t echoBurstN = 0;         // 0 = no burst running
+int echoBurstRange = 0;
+bool echoBurstRetry = false;
+unsigned long echoLastUs = 0;
+unsigned long echoBurstUs = 0;  // Burst start, for the ping wait metric
+
+/*
+ * echoISR()
+ * ---------
+ * Edge interrupt on the echo pin. A falling edge only counts if a rising
+ * edge was seen after the trigger, so a stale pulse from a previous ping
+ * can never complete the current one.
+ */
+void IRAM_ATTR echoISR() {
+  unsigned long now = micros();
+
+  if (digitalRead(echoPin) == HIGH) {
+    echoRiseUs = now;
+  } else if (echoRiseUs != 0 && !echoDone) {
+    echoFallUs = now;
+    echoDone = true;
+  }
+}
+
+/*
+ * echoBegin(trig, echo)
+ * ---------------------
+ * Configures the sensor pins and attaches the edge interrupt.
+ */
+void echoBegin(uint8_t trig, uint8_t echo) {
+  echoTrigPin = trig;
+  echoPin = echo;
+
+  pinMode(echoTrigPin, OUTPUT);
+  pinMode(echoPin, INPUT);
+  digitalWrite(echoTrigPin, LOW);
+
+  attachInterrupt(digitalPinToInterrupt(echoPin), echoISR, CHANGE);
+}
+
+/*
+ * echoTrigger()
+ * -------------
+ * Starts a ping. Returns false if one is already in flight.
+ */
+bool echoTrigger() {
+  if (echoBusy) return false;
+
+  echoRiseUs = 0;
+  echoFallUs = 0;
+  echoDone = false;
+
+  digitalWrite(echoTrigPin, LOW);
+  delayMicroseconds(2);
+  digitalWrite(echoTrigPin, HIGH);
+  delayMicroseconds(10);
+  digitalWrite(echoTrigPin, LOW);
+
+  echoTrigUs = micros();
+  echoBusy = true;
+  return true;
+}
+
+/*
+ * echoPoll(cm)
+ * ------------
+ * Checks on the ping in flight. On ECHO_READY, cm holds the distance in
+ * cm, or -1 if no echo was received (out of range).
+ */
+EchoStatus echoPoll(int &cm) {
+  if (!echoBusy) return ECHO_IDLE;
+
+  if (echoDone) {
+    unsigned long duration = echoFallUs - echoRiseUs;
+    echoBusy = false;
+    cm = (int)(duration * 0.034 / 2);
+    return ECHO_READY;
+  }
+
+  if (micros() - echoTrigUs >= ECHO_TIMEOUT_US) {
+    echoBusy = false;
+    cm = -1;
+    return ECHO_READY;
+  }
+
+  return ECHO_PENDING;
+}
+
+/*
+ * echoCancel()
+ * ------------
+ * Drops the ping in flight (e.g. when scanning stops).
+ */
+void echoCancel() {
+  echoBusy = false;
+  echoBurstN = 0;
+}
+
+/*
+ * echoBurstStart(n, range, retryMiss)
+ * -----------------------------------
+ * Fires the first ping of a burst of at most n. Readings inside range
+ * (and misses, if retryMiss) are confirmed with further pings.
+ */
+void echoBurstStart(uint8_t n, int range, bool retryMiss) {
+  echoBurstN = constrain(n, 1, ECHO_BURST_MAX);
+  echoBurstRange = range;
+  echoBurstRetry = retryMiss;
+  echoCount = 0;
+  echoBurstUs = micros();
+  echoTrigger();
+}
+
+/*
+ * echoBurstRestart()
+ * ------------------
+ * Drops the pings taken so far; the burst goes on as if just started
+ * (e.g. the horn has moved on since they were fired).
+ */
+void echoBurstRestart() {
+  echoCount = 0;
+}
+
+/*
+ * echoBurstActive()
+ * -----------------
+ * True while a burst is still collecting pings.
+ */
+bool echoBurstActive() {
+  return echoBurstN != 0;
+}
+
+// Middle of the burst; with an even count the upper one, or the lower
+// one if that is a miss, so a burst with half its pings in still reads
+static int echoMedian() {
+  int s[ECHO_BURST_MAX];
+  for (uint8_t i = 0; i < echoCount; i++) {
+    s[i] = echoSamples[i] < 0 ? INT16_MAX : echoSamples[i];  // Miss sorts last
+  }
+  for (uint8_t i = 1; i < echoCount; i++) {
+    int v = s[i];
+    int j = i;
+    for (; j > 0 && s[j - 1] > v; j--) s[j] = s[j - 1];
+    s[j] = v;
+  }
+  int m = s[echoCount / 2];
+  if (m == INT16_MAX) m = s[(echoCount - 1) / 2];
+  return m == INT16_MAX ? -1 : m;
+}
+
+/*
+ * echoBurstPoll(cm)
+ * -----------------
+ * Like echoPoll() for a whole burst: ECHO_READY once, with the median
+ * distance (or -1 if more than half the pings missed).
+ */
+EchoStatus echoBurstPoll(int &cm) {
+  if (echoBurstN == 0) return ECHO_IDLE;
+
+  if (!echoBusy) {
+    if (micros() - echoLastUs >= ECHO_GAP_US) echoTrigger();
+    return ECHO_PENDING;
+  }
+
+  int s;
+  if (echoPoll(s) != ECHO_READY) return ECHO_PENDING;
+  echoSamples[echoCount++] = s;
+
+  bool done = echoCount >= echoBurstN;
+  if (echoCount == 1) {
+    done |= s >= echoBurstRange || (s < 0 && !echoBurstRetry);
+  } else {
+    int p = echoSamples[echoCount - 2];
+    done |= (s < 0 && p < 0) || (s >= 0 && p >= 0 && abs(s - p) <= ECHO_AGREE_CM);
+  }
+
+  if (!done) {
+    echoLastUs = micros();
+    return ECHO_PENDING;
+  }
+
+  echoBurstN = 0;
+  cm = echoMedian();
+  metricRecord(M_PING, micros() - echoBurstUs);
+  return ECHO_READY;
+}
+
+#endif // ECHO_H
@@ -0,0 +1,499 @@
+/*
+ * ============================================================================
+ * RADAR TURRET EVENT LOG
+ * ============================================================================
+ *
+ * Intrusion events are queued in a fixed-size RAM ring and written to
+ * SPIFFS in batches, so a detection costs a few stores instead of an
+ * open/size/close/append/close cycle on the control loop.
+ *
+ *   radar side:  logEvent()     push (O(1), no allocation, never blocks)
+ *   web side:    logPump()      flush in the background when due
+ *
+ * DURABILITY POLICY (logPolicy, any enabled trigger flushes):
+ *   maxEvents   flush once this many events are pending    (0 = off)
+ *   maxAgeMs    flush when the oldest pending event is this old (0 = off)
+ *   onStop      flush when scanning stops (logFlushSoon())
+ *
+ * Events that arrive while the ring is full are dropped and counted.
+ *
+ * RECORD FORMAT (8 bytes, little-endian, see LogRecord):
+ *   time u32    epoch seconds if LOGF_EPOCH is set, else uptime seconds
+ *   angle u8
+ *   flags u8    low nibble = mode (LOG_NO_MODE if none), LOGF_EPOCH,
+ *               LOGF_REPLAY (found in a trace replay, see trace.h)
+ *   dist u16    cm
+ *
+ * SEGMENTED STORE:
+ *   The log lives in LOG_SEGMENTS files (/rec.0 ... /rec.N-1) used as a
+ *   circular list. Appends go to the head segment; its size is tracked
+ *   in RAM, so no size() probe is needed per write. When the head is
+ *   full the next segment (the oldest) is truncated and becomes the new
+ *   head, so only the oldest LOG_SEG_SIZE bytes are ever lost. The head
+ *   index is kept in its own Preferences namespace (so a config reset
+ *   does not lose it) and is only written on rotation. A short write
+ *   (SPIFFS full or failing) leaves the record queued; the retry
+ *   overwrites the torn bytes, so records stay on 8-byte boundaries.
+ *
+ * QUERIES (logQuery, backing /get_logs):
+ *   from / to     time range (same units as the records)
+ *   amin / amax   angle sector
+ *   last          only the newest N matches
+ *   text          render lines on the device instead of raw records
+ *   since         only records from this sequence number on
+ *
+ * SEQUENCE NUMBERS (live tail):
+ *   Every stored record has one: a segment only rotates when it holds
+ *   exactly LOG_SEG_RECS records, so the head segment's first record is
+ *   logRot * LOG_SEG_RECS, where logRot counts rotations (persisted).
+ *   A query answers with X-Log-Cursor, the sequence number after its
+ *   last record; passing that back as since returns only what was
+ *   appended in the meantime. A wipe counts as a rotation, so an old
+ *   cursor never skips new records.
+ *
+ *   Matches go out as a background transfer (xfer.h), one batch of
+ *   records per web loop pass, so a full download no longer stalls
+ *   other clients.
+ *
+ * ============================================================================
+ */
+
+#ifndef EVENTLOG_H
+#define EVENTLOG_H
+
+#include <Arduino.h>
+#include <SPIFFS.h>
+#include <Preferences.h>
+#include <WebServer.h>
+#include <time.h>
+#include "metrics.h"
+#include "xfer.h"
+#include "reply.h"
+
+#ifndef LOG_MAX_SIZE
+#define LOG_MAX_SIZE      50000   // 50KB max log size (all segments)
+#endif
+#define LOG_SEGMENTS      5
+#define LOG_SEG_SIZE      (LOG_MAX_SIZE / LOG_SEGMENTS)
+#define LOG_RING_SIZE     32      // Pending events held in RAM
+#define LOG_FLUSH_EVENTS  8       // Default: flush every 8 events...
+#define LOG_FLUSH_MS      5000    // ...or 5s after the oldest one
+
+#define LOG_NO_MODE       0x0F    // Record has no operating mode
+#define LOGF_EPOCH        0x80    // Record time is wall clock
+#define LOGF_REPLAY       0x40    // Found replaying a trace, not live
+
+struct __attribute__((packed)) LogRecord {
+  uint32_t time;
+  uint8_t  angle;
+  uint8_t  flags;
+  uint16_t dist;
+};
+
+#define LOG_SEG_RECS      (LOG_SEG_SIZE / sizeof(LogRecord))
+
+struct LogEvent {
+  uint32_t ms;          // millis() at detection, for the age trigger
+  LogRecord rec;
+};
+
+struct LogPolicy {
+  uint16_t maxEvents;
+  uint32_t maxAgeMs;
+  bool onStop;
+};
+
+struct LogQuery {
+  uint32_t from = 0;
+  uint32_t to = 0xFFFFFFFF;
+  int amin = 0;
+  int amax = 180;
+  uint32_t last = 0;    // 0 = all
+  uint32_t since = 0;   // First sequence number wanted
+  bool text = false;
+};
+
+LogPolicy logPolicy = { LOG_FLUSH_EVENTS, LOG_FLUSH_MS, true };
+
+LogEvent logRing[LOG_RING_SIZE];
+volatile uint16_t logHead = 0;      // Written by producer
+volatile uint16_t logTail = 0;      // Written by consumer
+volatile bool logFlushReq = false;
+volatile uint32_t logDropped = 0;
+
+// Segment store (web side only)
+Preferences logPrefs;
+uint8_t logSeg = 0;          // Head segment index
+size_t logSegBytes = 0;      // Bytes in the head segment (whole records)
+bool logTorn = false;        // A partial record follows logSegBytes
+uint32_t logRot = 0;         // Rotations so far (sequence numbers)
+
+// Text rendering labels, indexed by record mode
+const char *const *logLabels = nullptr;
+uint8_t logLabelCount = 0;
+
+// Older text logs, only removed by logWipe()
+const char *const LOG_LEGACY_FILES[] = {
+  "/log.txt", "/log.0", "/log.1", "/log.2", "/log.3", "/log.4"
+};
+
+static void logSegPath(char *buf, uint8_t seg) {
+  sprintf(buf, "/rec.%u", seg);
+}
+
+static inline uint16_t logPending() {
+  return (uint16_t)(logHead - logTail);
+}
+
+/*
+ * logEvent(angle, dist, mode, synced)
+ * -----------------------------------
+ * Queues one event. mode may carry LOGF_REPLAY. Safe to call from the
+ * radar side while the web side flushes.
+ */
+void logEvent(int angle, int dist, uint8_t mode, bool synced) {
+  if (logPending() >= LOG_RING_SIZE) {
+    logDropped = logDropped + 1;
+    return;
+  }
+
+  LogEvent &e = logRing[logHead % LOG_RING_SIZE];
+  e.ms = millis();
+  e.rec.time  = synced ? (uint32_t)time(nullptr) : e.ms / 1000;
+  e.rec.angle = angle;
+  e.rec.flags = (mode & (0x0F | LOGF_REPLAY)) | (synced ? LOGF_EPOCH : 0);
+  e.rec.dist  = dist;
+
+  __sync_synchronize();
+  logHead = logHead + 1;
+}
+
+/*
+ * logFlushSoon()
+ * --------------
+ * Asks the next logPump() to flush (used for the "on stop" trigger).
+ */
+void logFlushSoon() {
+  if (logPolicy.onStop) logFlushReq = true;
+}
+
+/*
+ * logFormat(buf, len, r)
+ * ----------------------
+ * Renders one record in the classic text format:
+ *   "[HH:MM:SS] LABEL: 42cm @ 90°" or "[uptime] LABEL: ..."
+ * Replayed records get "REPLAY " in front of the label.
+ */
+int logFormat(char *buf, size_t len, const LogRecord &r) {
+  uint8_t mode = r.flags & 0x0F;
+  const char *label = mode < logLabelCount ? logLabels[mode] : "INTRUSION";
+  const char *replay = (r.flags & LOGF_REPLAY) ? "REPLAY " : "";
+
+  if (r.flags & LOGF_EPOCH) {
+    time_t t = r.time;
+    struct tm *tm = localtime(&t);
+    return snprintf(buf, len, "[%02d:%02d:%02d] %s%s: %dcm @ %d°\n",
+                    tm->tm_hour, tm->tm_min, tm->tm_sec, replay, label, r.dist, r.angle);
+  }
+  return snprintf(buf, len, "[%lu] %s%s: %dcm @ %d°\n",
+                  (unsigned long)r.time, replay, label, r.dist, r.angle);
+}
+
+/*
+ * logBegin(labels, count)
+ * -----------------------
+ * Restores the head segment from Preferences and sets the labels used
+ * for text output. Call after SPIFFS.begin(). This is the only size()
+ * probe on the write path.
+ */
+void logBegin(const char *const *labels = nullptr, uint8_t count = 0) {
+  logLabels = labels;
+  logLabelCount = count;
+
+  logPrefs.begin("radar-log", false);
+  logSeg = logPrefs.getUChar("head", 0) % LOG_SEGMENTS;
+  logRot = logPrefs.getUInt("rot", logSeg);
+
+  char path[12];
+  logSegPath(path, logSeg);
+
+  logSegBytes = 0;
+  logTorn = false;
+  if (SPIFFS.exists(path)) {
+    File f = SPIFFS.open(path, "r");
+    if (f) {
+      size_t size = f.size();
+      logSegBytes = size - size % sizeof(LogRecord);
+      logTorn = logSegBytes != size;
+      f.close();
+    }
+  }
+}
+
+/*
+ * logRotate()
+ * -----------
+ * Advances the head to the oldest segment and truncates it.
+ */
+static void logRotate() {
+  logSeg = (logSeg + 1) % LOG_SEGMENTS;
+  logSegBytes = 0;
+  logTorn = false;
+  logRot++;
+
+  char path[12];
+  logSegPath(path, logSeg);
+  SPIFFS.remove(path);
+
+  logPrefs.putUChar("head", logSeg);
+  logPrefs.putUInt("rot", logRot);
+  Serial.println("[!] Log rotated (oldest segment dropped)");
+}
+
+// Head segment positioned at logSegBytes: appended to, or rewritten
+// from there when a torn record has to be overwritten
+static File logOpenHead(const char *path) {
+  if (!logTorn) return SPIFFS.open(path, FILE_APPEND);
+  File f = SPIFFS.open(path, "r+");
+  if (f) f.seek(logSegBytes);
+  return f;
+}
+
+/*
+ * logFlush()
+ * ----------
+ * Writes every pending event with a single open/close (two when the
+ * batch crosses a segment boundary). Stops at a short write and keeps
+ * the rest queued. Web side only.
+ */
+void logFlush() {
+  logFlushReq = false;
+  uint16_t head = logHead;
+  __sync_synchronize();
+  if (head == logTail) return;
+
+  METRIC_SCOPE(M_LOG_FLUSH);
+  char path[12];
+  logSegPath(path, logSeg);
+  File f = logOpenHead(path);
+  if (!f) return;  // Keep events queued, retry next pump
+
+  char line[80];
+  uint16_t tail = logTail;
+  while (tail != head) {
+    const LogRecord &r = logRing[tail % LOG_RING_SIZE].rec;
+
+    if (logSegBytes + sizeof(LogRecord) > LOG_SEG_SIZE) {
+      f.close();
+      logRotate();
+      logSegPath(path, logSeg);
+      f = logOpenHead(path);
+      if (!f) break;
+    }
+
+    if (f.write((const uint8_t*)&r, sizeof(r)) != sizeof(r)) {
+      logTorn = true;   // Retried next flush, over whatever got written
+      break;
+    }
+    logSegBytes += sizeof(r);
+    logTorn = false;
+    logFormat(line, sizeof(line), r);
+    Serial.print("[LOG] "); Serial.print(line);
+    tail++;
+  }
+  if (f) f.close();
+
+  __sync_synchronize();
+  logTail = tail;
+}
+
+static bool logMatch(const LogRecord &r, const LogQuery &q) {
+  return r.time >= q.from && r.time <= q.to &&
+         r.angle >= q.amin && r.angle <= q.amax;
+}
+
+// Resumable position in the log for one /get_logs transfer (xfer.h)
+struct LogCursor {
+  LogQuery q;
+  uint8_t head;         // Head segment when the transfer started
+  uint8_t seg;          // 1..LOG_SEGMENTS after head, oldest first
+  uint32_t off;         // Byte offset in that segment
+  uint32_t skip;        // Matches to pass over ("last N")
+  uint32_t rot;         // logRot when the transfer started
+  uint32_t end;         // Sequence number to stop at (X-Log-Cursor)
+  bool counting;        // First pass: count matches for skip
+};
+
+// Sequence number of the first record of segment seg (see LogCursor)
+static uint32_t logSegBase(uint32_t rot, uint8_t seg) {
+  uint32_t back = LOG_SEGMENTS - seg;
+  return rot >= back ? (rot - back) * LOG_SEG_RECS : 0;
+}
+
+#define LOG_SCAN_BATCH   32     // Records read per fill
+#define LOG_LINE_MAX     80
+
+static_assert(sizeof(LogCursor) <= XFER_STATE_MAX, "LogCursor too big for xfer.h");
+
+/*
+ * logCursorFill(state, buf, cap, len)
+ * -----------------------------------
+ * xfer.h fill for /get_logs. Reads one batch of records per call, so a
+ * long log is sent a piece per web loop pass.
+ */
+static bool logCursorFill(void *state, uint8_t *buf, size_t cap, size_t &len) {
+  LogCursor &c = *(LogCursor*)state;
+  static LogRecord batch[LOG_SCAN_BATCH];
+  len = 0;
+
+  while (c.seg <= LOG_SEGMENTS) {
+    // Start each segment at the first record at or after since
+    uint32_t base = logSegBase(c.rot, c.seg);
+    if (c.off == 0 && c.q.since > base) {
+      c.off = min(c.q.since - base, (uint32_t)LOG_SEG_RECS) * sizeof(LogRecord);
+    }
+    if (base + c.off / sizeof(LogRecord) >= c.end) {
+      c.seg = LOG_SEGMENTS + 1;
+      break;
+    }
+
+    char path[12];
+    logSegPath(path, (c.head + c.seg) % LOG_SEGMENTS);
+    size_t n = 0;
+    if (SPIFFS.exists(path)) {
+      File f = SPIFFS.open(path, "r");
+      if (f) {
+        f.seek(c.off);
+        n = f.read((uint8_t*)batch, sizeof(batch)) / sizeof(LogRecord);
+        f.close();
+      }
+    }
+    if (n == 0) {
+      c.seg++;
+      c.off = 0;
+      continue;
+    }
+
+    for (size_t k = 0; k < n; k++) {
+      const LogRecord &r = batch[k];
+      if (base + c.off / sizeof(LogRecord) >= c.end) break;
+      if (logMatch(r, c.q)) {
+        if (c.counting) {
+          c.skip++;
+        } else if (c.skip) {
+          c.skip--;
+        } else {
+          size_t room = c.q.text ? LOG_LINE_MAX : sizeof(r);
+          if (len + room > cap) return true;   // Resume at this record
+          if (c.q.text) {
+            len += logFormat((char*)buf + len, cap - len, r);
+          } else {
+            memcpy(buf + len, &r, sizeof(r));
+            len += sizeof(r);
+          }
+        }
+      }
+      c.off += sizeof(LogRecord);
+    }
+    return true;
+  }
+
+  // End of the counting pass: rewind and send the last N
+  if (c.counting) {
+    c.counting = false;
+    c.skip = c.skip > c.q.last ? c.skip - c.q.last : 0;
+    c.seg = 1;
+    c.off = 0;
+    return true;
+  }
+  return false;
+}
+
+/*
+ * logQuery(srv, q)
+ * ----------------
+ * Starts a background transfer (xfer.h) of the records matching q:
+ * raw LogRecords (application/octet-stream) or text lines. A rotation
+ * while it runs can drop or repeat the oldest segment's records.
+ */
+void logQuery(WebServer &srv, const LogQuery &q) {
+  logFlush();  // Include events still queued in RAM
+
+  LogCursor c;
+  c.q = q;
+  c.head = logSeg;
+  c.seg = 1;
+  c.off = 0;
+  c.skip = 0;
+  c.rot = logRot;
+  c.end = logRot * LOG_SEG_RECS + logSegBytes / sizeof(LogRecord);
+  c.counting = q.last > 0;
+
+  char hdr[32];
+  snprintf(hdr, sizeof(hdr), "X-Log-Cursor: %lu\r\n", (unsigned long)c.end);
+  xferStart(srv, q.text ? "text/plain" : "application/octet-stream",
+            logCursorFill, &c, sizeof(c), hdr);
+}
+
+/*
+ * logParseQuery(srv, q)
+ * ---------------------
+ * Fills q from the request: from, to, amin, amax, last, since, fmt=txt.
+ */
+void logParseQuery(WebServer &srv, LogQuery &q) {
+  replyArgInt(srv, "from", q.from);
+  replyArgInt(srv, "to", q.to);
+  replyArgInt(srv, "amin", q.amin);
+  replyArgInt(srv, "amax", q.amax);
+  replyArgInt(srv, "last", q.last);
+  replyArgInt(srv, "since", q.since);
+  q.text = replyArgIs(srv, "fmt", "txt");
+}
+
+/*
+ * logWipe()
+ * ---------
+ * Drops pending events and deletes every segment. Web side only.
+ */
+void logWipe() {
+  logTail = logHead;
+  logFlushReq = false;
+
+  char path[12];
+  for (uint8_t i = 0; i < LOG_SEGMENTS; i++) {
+    logSegPath(path, i);
+    SPIFFS.remove(path);
+  }
+  for (const char *legacy : LOG_LEGACY_FILES) {
+    if (SPIFFS.exists(legacy)) SPIFFS.remove(legacy);
+  }
+
+  logSeg = 0;
+  logSegBytes = 0;
+  logTorn = false;
+  logRot++;
+  logPrefs.putUChar("head", 0);
+  logPrefs.putUInt("rot", logRot);
+}
+
+/*
+ * logPump()
+ * ---------
+ * Flushes when the policy says so. Call from the web side / loop().
+ */
+void logPump() {
+  uint16_t pending = logPending();
+  if (pending == 0) {
+    logFlushReq = false;
+    return;
+  }
+
+  bool due = logFlushReq;
+  if (logPolicy.maxEvents && pending >= logPolicy.maxEvents) due = true;
+  if (logPolicy.maxAgeMs &&
+      millis() - logRing[logTail % LOG_RING_SIZE].ms >= logPolicy.maxAgeMs) due = true;
+
+  if (due) logFlush();
+}
+
+#endif // EVENTLOG_H
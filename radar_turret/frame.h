@@ -0,0 +1,212 @@
+/*
+ * ============================================================================
+ * RADAR TURRET BINARY FRAMES
+ * ============================================================================
+ *
+ * Versioned, packed little-endian frames for compact telemetry and for
+ * shipping a whole sweep to the browser in one response.
+ *
+ * LAYOUT:
+ *   FrameHeader  (12 bytes)  version, type, count, sweep ID, timestamp
+ *   FramePoint   (4 bytes)   angle u8, distance u16, flags u8
+ *
+ *   FRAME_STATUS = header + 1 point + FrameStatus (22 bytes total)
+ *   FRAME_SWEEP  = header + <count> points, one per degree min..max
+ *   FRAME_DELTA  = header + <count> points that changed, ascending angle
+ *
+ * The radar side records every reading into a per-degree cell table.
+ * Each cell is packed into a single 32-bit word, so the web side can
+ * read it from the other core without locking and never see a torn
+ * point.
+ *
+ * DELTAS:
+ *   Next to each cell is the sweep ID in which it last changed (by more
+ *   than SWEEP_DEADBAND_CM, or in its flags). A client keeps the sweep
+ *   ID of the last frame it applied and asks /sweep?since=<id>; it gets
+ *   only the cells stamped with that sweep or later. Cells that change
+ *   while the reply is built are stamped no lower than the header's
+ *   sweep ID, so the client's next request picks them up.
+ *
+ *   A full FRAME_SWEEP comes back instead when the client's ID is ahead
+ *   of the device (it rebooted) or older than the last sweepRestart()
+ *   (the angle range changed); the client replaces its table with it.
+ *
+ * ============================================================================
+ */
+
+#ifndef FRAME_H
+#define FRAME_H
+
+#include <Arduino.h>
+#include "tasks.h"
+
+#define FRAME_VERSION     1
+#define FRAME_STATUS      1
+#define FRAME_SWEEP       2
+#define FRAME_DELTA       3
+#define ANGLE_CELLS       181   // 0..180 degrees
+#define SWEEP_DEADBAND_CM 1     // Echo jitter that does not count as a change
+
+// Point flags
+#define PT_HIT            0x01  // Inside detection range
+#define PT_NO_ECHO        0x02  // Ping timed out
+#define PT_RUNNING        0x10  // Scanning or locked (status frames)
+#define PT_LOCKED         0x20  // Lock-on active (status frames)
+#define PT_VALID          0x80  // Cell has been measured
+
+struct __attribute__((packed)) FrameHeader {
+  uint8_t  version;     // FRAME_VERSION
+  uint8_t  type;        // FRAME_STATUS / FRAME_SWEEP
+  uint16_t count;       // Number of FramePoints that follow
+  uint32_t sweepId;     // Incremented at every sweep end
+  uint32_t timestamp;   // millis() when the frame was built
+};
+
+struct __attribute__((packed)) FramePoint {
+  uint8_t  angle;
+  uint16_t dist;        // cm, 0 when PT_NO_ECHO
+  uint8_t  flags;
+};
+
+struct __attribute__((packed)) FrameStatus {
+  uint16_t range;       // Max detection range
+  uint8_t  mode;
+  uint8_t  liAngle;     // Last intrusion angle
+  uint16_t liDist;      // Last intrusion distance
+};
+
+// Written by the radar side only
+volatile uint32_t sweepCells[ANGLE_CELLS] = {};
+volatile uint32_t sweepStamps[ANGLE_CELLS] = {};   // sweepId of the last change
+volatile uint32_t sweepId = 0;
+
+// Web side only: clients behind this sweep get a full frame
+uint32_t sweepFullBefore = 0;
+
+static inline uint32_t packCell(int angle, int dist, uint8_t flags) {
+  return (uint32_t)angle | ((uint32_t)dist << 8) | ((uint32_t)flags << 24);
+}
+
+static inline FramePoint unpackCell(uint32_t c) {
+  FramePoint p;
+  p.angle = c & 0xFF;
+  p.dist  = (c >> 8) & 0xFFFF;
+  p.flags = c >> 24;
+  return p;
+}
+
+/*
+ * sweepRecord(angle, dist, hit)
+ * -----------------------------
+ * Stores one reading (dist = -1 for no echo) in the cell table.
+ */
+void sweepRecord(int angle, int dist, bool hit) {
+  if (angle < 0 || angle >= ANGLE_CELLS) return;
+
+  uint8_t flags = PT_VALID;
+  if (dist < 0) { flags |= PT_NO_ECHO; dist = 0; }
+  if (hit) flags |= PT_HIT;
+
+  // Jitter on an unchanged target keeps the old cell, so it is not resent
+  uint32_t old = sweepCells[angle];
+  if ((uint8_t)(old >> 24) == flags &&
+      abs((int)((old >> 8) & 0xFFFF) - dist) <= SWEEP_DEADBAND_CM) return;
+
+  // Cell before stamp: a reader that sees the new stamp sees the new cell
+  sweepCells[angle] = packCell(angle, dist, flags);
+  sweepStamps[angle] = sweepId;
+}
+
+/*
+ * sweepNext()
+ * -----------
+ * Marks the end of a sweep (servo reversed direction).
+ */
+void sweepNext() {
+  sweepId = sweepId + 1;
+}
+
+/*
+ * sweepRestart()
+ * --------------
+ * Sends every client a full frame until the next sweep ends. Call when
+ * the angle range changes, so cells left outside it are dropped.
+ * Web side only.
+ */
+void sweepRestart() {
+  sweepFullBefore = sweepId + 1;
+}
+
+static inline void frameHeader(FrameHeader &h, uint8_t type, uint16_t count, uint32_t id) {
+  h.version = FRAME_VERSION;
+  h.type = type;
+  h.count = count;
+  h.sweepId = id;
+  h.timestamp = millis();
+}
+
+/*
+ * frameStatus(buf, s, locked)
+ * ---------------------------
+ * Builds a FRAME_STATUS into buf (at least 22 bytes). Returns its size.
+ */
+size_t frameStatus(uint8_t *buf, const RadarSnapshot &s, bool locked) {
+  FrameHeader h;
+  frameHeader(h, FRAME_STATUS, 1, s.sweep);
+
+  FramePoint p;
+  p.angle = s.angle;
+  p.dist  = s.dist > 0 ? s.dist : 0;
+  p.flags = PT_VALID;
+  if (s.dist < 0) p.flags |= PT_NO_ECHO;
+  if (s.dist > 0 && s.dist < s.range) p.flags |= PT_HIT;
+  if (s.running) p.flags |= PT_RUNNING;
+  if (locked) p.flags |= PT_LOCKED;
+
+  FrameStatus st;
+  st.range   = s.range;
+  st.mode    = s.mode;
+  st.liAngle = s.liAngle;
+  st.liDist  = s.liDist;
+
+  memcpy(buf, &h, sizeof(h));
+  memcpy(buf + sizeof(h), &p, sizeof(p));
+  memcpy(buf + sizeof(h) + sizeof(p), &st, sizeof(st));
+  return sizeof(h) + sizeof(p) + sizeof(st);
+}
+
+/*
+ * frameSweep(buf, minAngle, maxAngle, since)
+ * ------------------------------------------
+ * Builds a FRAME_SWEEP with one point per degree, or with since >= 0 a
+ * FRAME_DELTA of the measured cells that changed in sweep since or
+ * later (a FRAME_SWEEP if since is out of range, see DELTAS). buf must
+ * hold sizeof(FrameHeader) + ANGLE_CELLS * sizeof(FramePoint).
+ * Unmeasured cells are sent with flags = 0. Web side only.
+ */
+size_t frameSweep(uint8_t *buf, int minAngle, int maxAngle, long since = -1) {
+  minAngle = constrain(minAngle, 0, ANGLE_CELLS - 1);
+  maxAngle = constrain(maxAngle, minAngle, ANGLE_CELLS - 1);
+
+  // Read once: later changes are stamped at least this high
+  uint32_t id = sweepId;
+  bool delta = since >= 0 && (uint32_t)since <= id && (uint32_t)since >= sweepFullBefore;
+
+  uint8_t *out = buf + sizeof(FrameHeader);
+  for (int a = minAngle; a <= maxAngle; a++) {
+    if (delta && sweepStamps[a] < (uint32_t)since) continue;
+    FramePoint p = unpackCell(sweepCells[a]);
+    if (delta && !(p.flags & PT_VALID)) continue;
+    p.angle = a;
+    memcpy(out, &p, sizeof(p));
+    out += sizeof(p);
+  }
+
+  FrameHeader h;
+  uint16_t count = (out - buf - sizeof(h)) / sizeof(FramePoint);
+  frameHeader(h, delta ? FRAME_DELTA : FRAME_SWEEP, count, id);
+  memcpy(buf, &h, sizeof(h));
+  return out - buf;
+}
+
+#endif // FRAME_H
@@ -0,0 +1,108 @@
+/*
+ * ============================================================================
+ * RADAR TURRET LED COMPOSITOR
+ * ============================================================================
+ *
+ * Holds the frame the sketch wants on the NeoPixels and only transmits
+ * it when it actually differs from the last frame pushed. State handlers
+ * can repaint the same colour on every pass for free.
+ *
+ * Transmission is also:
+ *   - capped at one frame per LED_FRAME_MS
+ *   - held back while a ping is in flight (show() blocks, and an echo
+ *     edge timestamped late is a wrong distance), unless the change has
+ *     already waited LED_MAX_DEFER_MS
+ *
+ * USAGE:
+ *   ledsBegin(strip, NUM_PIXELS);     // after strip.begin()
+ *   ledsFill(strip.Color(0, 8, 0));   // stage a frame
+ *   ledsFlush(!echoBusy);             // from a periodic job
+ *
+ * ============================================================================
+ */
+
+#ifndef LEDS_H
+#define LEDS_H
+
+#include <Arduino.h>
+#include <Adafruit_NeoPixel.h>
+#include "metrics.h"
+
+#define LED_MAX_PIXELS     8
+#define LED_FRAME_MS       20     // Frame rate cap (50 fps)
+#define LED_MAX_DEFER_MS   100    // Push during a ping after this long
+
+Adafruit_NeoPixel *ledStrip = nullptr;
+uint8_t ledCount = 0;
+
+uint32_t ledFrame[LED_MAX_PIXELS];    // Staged
+uint32_t ledShown[LED_MAX_PIXELS];    // On the strip
+uint8_t ledBright = 255;
+uint8_t ledShownBright = 255;
+
+unsigned long tLedShow = 0;
+unsigned long tLedDirty = 0;          // First flush that saw a change, 0 = clean
+
+/*
+ * ledsBegin(strip, count)
+ * -----------------------
+ * Attaches the compositor to a started strip (count capped at
+ * LED_MAX_PIXELS).
+ */
+void ledsBegin(Adafruit_NeoPixel &strip, uint8_t count) {
+  ledStrip = &strip;
+  ledCount = min(count, (uint8_t)LED_MAX_PIXELS);
+  memset(ledFrame, 0, sizeof(ledFrame));
+  memset(ledShown, 0, sizeof(ledShown));
+}
+
+void ledsSet(uint8_t i, uint32_t color) {
+  if (i < ledCount) ledFrame[i] = color;
+}
+
+void ledsFill(uint32_t color) {
+  for (uint8_t i = 0; i < ledCount; i++) ledFrame[i] = color;
+}
+
+void ledsBrightness(uint8_t b) {
+  ledBright = b;
+}
+
+/*
+ * ledsFlush(quiet)
+ * ----------------
+ * Pushes the staged frame if it changed and the frame cap allows it.
+ * quiet = false defers the push (no ping in flight is "quiet").
+ * Returns true if the strip was written.
+ */
+bool ledsFlush(bool quiet) {
+  if (ledStrip == nullptr) return false;
+
+  bool changed = ledBright != ledShownBright ||
+                 memcmp(ledFrame, ledShown, ledCount * sizeof(uint32_t)) != 0;
+  if (!changed) {
+    tLedDirty = 0;
+    return false;
+  }
+
+  unsigned long now = millis();
+  if (tLedDirty == 0) tLedDirty = now | 1;
+  if (now - tLedShow < LED_FRAME_MS) return false;
+  if (!quiet && now - tLedDirty < LED_MAX_DEFER_MS) return false;
+
+  // setBrightness() rescales the strip buffer lossily, so repaint after
+  if (ledBright != ledShownBright) ledStrip->setBrightness(ledBright);
+  for (uint8_t i = 0; i < ledCount; i++) ledStrip->setPixelColor(i, ledFrame[i]);
+  {
+    METRIC_SCOPE(M_LEDS);
+    ledStrip->show();
+  }
+
+  memcpy(ledShown, ledFrame, ledCount * sizeof(uint32_t));
+  ledShownBright = ledBright;
+  tLedShow = now;
+  tLedDirty = 0;
+  return true;
+}
+
+#endif // LEDS_H
@@ -0,0 +1,555 @@
+/*
+ * ============================================================================
+ * RADAR TURRET MESH
+ * ============================================================================
+ *
+ * Several turrets in one room, one fused picture. Every turret streams
+ * its live tracks over ESP-NOW (no router, no association: the frames
+ * ride the AP's channel next to the dashboard traffic); the one set up
+ * as coordinator fuses them into room-frame targets and broadcasts the
+ * result back, so a turret whose own sweep has not found a target yet
+ * still points its arrow at it.
+ *
+ *   radar side:  meshPublish()   live tracks, from radarPublish()
+ *   web side:    meshPump()      reports, fusion, cues, stream
+ *                meshOnRecv()    ESP-NOW receive (WiFi task), into a
+ *                                RAM ring like eventlog.h's
+ *
+ * POSE:
+ *   Each turret has an id (1..MESH_NODES_MAX, 0 = mesh off), a position
+ *   x, y (cm) in a room frame shared by all of them and a heading h: the
+ *   room bearing (deg, counter-clockwise from the x axis) its scan servo
+ *   faces at 90. A reading at servo angle a and range d is at bearing
+ *   h + a - 90. Set with /mesh_config, kept in Preferences.
+ *
+ * PACKETS (little-endian, MeshHeader then n MeshPoints):
+ *   header      magic u8, type u8, node u8, n u8, seq u16
+ *   point       x i16, y i16 (cm, room frame), nodes u8, pad u8
+ *   MESH_TRACKS every turret -> broadcast, its tracks, every
+ *               MESH_SEND_MS while tracking and MESH_BEAT_MS otherwise
+ *   MESH_FUSED  coordinator -> broadcast, the fused targets; nodes is
+ *               bit (id - 1) for every turret that sees the target
+ *
+ * FUSION (coordinator, every MESH_FUSE_MS):
+ *   Reports from turrets heard within MESH_STALE_MS, its own included,
+ *   are merged greedily: a point within MESH_FUSE_CM of a target that
+ *   turret is not already part of joins it (position is the mean),
+ *   anything else is a new target. Two tracks of one turret are never
+ *   merged; its own tracker already kept them apart.
+ *
+ * CUES:
+ *   The closest fused target this turret is not part of, if it lies in
+ *   its half plane, is posted as CMD_CUE; the arrow follows it unless
+ *   the turret's own primary track is closer (tracks.h).
+ *
+ * STREAM:
+ *   Fused targets go to the /events subscribers as a named event, on
+ *   change and every MESH_BEAT_MS:
+ *     event:mesh
+ *     data:<n>;<x>,<y>,<nodes>;...
+ *   /mesh has the same list plus this turret's pose and which turrets
+ *   are heard.
+ *
+ * ============================================================================
+ */
+
+#ifndef MESH_H
+#define MESH_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WebServer.h>
+#include <Preferences.h>
+#include <esp_now.h>
+#include "tasks.h"
+#include "tracks.h"
+#include "telemetry.h"
+#include "reply.h"
+
+#define MESH_NODES_MAX    8       // Ids 1..8, one bit each in MeshPoint::nodes
+#define MESH_FUSED_MAX    8
+#define MESH_SEND_MS      100     // Track reports while tracking
+#define MESH_BEAT_MS      1000    // ... and with nothing to report
+#define MESH_FUSE_MS      200
+#define MESH_STALE_MS     1500    // A turret not heard for this long is gone
+#define MESH_FUSE_CM      45      // Reports closer than this are one target
+#define MESH_RX_RING      8       // Packets held between receive and pump
+#define MESH_MAGIC        0xB7
+
+enum MeshType {
+  MESH_TRACKS = 1,
+  MESH_FUSED  = 2
+};
+
+struct __attribute__((packed)) MeshHeader {
+  uint8_t magic;
+  uint8_t type;
+  uint8_t node;       // Sender's id
+  uint8_t n;          // MeshPoints that follow
+  uint16_t seq;
+};
+
+struct __attribute__((packed)) MeshPoint {
+  int16_t x, y;       // cm, room frame
+  uint8_t nodes;      // MESH_FUSED: bit (id - 1) per turret seeing it
+  uint8_t pad;
+};
+
+#define MESH_PACKET_MAX   (sizeof(MeshHeader) + MESH_FUSED_MAX * sizeof(MeshPoint))
+#define MESH_LIST_MAX     (4 + MESH_FUSED_MAX * 20)   // Text target list
+
+struct MeshConfig {
+  uint8_t id;         // 1..MESH_NODES_MAX, 0 = off
+  bool coord;         // Fuses and broadcasts the picture
+  int x, y;           // cm
+  int h;              // deg
+};
+
+struct MeshNode {
+  unsigned long seen; // millis() of the last report
+  uint16_t seq;
+  uint8_t n;
+  MeshPoint p[TRACK_MAX];
+};
+
+MeshConfig meshCfg = { 0, false, 0, 0, 90 };
+Preferences meshPrefs;
+volatile bool meshUp = false;     // ESP-NOW running, radar side publishes
+
+// Radar -> web: live tracks in the turret's own frame, seqlock like
+// tasks.h's snapshot
+struct MeshLocal {
+  uint8_t n;
+  float angle[TRACK_MAX];
+  float dist[TRACK_MAX];
+};
+MeshLocal meshLocalData = {};
+volatile uint32_t meshLocalSeq = 0;
+
+// ESP-NOW receive -> web side
+struct MeshRx {
+  uint8_t len;
+  uint8_t data[MESH_PACKET_MAX];
+};
+MeshRx meshRx[MESH_RX_RING];
+volatile uint8_t meshRxHead = 0;  // Written by the WiFi task
+volatile uint8_t meshRxTail = 0;  // Written by the web side
+
+// Web side
+MeshNode meshNodes[MESH_NODES_MAX];
+MeshPoint meshFused[MESH_FUSED_MAX];
+uint8_t meshFusedCount = 0;
+uint32_t meshFusedSeq = 0;        // Bumped on every new picture
+unsigned long tMeshSend = 0;
+unsigned long tMeshFuse = 0;
+unsigned long tMeshFused = 0;     // Last picture, made or received
+unsigned long tMeshStream = 0;
+MeshPoint meshStreamed[MESH_FUSED_MAX];   // Last list streamed
+uint8_t meshStreamedCount = 0;
+uint16_t meshSeq = 0;
+int meshCueSent = -1;
+uint32_t meshRxCount = 0;
+uint32_t meshRxDropped = 0;       // Ring full
+uint32_t meshLost = 0;            // Gaps in a turret's seq
+
+const uint8_t MESH_BROADCAST[6] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+
+// ============================================================================
+// FRAMES
+// ============================================================================
+
+/*
+ * meshToRoom(angle, dist, x, y)
+ * -----------------------------
+ * Servo angle and range to room coordinates, with this turret's pose.
+ */
+void meshToRoom(float angle, float dist, float &x, float &y) {
+  float b = (meshCfg.h + angle - 90) * (float)DEG_TO_RAD;
+  x = meshCfg.x + dist * cosf(b);
+  y = meshCfg.y + dist * sinf(b);
+}
+
+/*
+ * meshToLocal(x, y, angle, dist)
+ * ------------------------------
+ * Room coordinates to servo angle (-180..180) and range.
+ */
+void meshToLocal(float x, float y, float &angle, float &dist) {
+  float dx = x - meshCfg.x;
+  float dy = y - meshCfg.y;
+  dist = sqrtf(dx * dx + dy * dy);
+  angle = atan2f(dy, dx) * (float)RAD_TO_DEG - meshCfg.h + 90;
+  while (angle > 180) angle -= 360;
+  while (angle <= -180) angle += 360;
+}
+
+// ============================================================================
+// RADAR SIDE
+// ============================================================================
+
+/*
+ * meshPublish()
+ * -------------
+ * Copies the live tracks for the web side. Radar side, called from
+ * radarPublish(); nothing to do while the mesh is off.
+ */
+void meshPublish() {
+  if (!meshUp) return;
+
+  MeshLocal l;
+  l.n = 0;
+  unsigned long now = millis();
+  for (int i = 0; i < TRACK_MAX; i++) {
+    if (!tracks[i].used) continue;
+    trackPredict(tracks[i], now, l.angle[l.n], l.dist[l.n]);
+    l.n++;
+  }
+
+  meshLocalSeq = meshLocalSeq + 1;
+  __sync_synchronize();
+  meshLocalData = l;
+  __sync_synchronize();
+  meshLocalSeq = meshLocalSeq + 1;
+}
+
+static void meshLocalRead(MeshLocal &out) {
+  uint32_t seq;
+  do {
+    seq = meshLocalSeq;
+    __sync_synchronize();
+    out = meshLocalData;
+    __sync_synchronize();
+  } while ((seq & 1) || seq != meshLocalSeq);
+}
+
+// ============================================================================
+// RADIO
+// ============================================================================
+
+/*
+ * meshOnRecv(mac, data, len)
+ * --------------------------
+ * ESP-NOW receive callback (WiFi task): queues packets that look like
+ * ours for meshPump().
+ */
+void meshOnRecv(const uint8_t *mac, const uint8_t *data, int len) {
+  if (len < (int)sizeof(MeshHeader) || len > (int)MESH_PACKET_MAX) return;
+  if (data[0] != MESH_MAGIC) return;
+
+  uint8_t next = (meshRxHead + 1) % MESH_RX_RING;
+  if (next == meshRxTail) {
+    meshRxDropped++;
+    return;
+  }
+  meshRx[meshRxHead].len = len;
+  memcpy(meshRx[meshRxHead].data, data, len);
+  __sync_synchronize();
+  meshRxHead = next;
+}
+
+static void meshSend(uint8_t type, const MeshPoint *p, uint8_t n) {
+  uint8_t buf[MESH_PACKET_MAX];
+  MeshHeader h = { MESH_MAGIC, type, meshCfg.id, n, meshSeq++ };
+  memcpy(buf, &h, sizeof(h));
+  memcpy(buf + sizeof(h), p, n * sizeof(MeshPoint));
+  esp_now_send(MESH_BROADCAST, buf, sizeof(h) + n * sizeof(MeshPoint));
+}
+
+static void meshStart() {
+  if (meshCfg.id == 0 || meshUp) return;
+
+  if (esp_now_init() != ESP_OK) {
+    Serial.println("[!] ESP-NOW init failed");
+    return;
+  }
+  esp_now_register_recv_cb(meshOnRecv);
+
+  esp_now_peer_info_t peer = {};
+  memcpy(peer.peer_addr, MESH_BROADCAST, sizeof(MESH_BROADCAST));
+  peer.channel = 0;               // Whatever the AP is on
+  peer.ifidx = WIFI_IF_AP;
+  peer.encrypt = false;
+  esp_now_add_peer(&peer);
+
+  meshUp = true;
+  Serial.printf("[+] Mesh node %u%s at %d,%d facing %d\n", meshCfg.id,
+                meshCfg.coord ? " (coordinator)" : "", meshCfg.x, meshCfg.y, meshCfg.h);
+}
+
+/*
+ * meshBegin()
+ * -----------
+ * Loads the pose and starts ESP-NOW on the AP interface. Boot stage
+ * after the AP is up (boot.h); does nothing while the id is 0.
+ */
+void meshBegin() {
+  meshPrefs.begin("radar-mesh", false);
+  meshCfg.id    = min(meshPrefs.getUChar("id", 0), (uint8_t)MESH_NODES_MAX);
+  meshCfg.coord = meshPrefs.getBool("coord", false);
+  meshCfg.x     = meshPrefs.getInt("x", 0);
+  meshCfg.y     = meshPrefs.getInt("y", 0);
+  meshCfg.h     = meshPrefs.getInt("h", 90);
+  meshStart();
+}
+
+// ============================================================================
+// WEB SIDE
+// ============================================================================
+
+static void meshTake(const uint8_t *data, uint8_t len, unsigned long now) {
+  MeshHeader h;
+  memcpy(&h, data, sizeof(h));
+  if (h.node == 0 || h.node > MESH_NODES_MAX || h.node == meshCfg.id) return;
+  uint8_t n = min((uint8_t)((len - sizeof(h)) / sizeof(MeshPoint)), h.n);
+  const uint8_t *p = data + sizeof(h);
+  meshRxCount++;
+
+  if (h.type == MESH_TRACKS && meshCfg.coord) {
+    MeshNode &m = meshNodes[h.node - 1];
+    if (m.seen != 0 && (uint16_t)(h.seq - m.seq) > 1 && (uint16_t)(h.seq - m.seq) < 100) {
+      meshLost += (uint16_t)(h.seq - m.seq) - 1;
+    }
+    m.seen = now;
+    m.seq = h.seq;
+    m.n = min(n, (uint8_t)TRACK_MAX);
+    memcpy(m.p, p, m.n * sizeof(MeshPoint));
+  } else if (h.type == MESH_FUSED && !meshCfg.coord) {
+    meshFusedCount = min(n, (uint8_t)MESH_FUSED_MAX);
+    memcpy(meshFused, p, meshFusedCount * sizeof(MeshPoint));
+    meshFusedSeq++;
+    tMeshFused = now;
+  }
+}
+
+// This turret's tracks as room-frame points
+static uint8_t meshOwnPoints(MeshPoint *out) {
+  MeshLocal l;
+  meshLocalRead(l);
+  for (uint8_t i = 0; i < l.n; i++) {
+    float x, y;
+    meshToRoom(l.angle[i], l.dist[i], x, y);
+    out[i].x = (int16_t)lroundf(x);
+    out[i].y = (int16_t)lroundf(y);
+    out[i].nodes = 0;
+    out[i].pad = 0;
+  }
+  return l.n;
+}
+
+// Greedy merge of every fresh report into meshFused
+static void meshFuse(unsigned long now) {
+  float sumX[MESH_FUSED_MAX], sumY[MESH_FUSED_MAX];
+  uint8_t cnt[MESH_FUSED_MAX];
+  uint8_t n = 0;
+
+  for (uint8_t id = 1; id <= MESH_NODES_MAX; id++) {
+    const MeshNode &m = meshNodes[id - 1];
+    if (m.seen == 0 || now - m.seen > MESH_STALE_MS) continue;
+    uint8_t bit = 1 << (id - 1);
+
+    for (uint8_t k = 0; k < m.n; k++) {
+      int best = -1;
+      float bestD = MESH_FUSE_CM;
+      for (uint8_t f = 0; f < n; f++) {
+        if (meshFused[f].nodes & bit) continue;
+        float d = hypotf(sumX[f] / cnt[f] - m.p[k].x, sumY[f] / cnt[f] - m.p[k].y);
+        if (d < bestD) { bestD = d; best = f; }
+      }
+      if (best < 0) {
+        if (n >= MESH_FUSED_MAX) continue;
+        best = n++;
+        sumX[best] = sumY[best] = 0;
+        cnt[best] = 0;
+        meshFused[best].nodes = 0;
+        meshFused[best].pad = 0;
+      }
+      sumX[best] += m.p[k].x;
+      sumY[best] += m.p[k].y;
+      cnt[best]++;
+      meshFused[best].nodes |= bit;
+    }
+  }
+
+  for (uint8_t f = 0; f < n; f++) {
+    meshFused[f].x = (int16_t)lroundf(sumX[f] / cnt[f]);
+    meshFused[f].y = (int16_t)lroundf(sumY[f] / cnt[f]);
+  }
+  meshFusedCount = n;
+  meshFusedSeq++;
+  tMeshFused = now;
+}
+
+// Points the arrow at the closest target only other turrets see
+static void meshCue() {
+  uint8_t bit = 1 << (meshCfg.id - 1);
+  int cue = -1;
+  float best = 1e9f;
+  for (uint8_t f = 0; f < meshFusedCount; f++) {
+    if (meshFused[f].nodes & bit) continue;
+    float a, d;
+    meshToLocal(meshFused[f].x, meshFused[f].y, a, d);
+    if (a < 0 || a > 180 || d >= best) continue;
+    best = d;
+    cue = ARROW_CUE((int)(a + 0.5f), min((int)(d + 0.5f), 0x7FFF));
+  }
+  if (cue < 0 && meshCueSent < 0) return;
+  postCommand(CMD_CUE, cue);
+  meshCueSent = cue;
+}
+
+// "<n>;<x>,<y>,<nodes>;..." for the stream and /mesh
+static void meshList(char *buf, size_t cap) {
+  int len = snprintf(buf, cap, "%u", meshFusedCount);
+  for (uint8_t f = 0; f < meshFusedCount && len < (int)cap; f++) {
+    len += snprintf(buf + len, cap - len, ";%d,%d,%u",
+                    meshFused[f].x, meshFused[f].y, meshFused[f].nodes);
+  }
+}
+
+static void meshStream(unsigned long now) {
+  char buf[MESH_LIST_MAX];
+  meshList(buf, sizeof(buf));
+  telemetryEvent("mesh", buf);
+  memcpy(meshStreamed, meshFused, sizeof(meshFused));
+  meshStreamedCount = meshFusedCount;
+  tMeshStream = now;
+}
+
+/*
+ * meshPump()
+ * ----------
+ * Web side, every pass: takes received packets, sends this turret's
+ * report when due and, on the coordinator, fuses and broadcasts. A new
+ * picture updates the cue and the stream.
+ */
+void meshPump() {
+  if (!meshUp || meshCfg.id == 0) return;   // Indexes meshNodes by id below
+  unsigned long now = millis();
+  uint32_t seq = meshFusedSeq;
+
+  while (meshRxTail != meshRxHead) {
+    __sync_synchronize();
+    const MeshRx &r = meshRx[meshRxTail];
+    meshTake(r.data, r.len, now);
+    meshRxTail = (meshRxTail + 1) % MESH_RX_RING;
+  }
+
+  MeshPoint own[TRACK_MAX];
+  uint8_t n = meshOwnPoints(own);
+
+  if (meshCfg.coord) {
+    MeshNode &m = meshNodes[meshCfg.id - 1];
+    m.seen = now;
+    m.n = n;
+    memcpy(m.p, own, n * sizeof(MeshPoint));
+    if (now - tMeshFuse >= MESH_FUSE_MS) {
+      tMeshFuse = now;
+      meshFuse(now);
+      meshSend(MESH_FUSED, meshFused, meshFusedCount);
+    }
+  } else if (now - tMeshSend >= (n > 0 ? MESH_SEND_MS : MESH_BEAT_MS)) {
+    tMeshSend = now;
+    meshSend(MESH_TRACKS, own, n);
+  }
+
+  // A member whose coordinator went quiet forgets its picture
+  if (!meshCfg.coord && meshFusedCount > 0 && now - tMeshFused > MESH_STALE_MS) {
+    meshFusedCount = 0;
+    meshFusedSeq++;
+  }
+
+  if (meshFusedSeq != seq) {
+    meshCue();
+    if (meshFusedCount != meshStreamedCount ||
+        memcmp(meshStreamed, meshFused, meshFusedCount * sizeof(MeshPoint)) != 0) {
+      meshStream(now);
+    }
+  }
+  if (now - tMeshStream >= MESH_BEAT_MS) meshStream(now);
+}
+
+// ============================================================================
+// ROUTES
+// ============================================================================
+
+/*
+ * meshHandleStatus(srv)
+ * ---------------------
+ * /mesh: pose, turrets heard (bit per id), the fused targets as in the
+ * stream and the radio counters.
+ */
+void meshHandleStatus(WebServer &srv) {
+  char list[MESH_LIST_MAX];
+  meshList(list, sizeof(list));
+  uint8_t heard = 0;
+  unsigned long now = millis();
+  for (uint8_t id = 1; id <= MESH_NODES_MAX; id++) {
+    const MeshNode &m = meshNodes[id - 1];
+    if (m.seen != 0 && now - m.seen <= MESH_STALE_MS) heard |= 1 << (id - 1);
+  }
+
+  char buf[128 + sizeof(list)];
+  JsonOut j;
+  jsonBegin(j, buf, sizeof(buf));
+  jsonInt(j, "id", meshCfg.id);
+  jsonInt(j, "coord", meshCfg.coord ? 1 : 0);
+  jsonInt(j, "x", meshCfg.x);
+  jsonInt(j, "y", meshCfg.y);
+  jsonInt(j, "h", meshCfg.h);
+  jsonInt(j, "up", meshUp ? 1 : 0);
+  jsonUInt(j, "heard", heard);
+  jsonStr(j, "t", list);
+  jsonUInt(j, "rx", meshRxCount);
+  jsonUInt(j, "lost", meshLost);
+  jsonUInt(j, "drop", meshRxDropped);
+  replyJson(srv, j);
+}
+
+/*
+ * meshConfigure(c)
+ * ----------------
+ * Takes a new id, role and pose and saves them. Starts ESP-NOW the
+ * first time an id is set. Once it is up the id can change but not go
+ * back to 0 (meshHandleConfig() refuses that), since only a reboot
+ * stops ESP-NOW; meshPump() still ignores a zero id.
+ */
+void meshConfigure(const MeshConfig &c) {
+  meshCfg = c;
+  meshCfg.id = min(meshCfg.id, (uint8_t)MESH_NODES_MAX);
+  meshCfg.h = ((meshCfg.h % 360) + 360) % 360;
+  memset(meshNodes, 0, sizeof(meshNodes));
+  meshFusedCount = 0;
+
+  meshPrefs.putUChar("id", meshCfg.id);
+  meshPrefs.putBool("coord", meshCfg.coord);
+  meshPrefs.putInt("x", meshCfg.x);
+  meshPrefs.putInt("y", meshCfg.y);
+  meshPrefs.putInt("h", meshCfg.h);
+  meshStart();
+}
+
+/*
+ * meshHandleConfig(srv)
+ * ---------------------
+ * /mesh_config?id=&coord=&x=&y=&h= (any subset). id=0 is refused
+ * while ESP-NOW is up, since only a reboot stops it.
+ */
+void meshHandleConfig(WebServer &srv) {
+  MeshConfig c = meshCfg;
+  int id = c.id, coord = c.coord;
+  replyArgInt(srv, "id", id);
+  replyArgInt(srv, "coord", coord);
+  replyArgInt(srv, "x", c.x);
+  replyArgInt(srv, "y", c.y);
+  replyArgInt(srv, "h", c.h);
+  if (id < 0 || id > MESH_NODES_MAX || (id == 0 && meshUp)) {
+    replyText(srv, 400, "Bad Request");
+    return;
+  }
+  c.id = id;
+  c.coord = coord != 0;
+  meshConfigure(c);
+  replyText(srv, 200, "OK");
+}
+
+#endif // MESH_H
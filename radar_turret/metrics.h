@@ -0,0 +1,226 @@
+/*
+ * ============================================================================
+ * RADAR TURRET METRICS
+ * ============================================================================
+ *
+ * Cycle-counter timing of the hot paths, exposed on /metrics in the
+ * Prometheus text format.
+ *
+ * Each timed site keeps count, sum, min, max and a log2 histogram of
+ * microseconds (bucket i holds durations below 2^i us). Quantiles are
+ * read from the histogram and reported as the bucket's upper bound, so
+ * they are within 2x, which is plenty to see where loop time goes.
+ *
+ * Every metric has a single writer (radar or web side), so recording is
+ * lock-free; a scrape may see one sample half-counted, never corrupt.
+ *
+ * USAGE:
+ *   { METRIC_SCOPE(M_LEDS); strip.show(); }    // time a block
+ *   metricRecord(M_PING, us);                  // record a known duration
+ *   metricLoop(LOOP_RADAR);                    // once per loop pass
+ *   server.on("/metrics", []() { metricsHandle(server); });
+ *
+ * Build with METRICS_ENABLED 0 to compile all of it out.
+ *
+ * ============================================================================
+ */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+#include <stdarg.h>
+#include "boot.h"
+#include "power.h"
+
+#ifndef METRICS_ENABLED
+#define METRICS_ENABLED   1
+#endif
+
+#define METRIC_BUCKETS    20      // Up to ~0.5 s
+#define METRIC_STEP_IDLE_MS 1000  // Longer step gaps are restarts, not misses
+
+enum MetricId {
+  M_RADAR,        // radarStep()
+  M_HTTP,         // server.handleClient()
+  M_PING,         // Burst start to result (sensor wait)
+  M_LEDS,         // NeoPixel show()
+  M_LOG_FLUSH,    // SPIFFS append batch
+  M_STEP_LATE,    // Sweep step lateness against the configured speed
+  M_SCHED_LATE,   // Job start lateness (sched.h)
+  M_TRACE_IO,     // Trace file write or replay read batch (trace.h)
+  METRIC_COUNT
+};
+
+static const char *const METRIC_NAMES[METRIC_COUNT] = {
+  "radar_step_us", "radar_http_handle_us", "radar_ping_wait_us",
+  "radar_led_show_us", "radar_log_flush_us", "radar_sweep_step_late_us",
+  "radar_sched_late_us", "radar_trace_io_us"
+};
+
+enum LoopId { LOOP_RADAR, LOOP_WEB, LOOP_COUNT };
+
+struct Metric {
+  uint32_t count;
+  uint32_t sum;       // us
+  uint32_t minUs;
+  uint32_t maxUs;
+  uint32_t hist[METRIC_BUCKETS];
+};
+
+Metric metrics[METRIC_COUNT];
+uint32_t metricMisses = 0;           // Steps later than a whole period
+uint32_t metricOverruns = 0;         // Jobs re-phased by the scheduler
+
+uint32_t loopCount[LOOP_COUNT];
+uint32_t loopRate[LOOP_COUNT];       // Passes in the last full second
+unsigned long loopWindow[LOOP_COUNT];
+
+#if METRICS_ENABLED
+
+/*
+ * metricRecord(id, us)
+ * --------------------
+ * Adds one duration sample.
+ */
+void metricRecord(uint8_t id, uint32_t us) {
+  Metric &m = metrics[id];
+  if (m.count == 0 || us < m.minUs) m.minUs = us;
+  if (us > m.maxUs) m.maxUs = us;
+  m.count++;
+  m.sum += us;
+
+  uint8_t b = 0;
+  while (b < METRIC_BUCKETS - 1 && us >= (1UL << b)) b++;
+  m.hist[b]++;
+}
+
+// Times its own lifetime with the CPU cycle counter
+struct MetricScope {
+  uint8_t id;
+  uint32_t start;
+  MetricScope(uint8_t i) : id(i), start(ESP.getCycleCount()) {}
+  ~MetricScope() {
+    metricRecord(id, (ESP.getCycleCount() - start) / ESP.getCpuFreqMHz());
+  }
+};
+
+#define METRIC_SCOPE(id)  MetricScope _metricScope(id)
+
+/*
+ * metricLoop(loop)
+ * ----------------
+ * Counts one pass of the radar or web loop and rolls the per-second
+ * loop-rate gauge.
+ */
+void metricLoop(uint8_t loop) {
+  loopCount[loop]++;
+  unsigned long now = millis();
+  if (now - loopWindow[loop] >= 1000) {
+    static uint32_t lastCount[LOOP_COUNT];
+    loopRate[loop] = loopCount[loop] - lastCount[loop];
+    lastCount[loop] = loopCount[loop];
+    loopWindow[loop] = now;
+  }
+}
+
+/*
+ * metricStep(intervalMs, periodMs)
+ * --------------------------------
+ * Records how late a sweep step came against its configured period.
+ */
+void metricStep(unsigned long intervalMs, unsigned long periodMs) {
+  if (intervalMs >= METRIC_STEP_IDLE_MS) return;
+  unsigned long late = intervalMs > periodMs ? intervalMs - periodMs : 0;
+  metricRecord(M_STEP_LATE, late * 1000);
+  if (late >= periodMs) metricMisses++;
+}
+
+#else
+
+#define METRIC_SCOPE(id)
+inline void metricRecord(uint8_t, uint32_t) {}
+inline void metricLoop(uint8_t) {}
+inline void metricStep(unsigned long, unsigned long) {}
+
+#endif
+
+static uint32_t metricQuantile(const Metric &m, float q) {
+  uint32_t want = (uint32_t)(m.count * q + 0.5f);
+  uint32_t seen = 0;
+  for (uint8_t b = 0; b < METRIC_BUCKETS; b++) {
+    seen += m.hist[b];
+    if (seen >= want && seen > 0) return min(1UL << b, (unsigned long)m.maxUs);
+  }
+  return m.maxUs;
+}
+
+static char metricsBuf[4096];
+static size_t metricsLen = 0;
+
+static void metricsPut(const char *fmt, ...) {
+  if (metricsLen >= sizeof(metricsBuf)) return;
+  va_list ap;
+  va_start(ap, fmt);
+  metricsLen += vsnprintf(metricsBuf + metricsLen, sizeof(metricsBuf) - metricsLen, fmt, ap);
+  va_end(ap);
+}
+
+/*
+ * metricsHandle(srv)
+ * ------------------
+ * Handler for /metrics. Web side only (shares one static buffer).
+ */
+void metricsHandle(WebServer &srv) {
+  metricsLen = 0;
+
+  for (uint8_t i = 0; i < METRIC_COUNT; i++) {
+    const Metric &m = metrics[i];
+    const char *name = METRIC_NAMES[i];
+    metricsPut("# TYPE %s summary\n", name);
+    metricsPut("%s{quantile=\"0.5\"} %lu\n", name, (unsigned long)metricQuantile(m, 0.5f));
+    metricsPut("%s{quantile=\"0.9\"} %lu\n", name, (unsigned long)metricQuantile(m, 0.9f));
+    metricsPut("%s{quantile=\"0.99\"} %lu\n", name, (unsigned long)metricQuantile(m, 0.99f));
+    metricsPut("%s_sum %lu\n", name, (unsigned long)m.sum);
+    metricsPut("%s_count %lu\n", name, (unsigned long)m.count);
+    metricsPut("%s_min %lu\n", name, (unsigned long)m.minUs);
+    metricsPut("%s_max %lu\n", name, (unsigned long)m.maxUs);
+  }
+
+  metricsPut("# TYPE radar_sweep_deadline_miss_total counter\n");
+  metricsPut("radar_sweep_deadline_miss_total %lu\n", (unsigned long)metricMisses);
+  metricsPut("# TYPE radar_sched_overrun_total counter\n");
+  metricsPut("radar_sched_overrun_total %lu\n", (unsigned long)metricOverruns);
+  metricsPut("# TYPE radar_loop_rate_hz gauge\n");
+  metricsPut("radar_loop_rate_hz{loop=\"radar\"} %lu\n", (unsigned long)loopRate[LOOP_RADAR]);
+  metricsPut("radar_loop_rate_hz{loop=\"web\"} %lu\n", (unsigned long)loopRate[LOOP_WEB]);
+  metricsPut("# TYPE radar_free_heap_bytes gauge\n");
+  metricsPut("radar_free_heap_bytes %lu\n", (unsigned long)ESP.getFreeHeap());
+
+  // Low-power mode, see power.h
+  metricsPut("# TYPE radar_sleep_us_total counter\n");
+  metricsPut("radar_sleep_us_total %llu\n", (unsigned long long)powerSleptUs);
+  metricsPut("# TYPE radar_sleep_total counter\n");
+  metricsPut("radar_sleep_total %lu\n", (unsigned long)powerSleeps);
+  metricsPut("# TYPE radar_sweep_pace gauge\n");
+  metricsPut("radar_sweep_pace %u\n", (unsigned)powerPace);
+  metricsPut("# TYPE radar_radio_parked gauge\n");
+  metricsPut("radar_radio_parked %d\n", powerRadioOff ? 1 : 0);
+
+  // Static after boot, see boot.h
+  metricsPut("# TYPE radar_boot_stage_us gauge\n");
+  for (uint8_t i = 0; i < bootCount; i++) {
+    metricsPut("radar_boot_stage_us{stage=\"%s\",deferred=\"%d\"} %lu\n", bootStages[i].name,
+               bootStages[i].fn ? 1 : 0, (unsigned long)bootStages[i].us);
+  }
+  metricsPut("# TYPE radar_boot_radar_ready_ms gauge\n");
+  metricsPut("radar_boot_radar_ready_ms %lu\n", (unsigned long)(bootRadarUs / 1000));
+  metricsPut("# TYPE radar_boot_complete_ms gauge\n");
+  metricsPut("radar_boot_complete_ms %lu\n", (unsigned long)(bootDoneUs / 1000));
+
+  srv.send_P(200, "text/plain; version=0.0.4", metricsBuf,
+             min(metricsLen, sizeof(metricsBuf) - 1));
+}
+
+#endif // METRICS_H
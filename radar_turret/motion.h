@@ -0,0 +1,102 @@
+/*
+ * ============================================================================
+ * RADAR TURRET SERVO MOTION MODEL
+ * ============================================================================
+ *
+ * The scan servo has no position feedback, so a ping fired right after
+ * write() measures whatever the horn was pointing at on the way. This
+ * model estimates where the horn is from the commanded step and the
+ * servo's slew rate, and tells the sweep when a ping is worth firing.
+ *
+ * TIMING (SG90 class, 0.1s/60deg unloaded, derated):
+ *   travel  = |to - from| * SERVO_US_PER_DEG
+ *   arrival = travel + SERVO_SETTLE_US        (horn stops ringing)
+ *
+ * A ping may also fire while the horn is still moving, once it is less
+ * than MOTION_PING_AHEAD_DEG from the target. The reading is then
+ * attributed to the interpolated angle instead of the target, which
+ * keeps coarse steps from waiting out the whole settle time. Steps of
+ * MOTION_PING_AHEAD_DEG or less (the fine strides over unlearned cells)
+ * would be inside that window from the start, so they always wait.
+ * Set MOTION_PING_AHEAD_DEG to 0 to always wait for arrival.
+ *
+ * USAGE:
+ *   servo.write(pos); motionMove(pos);     // arms a ping
+ *   int a;
+ *   if (motionPingReady(a)) { fire ping, record it at angle a }
+ *
+ * ============================================================================
+ */
+
+#ifndef MOTION_H
+#define MOTION_H
+
+#include <Arduino.h>
+
+#define SERVO_US_PER_DEG       2000   // ~500 deg/s
+#define SERVO_SETTLE_US        4000   // Ringing after the horn stops
+#define MOTION_PING_AHEAD_DEG  2      // Ping-while-moving window
+#define MOTION_ECHO_LEAD_US    1000   // Echo mid-flight (~17cm round trip)
+
+int motionFrom = 90;
+int motionTo = 90;
+unsigned long motionStartUs = 0;
+unsigned long motionTravelUs = 0;
+bool motionPingDue = false;
+
+/*
+ * motionMove(to, ping)
+ * --------------------
+ * Records a new servo command. The move starts from wherever the horn
+ * is estimated to be now. With ping set, the next motionPingReady()
+ * that succeeds belongs to this move; otherwise any pending ping is
+ * dropped (e.g. centering on stop).
+ */
+void motionMove(int to, bool ping = true);
+
+/*
+ * motionAngle(leadUs)
+ * -------------------
+ * Estimated horn angle leadUs from now, rounded toward the target.
+ */
+int motionAngle(unsigned long leadUs = 0) {
+  unsigned long t = micros() - motionStartUs + leadUs;
+  if (t >= motionTravelUs) return motionTo;
+
+  int dir = motionTo > motionFrom ? 1 : -1;
+  int left = (int)((motionTravelUs - t) / SERVO_US_PER_DEG);
+  return motionTo - dir * left;
+}
+
+void motionMove(int to, bool ping) {
+  motionFrom = motionAngle();
+  motionTo = to;
+  motionStartUs = micros();
+  motionTravelUs = (unsigned long)abs(to - motionFrom) * SERVO_US_PER_DEG;
+  motionPingDue = ping;
+}
+
+/*
+ * motionPingReady(angle)
+ * ----------------------
+ * True once per armed move, at the earliest moment a ping is valid:
+ * after arrival plus settle, or inside the ping-while-moving window of
+ * a step longer than that window.
+ * angle is where the reading should be recorded: where the horn will
+ * be while the echo is in flight.
+ */
+bool motionPingReady(int &angle) {
+  if (!motionPingDue) return false;
+
+  unsigned long t = micros() - motionStartUs;
+  bool arrived = t >= motionTravelUs + SERVO_SETTLE_US;
+  unsigned long aheadUs = (unsigned long)MOTION_PING_AHEAD_DEG * SERVO_US_PER_DEG;
+  bool close = motionTravelUs > aheadUs && t + aheadUs > motionTravelUs;
+  if (!arrived && !close) return false;
+
+  motionPingDue = false;
+  angle = arrived ? motionTo : motionAngle(MOTION_ECHO_LEAD_US);
+  return true;
+}
+
+#endif // MOTION_H
@@ -46,26 +46,30 @@
 #include <Preferences.h>
 #include <time.h>
 
-#include "web.h"  // Web interface HTML
+#include "profile.h" // Board variant (pins, LEDs, buzzer, modes)
+#include "web.h"   // Web interface HTML
+#include "radar.h" // Shared core: sweep, tracking, log, web plumbing
+#include "assets.h" // Gzipped dashboard (web_gz.h)
 
 // ============================================================================
-// PIN DEFINITIONS
+// PIN DEFINITIONS (profile.h)
 // ============================================================================
-#define PIN_TRIG        5     // Ultrasonic trigger
-#define PIN_ECHO        35    // Ultrasonic echo
-#define PIN_SERVO_SCAN  19    // Scanning servo
-#define PIN_SERVO_ARROW 18    // Pointing servo
-#define PIN_NEOPIXEL    26    // LED strip data
-#define PIN_BUZZER      23    // Buzzer output
-#define PIN_BUTTON      27    // Control button
+#define PIN_TRIG        Board::pinTrig        // Ultrasonic trigger
+#define PIN_ECHO        Board::pinEcho        // Ultrasonic echo
+#define PIN_SERVO_SCAN  Board::pinServoScan   // Scanning servo
+#define PIN_SERVO_ARROW Board::pinServoArrow  // Pointing servo
+#define PIN_NEOPIXEL    Board::pinNeopixel    // LED strip data
+#define PIN_BUZZER      Board::pinBuzzer      // Buzzer output
+#define PIN_BUTTON      Board::pinButton      // Control button
 
 // ============================================================================
 // CONSTANTS
 // ============================================================================
-#define NUM_LEDS        3           // Number of NeoPixels
-#define LOG_MAX_SIZE    50000       // Max log file size (50KB)
+#define NUM_LEDS        Board::numLeds      // Number of NeoPixels
 #define DEBOUNCE_MS     50          // Button debounce time
 #define LONG_PRESS_MS   2000        // Long press threshold
+#define THREADED_MODE   0           // 1 = radar on core 1, web on core 0
+#define POWER_SAVE      0           // 1 = low-power mode for battery units (power.h)
 
 // ============================================================================
 // OPERATING MODES
@@ -87,12 +91,62 @@ enum Mode {
 
 const char* MODE_NAMES[] = {"SENTRY", "STEALTH", "AGGRESSIVE", "PARTY"};
 
-//                          {speed, brightness, buzzer}
-const int MODE_PARAMS[][3] = {
-  {20,  50,  1},    // SENTRY:     Normal speed, medium brightness, buzzer ON
-  {40,  10,  0},    // STEALTH:    Slow, very dim, buzzer OFF
-  {10,  255, 1},    // AGGRESSIVE: Fast, full brightness, buzzer ON
-  {25,  100, 1}     // PARTY:      Medium speed, bright, buzzer ON
+struct ModeParams {
+  uint16_t speed;     // ms per sweep step
+  uint8_t bright;     // LED intensity
+  bool buzz;          // Alerts make sound
+};
+
+constexpr ModeParams MODE_PARAMS[MODE_COUNT] = {
+  {20,  50,  true},   // SENTRY:     Normal speed, medium brightness, buzzer ON
+  {40,  10,  false},  // STEALTH:    Slow, very dim, buzzer OFF
+  {10,  255, true},   // AGGRESSIVE: Fast, full brightness, buzzer ON
+  {25,  100, true}    // PARTY:      Medium speed, bright, buzzer ON
+};
+
+// Macros, not functions: the IDE hoists function prototypes above the
+// enums. Both fold to constants for a constant m.
+#define MODE_ENABLED(m)  ((Board::modes & MODE_BIT(m)) != 0)   // Offered by this board
+#define MODE_BUZZ(m)     (Board::hasBuzzer && MODE_PARAMS[m].buzz) // Alerts make sound
+#define MODE_FAST_MS     (MODE_PARAMS[MODE_AGGRESSIVE].speed)  // Low-power pace on a target (power.h)
+
+/*
+ * MODE_DISPATCH(fn, args...)
+ * --------------------------
+ * Calls the fn<M>(args) specialization for the current mode, so mode
+ * checks inside fn are compile-time constants. Modes the board does not
+ * offer sit behind a constant-false branch and are dropped.
+ */
+#define MODE_DISPATCH(fn, ...) \
+  switch (mode) { \
+    case MODE_SENTRY:     if (MODE_ENABLED(MODE_SENTRY)) fn<MODE_SENTRY>(__VA_ARGS__); break; \
+    case MODE_STEALTH:    if (MODE_ENABLED(MODE_STEALTH)) fn<MODE_STEALTH>(__VA_ARGS__); break; \
+    case MODE_AGGRESSIVE: if (MODE_ENABLED(MODE_AGGRESSIVE)) fn<MODE_AGGRESSIVE>(__VA_ARGS__); break; \
+    case MODE_PARTY:      if (MODE_ENABLED(MODE_PARTY)) fn<MODE_PARTY>(__VA_ARGS__); break; \
+    default: break; \
+  }
+
+template <Mode M> void alertMode(int dist);
+template <Mode M> void modeColor(int intensity);
+template <Mode M> void scanIdle();
+
+/*
+ * RADAR_MODES
+ * -----------
+ * What each mode does for the core (radar.h), picked at run time by
+ * applyMode(). Each entry points at the mode's own specialization, so
+ * the checks inside stay compile-time constants. A mode the board does
+ * not offer gets empty hooks and its handlers are never referenced.
+ */
+#define RADAR_MODE(M, name) \
+  { name, M, MODE_ENABLED(M) ? &scanIdle<M> : nullptr, \
+             MODE_ENABLED(M) ? &alertMode<M> : nullptr }
+
+const RadarMode RADAR_MODES[MODE_COUNT] = {
+  RADAR_MODE(MODE_SENTRY, "SENTRY"),
+  RADAR_MODE(MODE_STEALTH, "STEALTH"),
+  RADAR_MODE(MODE_AGGRESSIVE, "AGGRESSIVE"),
+  RADAR_MODE(MODE_PARTY, "PARTY")
 };
 
 // ============================================================================
@@ -111,33 +165,25 @@ const int MODE_PARAMS[][3] = {
 #define NOTE_C5  523
 #define NOTE_GS4 415
 
-// Melody notes and timings
-const int HEDWIG_NOTES[] = {
-  NOTE_B3, NOTE_E4, NOTE_G4, NOTE_FS4, NOTE_E4, NOTE_B4, NOTE_A4,
-  NOTE_FS4, NOTE_E4, NOTE_G4, NOTE_FS4, NOTE_D5, NOTE_CS5,
-  NOTE_C5, NOTE_GS4, NOTE_B3, NOTE_E4
+// Melody {note, ms} (audio.h)
+const Note HEDWIG[] PROGMEM = {
+  {NOTE_B3, 250}, {NOTE_E4, 375}, {NOTE_G4, 125}, {NOTE_FS4, 250},
+  {NOTE_E4, 500}, {NOTE_B4, 250}, {NOTE_A4, 750},
+  {NOTE_FS4, 500}, {NOTE_E4, 375}, {NOTE_G4, 125}, {NOTE_FS4, 250},
+  {NOTE_D5, 500}, {NOTE_CS5, 250},
+  {NOTE_C5, 750}, {NOTE_GS4, 500}, {NOTE_B3, 250}, {NOTE_E4, 750}
 };
 
-const int HEDWIG_TIMES[] = {
-  250, 375, 125, 250, 500, 250, 750,
-  500, 375, 125, 250, 500, 250,
-  750, 500, 250, 750
-};
-
-const int HEDWIG_LEN = sizeof(HEDWIG_NOTES) / sizeof(HEDWIG_NOTES[0]);
-
 // Mode switch sound effects
-const int SFX_SENTRY[] = {440, 0, 440};
-const int SFX_SENTRY_T[] = {100, 50, 100};
-
-const int SFX_STEALTH[] = {220};
-const int SFX_STEALTH_T[] = {150};
-
-const int SFX_AGGRO[] = {880, 0, 880, 0, 880};
-const int SFX_AGGRO_T[] = {50, 30, 50, 30, 50};
+const Note SFX_SENTRY[] PROGMEM = {{440, 100}, {0, 50}, {440, 100}};
+const Note SFX_STEALTH[] PROGMEM = {{220, 150}};
+const Note SFX_AGGRO[] PROGMEM = {{880, 50}, {0, 30}, {880, 50}, {0, 30}, {880, 50}};
+const Note SFX_PARTY[] PROGMEM = {
+  {262, 80}, {294, 80}, {330, 80}, {349, 80},
+  {392, 80}, {440, 80}, {494, 80}, {523, 120}
+};
 
-const int SFX_PARTY[] = {262, 294, 330, 349, 392, 440, 494, 523};
-const int SFX_PARTY_T[] = {80, 80, 80, 80, 80, 80, 80, 120};
+#define TUNE_LEN(t)  (sizeof(t) / sizeof(t[0]))
 
 // ============================================================================
 // GLOBAL OBJECTS
@@ -145,18 +191,22 @@ const int SFX_PARTY_T[] = {80, 80, 80, 80, 80, 80, 80, 120};
 Servo servoScan;      // Radar sweep servo
 Servo servoArrow;     // Target pointer servo
 Adafruit_NeoPixel leds(NUM_LEDS, PIN_NEOPIXEL, NEO_GRB + NEO_KHZ800);
-WebServer server(80);
 Preferences prefs;
 
 // ============================================================================
 // CONFIGURATION
 // ============================================================================
+#define CONFIG_VERSION  1   // Bump when Config changes (configstore.h)
+
 struct Config {
   int maxDist   = 50;     // Detection range (cm)
   int lockTime  = 2000;   // Lock-on duration (ms)
   int minAngle  = 15;     // Sweep start angle
   int maxAngle  = 165;    // Sweep end angle
-} config;
+  int samples   = 3;      // Max pings per step (median)
+} config;                 // Radar side once running
+
+Config configNext;        // Web side's copy, staged for CMD_APPLY_CONFIG (tasks.h)
 
 // ============================================================================
 // STATE VARIABLES
@@ -164,7 +214,7 @@ struct Config {
 
 // System state machine
 enum State {
-  STATE_STARTUP,      // Playing startup tune
+  STATE_STARTUP,      // Boot: AP and web server coming up
   STATE_IDLE,         // Not scanning
   STATE_SCANNING,     // Active radar sweep
   STATE_LOCKED,       // Locked on target
@@ -172,30 +222,15 @@ enum State {
 };
 
 State state = STATE_STARTUP;
-Mode mode = MODE_SENTRY;
-
-// Radar position
-int scanPos = 90;           // Current servo angle
-int scanDir = 1;            // Sweep direction (+1 or -1)
-int lastDist = 0;           // Last distance reading
+Mode mode = (Mode)Board::defaultMode;
 
-// Intrusion tracking
-int lastIntrudeAngle = 0;
-int lastIntrudeDist = 0;
+// Sweep position, readings and intrusions live in the core (radar.h)
 
-// Timing (all non-blocking)
-unsigned long tScan = 0;        // Last scan step time
-unsigned long tLock = 0;        // Lock-on start time
+// Timing (all non-blocking, periodic work runs from sched.h jobs)
 unsigned long tButton = 0;      // Button press start time
-unsigned long tAnim = 0;        // Animation frame time
-unsigned long tNote = 0;        // Melody note time
 
-// Melody player state
-const int* melodyNotes = nullptr;
-const int* melodyTimes = nullptr;
-int melodyLen = 0;
-int melodyIdx = 0;
-bool melodyPlaying = false;
+// Scheduler jobs; the sweep jobs belong to radar.h
+int8_t jobControl, jobAnim, jobLeds;
 
 // Animation state
 int animFrame = 0;
@@ -205,7 +240,6 @@ int partyHue = 0;
 bool btnPressed = false;
 bool longPressUsed = false;
 bool scanning = false;
-bool timeSynced = false;
 
 // ============================================================================
 // WIFI CONFIGURATION
@@ -220,26 +254,24 @@ const char* WIFI_PASS = "12345678";
 /*
  * setup()
  * -------
- * Initializes all hardware and starts the web server.
- * Plays Harry Potter theme on boot.
+ * Initializes the radar hardware and starts its jobs. The file system,
+ * AP and web server are deferred to the web side (see boot.h), and
+ * Harry Potter plays in the background.
  */
 void setup() {
   Serial.begin(115200);
   Serial.println("\n=== RADAR TURRET v3.0 ===");
-
-  // Initialize file system
-  if (!SPIFFS.begin(true)) {
-    Serial.println("[!] SPIFFS format required");
-  }
+  bootMark("serial");
   
   // Load saved settings
   prefs.begin("radar", false);
-  loadConfig();
+  loadConfig(config);
+  configNext = config;
+  bootMark("config");
   
   // Configure GPIO
-  pinMode(PIN_TRIG, OUTPUT);
-  pinMode(PIN_ECHO, INPUT);
-  pinMode(PIN_BUZZER, OUTPUT);
+  echoBegin(PIN_TRIG, PIN_ECHO);
+  if (Board::hasBuzzer) audioBegin(PIN_BUZZER);
   pinMode(PIN_BUTTON, INPUT_PULLUP);
 
   // Initialize servos
@@ -254,24 +286,66 @@ void setup() {
   leds.begin();
   leds.setBrightness(50);
   leds.show();
+  static_assert(NUM_LEDS <= LED_MAX_PIXELS, "profile has more LEDs than leds.h holds");
+  ledsBegin(leds, NUM_LEDS);
+  ledsBrightness(50);
+  
+  // Radar jobs, started and stopped by enterState()
+  radarBegin(servoScan, servoArrow, &RADAR_MODES[mode], onLock);
+  powerBegin(POWER_SAVE, PIN_BUTTON, bootWifi);
+  applyMode();
+  radarCenter();
+  bootMark("hw");
+  
+  bootDefer("fs", bootFs);
+  bootDefer("wifi", bootWifi);
+  bootDefer("mesh", meshBegin);
+  bootDefer("web", bootWeb);
+  
+  jobControl = schedAdd(controlTick, 10);
+  jobAnim    = schedAdd(animTick, 100);
+  jobLeds    = schedAdd(ledsTick, LED_FRAME_MS);
+  powerRelax(jobControl, 10);
+  powerRelax(jobLeds, LED_FRAME_MS);
+  schedStart(jobControl);
+  schedStart(jobAnim);
+  schedStart(jobLeds);
+  
+  // Play Harry Potter!
+  state = STATE_STARTUP;
+  if (Board::hasBuzzer) audioPlay(HEDWIG, TUNE_LEN(HEDWIG));
+  Serial.println("[*] Playing Hedwig's Theme...");
+  radarPublish(state, mode);
+  
+#if THREADED_MODE
+  startTasks(radarStep, webStep);
+#endif
+  
+  bootRadarUp();
+}
+
+// ============================================================================
+// DEFERRED BOOT STAGES (web side, see boot.h)
+// ============================================================================
 
-  // Start WiFi Access Point
+void bootFs() {
+  if (!SPIFFS.begin(true)) {
+    Serial.println("[!] SPIFFS format required");
+  }
+  logBegin(MODE_NAMES, MODE_COUNT);
+  traceBegin();
+}
+
+void bootWifi() {
   WiFi.softAP(WIFI_SSID, WIFI_PASS);
   Serial.print("[+] WiFi AP: ");
   Serial.println(WiFi.softAPIP());
+}
 
-  // Setup HTTP routes
+void bootWeb() {
   setupRoutes();
   server.begin();
   Serial.println("[+] Web server started");
-  
-  // Center servos
-  centerServos();
-  
-  // Play Harry Potter!
-  state = STATE_STARTUP;
-  playMelody(HEDWIG_NOTES, HEDWIG_TIMES, HEDWIG_LEN);
-  Serial.println("[*] Playing Hedwig's Theme...");
 }
 
 // ============================================================================
@@ -283,21 +357,39 @@ void setup() {
  * ------
  * Main program loop. Handles:
  *   1. Web server requests
- *   2. Button input
- *   3. Melody playback
- *   4. State machine (startup/idle/scanning/locked/mode switch)
+ *   2. Radar step (see radarStep)
+ *   3. Sleeps until the next radar job is due, but no longer than
+ *      LOOP_WEB_POLL_MS so web requests stay responsive (or light
+ *      sleeps with POWER_SAVE once the radio is parked, see power.h)
+ * 
+ * With THREADED_MODE both run in their own pinned tasks instead.
  */
 void loop() {
-  server.handleClient();
-  handleButton();
-  updateMelody();
-  
-  switch (state) {
-    case STATE_STARTUP:    doStartup();    break;
-    case STATE_IDLE:       doIdle();       break;
-    case STATE_SCANNING:   doScanning();   break;
-    case STATE_LOCKED:     doLocked();     break;
-    case STATE_MODE_SWITCH: doModeSwitch(); break;
+#if THREADED_MODE
+  vTaskDelete(NULL);  // Work runs in radarTask / webTask
+#else
+  webStep();
+  uint32_t idle = radarStep();
+  if (idle > 0) radarIdle(idle);
+#endif
+}
+
+/*
+ * runCommand(cmd, arg)
+ * --------------------
+ * Applies a command posted by a web handler. Always runs on the
+ * radar side (see tasks.h).
+ */
+void runCommand(uint8_t cmd, int arg) {
+  switch (cmd) {
+    case CMD_TOGGLE:          toggleScanning(); break;
+    case CMD_CENTER:          radarCenter(); break;
+    case CMD_CLEAR_INTRUSION: radarClearIntrusion(); break;
+    case CMD_APPLY_CONFIG:    applyConfig(); break;
+    case CMD_SET_MODE:        setMode((Mode)arg); break;
+    case CMD_RELEARN:         bgReset(); break;
+    case CMD_CUE:             arrowCue(arg); break;
+    case CMD_TRACE_REPLAY:    radarReplayStart(); break;
   }
 }
 
@@ -306,117 +398,97 @@ void loop() {
 // ============================================================================
 
 /*
- * doStartup()
- * -----------
- * Blue pulsing animation while Harry Potter plays.
- * Transitions to IDLE when melody finishes.
+ * enterState(s)
+ * -------------
+ * Switches state and starts/stops the scheduler jobs (sched.h) that
+ * implement it:
+ *   STARTUP, IDLE       jobAnim @ 100ms
+ *   MODE_SWITCH         jobAnim @ 80ms
+ *   SCANNING, LOCKED    the core's sweep jobs (radar.h), which moves
+ *                       between the two through onLock()
  */
-void doStartup() {
-  unsigned long now = millis();
+void enterState(State s) {
+  if (s == state) return;
+  state = s;
   
-  if (now - tAnim >= 100) {
-    tAnim = now;
-    animFrame++;
-    int brightness = (sin(animFrame * 0.2) + 1) * 127;
-    setLeds(0, 0, brightness);
-  }
+  bool sweeping = (s == STATE_SCANNING || s == STATE_LOCKED);
+  radarRun(sweeping);
   
-  if (!melodyPlaying) {
-    state = STATE_IDLE;
-    ledsOff();
-    Serial.println("[+] Ready!");
+  if (!sweeping) {
+    animFrame = 0;
+    schedPeriod(jobAnim, s == STATE_MODE_SWITCH ? 80 : 100);
+    schedStart(jobAnim);
+  } else {
+    schedStop(jobAnim);
   }
 }
 
 /*
- * doIdle()
- * --------
- * Runs idle animation based on current mode.
- * PARTY mode: rainbow cycle
- * Others: subtle color pulse
+ * controlTick()
+ * -------------
+ * Every 10ms: queued web commands, button input, snapshot.
  */
-void doIdle() {
-  unsigned long now = millis();
-  
-  if (now - tAnim >= 100) {
-    tAnim = now;
-    
-    if (mode == MODE_PARTY) {
-      rainbowCycle();
-    } else {
-      animFrame++;
-      int pulse = 5 + abs(sin(animFrame * 0.1) * 10);
-      setModeColor(pulse);
-    }
-  }
+void controlTick() {
+  drainCommands();
+  handleButton();
+  radarPublish(state, mode);
 }
 
 /*
- * doScanning()
- * ------------
- * Performs radar sweep:
- *   1. Steps servo position
- *   2. Reads distance
- *   3. If object detected, goes to LOCKED state
- *   4. Updates LEDs based on mode
+ * onLock(locked)
+ * --------------
+ * The core gained or dropped its lock on a track.
  */
-void doScanning() {
-  unsigned long now = millis();
-  int speed = MODE_PARAMS[mode][0];
-  
-  if (now - tScan >= speed) {
-    tScan = now;
-    
-    // Move servo
-    scanPos += scanDir;
-    if (scanPos >= config.maxAngle) { scanPos = config.maxAngle; scanDir = -1; }
-    if (scanPos <= config.minAngle) { scanPos = config.minAngle; scanDir = 1; }
-    servoScan.write(scanPos);
-    
-    // Read sensor
-    lastDist = readDistance();
-    
-    // Check for detection
-    if (lastDist > 0 && lastDist < config.maxDist) {
-      state = STATE_LOCKED;
-      tLock = now;
-      
-      servoArrow.write(scanPos);
-      lastIntrudeAngle = scanPos;
-      lastIntrudeDist = lastDist;
-      logIntrusion(scanPos, lastDist);
-      
-      doAlert(lastDist);
-    } else {
-      // Idle animation while scanning
-      if (mode == MODE_PARTY) {
-        rainbowCycle();
-      } else if (mode == MODE_STEALTH) {
-        setLeds(0, 2, 0);
-      } else {
-        setModeColor(8);
-      }
-      noTone(PIN_BUZZER);
-    }
-  }
+void onLock(bool locked) {
+  enterState(locked ? STATE_LOCKED : STATE_SCANNING);
 }
 
 /*
- * doLocked()
+ * animTick()
  * ----------
- * Target lock-on state. Runs alert animation.
- * Returns to SCANNING when lock time expires.
+ * Animation frame for the non-sweeping states.
  */
-void doLocked() {
-  unsigned long now = millis();
-  
-  doAlert(lastDist);
+void animTick() {
+  switch (state) {
+    case STATE_STARTUP:     doStartup();    break;
+    case STATE_IDLE:        doIdle();       break;
+    case STATE_MODE_SWITCH: doModeSwitch(); break;
+    default: break;
+  }
+}
+
+/*
+ * doStartup()
+ * -----------
+ * Blue pulsing animation while the AP and web server come up.
+ * Transitions to IDLE once they are (the melody plays on).
+ */
+void doStartup() {
+  animFrame++;
+  int brightness = (sin(animFrame * 0.2) + 1) * 127;
+  setLeds(0, 0, brightness);
   
-  if (now - tLock > config.lockTime) {
-    state = STATE_SCANNING;
+  if (bootComplete) {
+    enterState(STATE_IDLE);
     ledsOff();
-    noTone(PIN_BUZZER);
-    servoArrow.write(90);
+    Serial.println("[+] Ready!");
+  }
+}
+
+/*
+ * doIdle()
+ * --------
+ * Runs idle animation based on current mode.
+ * PARTY mode: rainbow cycle
+ * Others: subtle color pulse
+ */
+void doIdle() {
+  if (mode == MODE_PARTY) {
+    rainbowCycle();
+  } else {
+    animFrame++;
+    int pulse = 5 + abs(sin(animFrame * 0.1) * 10);
+    setModeColor(pulse);
   }
 }
 
@@ -426,23 +498,17 @@ void doLocked() {
  * Flashes mode color 3 times during transition.
  */
 void doModeSwitch() {
-  unsigned long now = millis();
+  animFrame++;
   
-  if (now - tAnim >= 80) {
-    tAnim = now;
-    animFrame++;
-    
-    if (animFrame % 2 == 0) {
-      setModeColor(255);
-    } else {
-      ledsOff();
-    }
-    
-    if (animFrame >= 6) {
-      animFrame = 0;
-      state = scanning ? STATE_SCANNING : STATE_IDLE;
-      if (!scanning) ledsOff();
-    }
+  if (animFrame % 2 == 0) {
+    setModeColor(255);
+  } else {
+    ledsOff();
+  }
+  
+  if (animFrame >= 6) {
+    enterState(scanning ? STATE_SCANNING : STATE_IDLE);
+    if (!scanning) ledsOff();
   }
 }
 
@@ -451,112 +517,68 @@ void doModeSwitch() {
 // ============================================================================
 
 /*
- * doAlert(dist)
- * -------------
- * Runs distance-based alert animation.
+ * alertMode<M>(dist)
+ * ------------------
+ * Distance-based alert while a track is alive (RADAR_MODES).
  * Behavior varies by mode:
  *   - STEALTH: Dim LEDs, no sound
  *   - PARTY: Rainbow flash with varying tone
  *   - Others: Color based on distance (yellow→orange→red)
  */
-void doAlert(int dist) {
-  bool buzz = MODE_PARAMS[mode][2];
-  int bright = MODE_PARAMS[mode][1];
+template <Mode M>
+void alertMode(int dist) {
+  const bool buzz = MODE_BUZZ(M);
+  const int bright = MODE_PARAMS[M].bright;
   
   // Stealth: minimal alert
-  if (mode == MODE_STEALTH) {
+  if (M == MODE_STEALTH) {
     setLeds(bright / 3, bright / 5, 0);
     return;
   }
   
   // Party: rainbow flash
-  if (mode == MODE_PARTY) {
+  if (M == MODE_PARTY) {
     rainbowCycle();
-    if (buzz) tone(PIN_BUZZER, 500 + (millis() % 1000));
+    if (buzz) audioTone(500 + (millis() % 1000));
     return;
   }
   
   // Standard distance-based alerts
   if (dist < 5) {
     // CRITICAL: Red blink
-    int rate = (mode == MODE_AGGRESSIVE) ? 50 : 100;
+    const int rate = (M == MODE_AGGRESSIVE) ? 50 : 100;
     if ((millis() / rate) % 2) setLeds(bright, 0, 0);
     else ledsOff();
-    if (buzz) tone(PIN_BUZZER, (mode == MODE_AGGRESSIVE) ? 2500 : 2000);
+    if (buzz) audioTone((M == MODE_AGGRESSIVE) ? 2500 : 2000);
   } 
   else if (dist < 15) {
     // WARNING: Orange
     setLeds(bright, bright * 55 / 100, 0);
-    if (buzz) tone(PIN_BUZZER, (mode == MODE_AGGRESSIVE) ? 1800 : 1500);
+    if (buzz) audioTone((M == MODE_AGGRESSIVE) ? 1800 : 1500);
   } 
   else {
     // CAUTION: Yellow
     setLeds(bright, bright, 0);
-    if (buzz) tone(PIN_BUZZER, (mode == MODE_AGGRESSIVE) ? 1200 : 1000);
+    if (buzz) audioTone((M == MODE_AGGRESSIVE) ? 1200 : 1000);
   }
 }
 
 // ============================================================================
-// MELODY SYSTEM (Non-blocking)
+// MELODY SYSTEM (audio.h)
 // ============================================================================
 
-/*
- * playMelody(notes, times, length)
- * --------------------------------
- * Starts playing a melody in the background.
- * Does not block - call updateMelody() in loop.
- */
-void playMelody(const int* notes, const int* times, int len) {
-  melodyNotes = notes;
-  melodyTimes = times;
-  melodyLen = len;
-  melodyIdx = 0;
-  melodyPlaying = true;
-  tNote = millis();
-  
-  if (notes[0] > 0) tone(PIN_BUZZER, notes[0]);
-  else noTone(PIN_BUZZER);
-}
-
-/*
- * updateMelody()
- * --------------
- * Called each loop iteration. Advances melody notes.
- */
-void updateMelody() {
-  if (!melodyPlaying) return;
-  
-  unsigned long now = millis();
-  
-  if (now - tNote >= melodyTimes[melodyIdx]) {
-    melodyIdx++;
-    
-    if (melodyIdx >= melodyLen) {
-      melodyPlaying = false;
-      noTone(PIN_BUZZER);
-      return;
-    }
-    
-    tNote = now;
-    if (melodyNotes[melodyIdx] > 0) {
-      tone(PIN_BUZZER, melodyNotes[melodyIdx]);
-    } else {
-      noTone(PIN_BUZZER);
-    }
-  }
-}
-
 /*
  * playModeTune(m)
  * ---------------
  * Plays the sound effect for switching to mode m.
  */
 void playModeTune(Mode m) {
+  if (!Board::hasBuzzer) return;
   switch (m) {
-    case MODE_SENTRY:     playMelody(SFX_SENTRY, SFX_SENTRY_T, 3); break;
-    case MODE_STEALTH:    playMelody(SFX_STEALTH, SFX_STEALTH_T, 1); break;
-    case MODE_AGGRESSIVE: playMelody(SFX_AGGRO, SFX_AGGRO_T, 5); break;
-    case MODE_PARTY:      playMelody(SFX_PARTY, SFX_PARTY_T, 8); break;
+    case MODE_SENTRY:     audioPlay(SFX_SENTRY, TUNE_LEN(SFX_SENTRY)); break;
+    case MODE_STEALTH:    audioPlay(SFX_STEALTH, TUNE_LEN(SFX_STEALTH)); break;
+    case MODE_AGGRESSIVE: audioPlay(SFX_AGGRO, TUNE_LEN(SFX_AGGRO)); break;
+    case MODE_PARTY:      audioPlay(SFX_PARTY, TUNE_LEN(SFX_PARTY)); break;
   }
 }
 
@@ -564,11 +586,10 @@ void playModeTune(Mode m) {
 // LED HELPERS
 // ============================================================================
 
+// Helpers only stage the frame (leds.h); ledsTick() pushes it
+
 void setLeds(uint8_t r, uint8_t g, uint8_t b) {
-  for (int i = 0; i < NUM_LEDS; i++) {
-    leds.setPixelColor(i, leds.Color(r, g, b));
-  }
-  leds.show();
+  ledsFill(leds.Color(r, g, b));
 }
 
 void ledsOff() {
@@ -576,25 +597,45 @@ void ledsOff() {
 }
 
 void setModeColor(int intensity) {
-  switch (mode) {
-    case MODE_SENTRY:     setLeds(0, intensity, 0); break;
-    case MODE_STEALTH:    setLeds(0, intensity / 3, 0); break;
-    case MODE_AGGRESSIVE: setLeds(intensity, 0, 0); break;
-    case MODE_PARTY:      setLeds(intensity, 0, intensity); break;
-  }
+  MODE_DISPATCH(modeColor, intensity);
+}
+
+template <Mode M>
+void modeColor(int intensity) {
+  if (M == MODE_SENTRY)          setLeds(0, intensity, 0);
+  else if (M == MODE_STEALTH)    setLeds(0, intensity / 3, 0);
+  else if (M == MODE_AGGRESSIVE) setLeds(intensity, 0, 0);
+  else                           setLeds(intensity, 0, intensity);
+}
+
+// Idle pattern while scanning with nothing in range
+template <Mode M>
+void scanIdle() {
+  if (M == MODE_PARTY)        rainbowCycle();
+  else if (M == MODE_STEALTH) setLeds(0, 2, 0);
+  else                        modeColor<M>(8);
 }
 
 /*
  * rainbowCycle()
  * --------------
- * Advances and displays rainbow animation on LEDs.
+ * Advances the rainbow animation frame.
  */
 void rainbowCycle() {
   partyHue = (partyHue + 5) % 256;
   for (int i = 0; i < NUM_LEDS; i++) {
-    leds.setPixelColor(i, colorWheel((partyHue + i * 40) % 256));
+    ledsSet(i, colorWheel((partyHue + i * 40) % 256));
   }
-  leds.show();
+}
+
+/*
+ * ledsTick()
+ * ----------
+ * Every LED_FRAME_MS: pushes the staged frame if it changed, holding it
+ * back while a ping is in flight.
+ */
+void ledsTick() {
+  ledsFlush(!echoBusy);
 }
 
 /*
@@ -664,12 +705,13 @@ void handleButton() {
  * Advances to next mode and plays its tune.
  */
 void cycleMode() {
-  mode = (Mode)((mode + 1) % MODE_COUNT);
+  do {
+    mode = (Mode)((mode + 1) % MODE_COUNT);
+  } while (!MODE_ENABLED(mode));
   applyMode();
   
-  state = STATE_MODE_SWITCH;
+  enterState(STATE_MODE_SWITCH);
   animFrame = 0;
-  tAnim = millis();
   
   playModeTune(mode);
   Serial.print("[MODE] "); Serial.println(MODE_NAMES[mode]);
@@ -681,13 +723,12 @@ void cycleMode() {
  * Sets a specific mode (from web interface).
  */
 void setMode(Mode m) {
-  if (m >= MODE_COUNT) return;
+  if (m >= MODE_COUNT || !MODE_ENABLED(m)) return;
   mode = m;
   applyMode();
   
-  state = STATE_MODE_SWITCH;
+  enterState(STATE_MODE_SWITCH);
   animFrame = 0;
-  tAnim = millis();
   
   playModeTune(mode);
   Serial.print("[MODE] "); Serial.println(MODE_NAMES[mode]);
@@ -696,10 +737,13 @@ void setMode(Mode m) {
 /*
  * applyMode()
  * -----------
- * Updates LED brightness for current mode.
+ * Updates LED brightness, sweep speed and the core's behaviour for
+ * current mode.
  */
 void applyMode() {
-  leds.setBrightness(MODE_PARAMS[mode][1]);
+  ledsBrightness(MODE_PARAMS[mode].bright);
+  radarSetMode(&RADAR_MODES[mode]);
+  radarConfigure(config, MODE_PARAMS[mode].speed, MODE_FAST_MS);
 }
 
 /*
@@ -710,114 +754,74 @@ void applyMode() {
 void toggleScanning() {
   if (scanning) {
     scanning = false;
-    state = STATE_IDLE;
-    centerServos();
-    ledsOff();
-    noTone(PIN_BUZZER);
+    enterState(STATE_IDLE);
+    radarHalt();
     Serial.println("[*] Stopped");
   } else {
     scanning = true;
-    state = STATE_SCANNING;
+    enterState(STATE_SCANNING);
     Serial.println("[*] Scanning...");
   }
   
   // Confirmation beep
-  if (MODE_PARAMS[mode][2]) {
-    tone(PIN_BUZZER, scanning ? 880 : 440, 100);
+  if (MODE_BUZZ(mode)) {
+    audioTone(scanning ? 880 : 440, 100);
   }
 }
 
 // ============================================================================
-// SENSOR & SERVO
+// CONFIGURATION
 // ============================================================================
 
 /*
- * readDistance()
- * --------------
- * Triggers ultrasonic sensor and returns distance in cm.
- * Returns -1 if no echo received (out of range).
+ * loadConfig(c)
+ * -------------
+ * Reads the config blob into c. Without one, migrates the old per-key
+ * layout (or takes the defaults) and stages it as the first blob.
  */
-int readDistance() {
-  digitalWrite(PIN_TRIG, LOW);
-  delayMicroseconds(2);
-  digitalWrite(PIN_TRIG, HIGH);
-  delayMicroseconds(10);
-  digitalWrite(PIN_TRIG, LOW);
+void loadConfig(Config &c) {
+  if (!cfgStoreLoad(prefs, CONFIG_VERSION, &c, sizeof(c))) {
+    c.maxDist  = prefs.getInt("dist", 50);
+    c.lockTime = prefs.getInt("lock", 2000);
+    c.minAngle = prefs.getInt("min", 15);
+    c.maxAngle = prefs.getInt("max", 165);
+    c.samples  = prefs.getInt("samp", 3);
+    saveConfig(c);
+  }
   
-  long duration = pulseIn(PIN_ECHO, HIGH, 25000);
-  if (duration == 0) return -1;
-  return (int)(duration * 0.034 / 2);
-}
-
-void centerServos() {
-  servoScan.write(90);
-  servoArrow.write(90);
-  scanPos = 90;
+  radarConfigValidate(c);
 }
 
-// ============================================================================
-// CONFIGURATION
-// ============================================================================
-
-void loadConfig() {
-  config.maxDist  = prefs.getInt("dist", 50);
-  config.lockTime = prefs.getInt("lock", 2000);
-  config.minAngle = prefs.getInt("min", 15);
-  config.maxAngle = prefs.getInt("max", 165);
-  
-  // Validate
-  if (config.minAngle >= config.maxAngle) {
-    config.minAngle = 15;
-    config.maxAngle = 165;
-  }
+/*
+ * saveConfig(c)
+ * -------------
+ * Stages the config; cfgStorePump() writes it once saves go quiet.
+ */
+void saveConfig(const Config &c) {
+  cfgStoreSave(&c, sizeof(c));
 }
 
-void saveConfig() {
-  prefs.putInt("dist", config.maxDist);
-  prefs.putInt("lock", config.lockTime);
-  prefs.putInt("min", config.minAngle);
-  prefs.putInt("max", config.maxAngle);
+/*
+ * stageConfig(next)
+ * -----------------
+ * Web side: makes next the config, saves it and hands it to the radar
+ * side, which never sees a half-written copy (stageRead()).
+ */
+void stageConfig(const Config &next) {
+  if (next.minAngle != configNext.minAngle || next.maxAngle != configNext.maxAngle) sweepRestart();
+  stageWrite(&configNext, &next, sizeof(next));
+  saveConfig(next);
+  postCommand(CMD_APPLY_CONFIG);
 }
 
-// ============================================================================
-// LOGGING
-// ============================================================================
-
 /*
- * logIntrusion(angle, dist)
- * -------------------------
- * Appends intrusion event to log file with timestamp.
- * Auto-rotates log when it exceeds LOG_MAX_SIZE.
+ * applyConfig()
+ * -------------
+ * Radar side (CMD_APPLY_CONFIG): takes the staged config.
  */
-void logIntrusion(int angle, int dist) {
-  // Check size and rotate if needed
-  if (SPIFFS.exists("/log.txt")) {
-    File f = SPIFFS.open("/log.txt", "r");
-    if (f && f.size() > LOG_MAX_SIZE) {
-      f.close();
-      SPIFFS.remove("/log.txt");
-    } else if (f) {
-      f.close();
-    }
-  }
-  
-  // Write entry
-  File f = SPIFFS.open("/log.txt", FILE_APPEND);
-  if (f) {
-    char buf[80];
-    if (timeSynced) {
-      time_t now;
-      time(&now);
-      struct tm* t = localtime(&now);
-      sprintf(buf, "[%02d:%02d:%02d] %s: %dcm @ %d°\n",
-              t->tm_hour, t->tm_min, t->tm_sec, MODE_NAMES[mode], dist, angle);
-    } else {
-      sprintf(buf, "[%lu] %s: %dcm @ %d°\n",
-              millis() / 1000, MODE_NAMES[mode], dist, angle);
-    }
-    f.print(buf);
-    f.close();
-  }
+void applyConfig() {
+  stageRead(&config, &configNext, sizeof(config));
+  radarConfigure(config, MODE_PARAMS[mode].speed, MODE_FAST_MS);
 }
 
 // ============================================================================
@@ -825,104 +829,63 @@ void logIntrusion(int angle, int dist) {
 // ============================================================================
 
 void setupRoutes() {
-  // Main page
-  server.on("/", []() {
-    server.send(200, "text/html", INDEX_HTML);
-  });
+  assetsBegin(server);
+  radarRoutes(STATE_LOCKED, &configNext.minAngle, &configNext.maxAngle);
   
-  // Status (polled by frontend)
-  server.on("/status", []() {
-    char buf[150];
-    int running = (state == STATE_SCANNING || state == STATE_LOCKED) ? 1 : 0;
-    sprintf(buf, "{\"a\":%d,\"d\":%d,\"r\":%d,\"running\":%d,\"mode\":%d,\"li_a\":%d,\"li_d\":%d}",
-            scanPos, lastDist, config.maxDist, running, mode, lastIntrudeAngle, lastIntrudeDist);
-    server.send(200, "application/json", buf);
-  });
-  
-  // Time sync
-  server.on("/time_sync", []() {
-    if (server.hasArg("ts")) {
-      struct timeval tv;
-      tv.tv_sec = server.arg("ts").toInt();
-      tv.tv_usec = 0;
-      settimeofday(&tv, NULL);
-      timeSynced = true;
-      server.send(200, "text/plain", "OK");
-    } else {
-      server.send(400, "text/plain", "ERR");
-    }
-  });
-  
-  // Logs
-  server.on("/get_logs", []() {
-    if (SPIFFS.exists("/log.txt")) {
-      File f = SPIFFS.open("/log.txt", "r");
-      if (f.size() == 0) {
-        server.send(200, "text/plain", "-- EMPTY --");
-      } else {
-        server.streamFile(f, "text/plain");
-      }
-      f.close();
-    } else {
-      server.send(200, "text/plain", "-- NO DATA --");
-    }
-  });
-  
-  server.on("/clear_logs", []() {
-    SPIFFS.remove("/log.txt");
-    lastIntrudeAngle = 0;
-    lastIntrudeDist = 0;
-    server.send(200, "text/plain", "OK");
+  // Main page (pre-gzipped, ETag-cached)
+  server.on("/", []() {
+    sendAsset(server, V3_INDEX_GZ, V3_INDEX_GZ_LEN, V3_INDEX_ETAG, INDEX_HTML);
   });
   
   // Config
   server.on("/get_config", []() {
-    String json = "{";
-    json += "\"dst\":" + String(config.maxDist) + ",";
-    json += "\"lck\":" + String(config.lockTime) + ",";
-    json += "\"min\":" + String(config.minAngle) + ",";
-    json += "\"max\":" + String(config.maxAngle) + "}";
-    server.send(200, "application/json", json);
+    char buf[96];
+    JsonOut j;
+    jsonBegin(j, buf, sizeof(buf));
+    radarConfigJson(j, configNext);
+    replyJson(server, j);
   });
   
   server.on("/save_config", []() {
-    if (server.hasArg("d"))  config.maxDist = server.arg("d").toInt();
-    if (server.hasArg("l"))  config.lockTime = server.arg("l").toInt();
-    if (server.hasArg("mn")) config.minAngle = server.arg("mn").toInt();
-    if (server.hasArg("mx")) config.maxAngle = server.arg("mx").toInt();
-    
-    if (config.minAngle >= config.maxAngle) {
-      config.minAngle = 15;
-      config.maxAngle = 165;
-    }
-    saveConfig();
-    server.send(200, "text/plain", "OK");
+    Config next = configNext;
+    radarConfigArgs(next);
+    radarConfigValidate(next);
+    stageConfig(next);
+    replyText(server, 200, "OK");
   });
   
   server.on("/reset_config", []() {
-    prefs.clear();
-    loadConfig();
-    server.send(200, "text/plain", "OK");
+    cfgStoreClear();
+    Config next;
+    loadConfig(next);
+    sweepRestart();
+    stageConfig(next);
+    replyText(server, 200, "OK");
   });
   
   // Controls
   server.on("/toggle", []() {
-    toggleScanning();
-    server.send(200, "text/plain", scanning ? "ON" : "OFF");
+    bool wasScanning = scanning;
+    postCommand(CMD_TOGGLE);
+    replyText(server, 200, wasScanning ? "OFF" : "ON");
   });
   
   server.on("/mode", []() {
-    if (server.hasArg("m")) {
-      int m = server.arg("m").toInt();
-      if (m >= 0 && m < MODE_COUNT) {
-        setMode((Mode)m);
+    RadarSnapshot s;
+    snapshotRead(s);
+    int m = s.mode;
+    int req;
+    if (replyArgInt(server, "m", req)) {
+      if (req >= 0 && req < MODE_COUNT && MODE_ENABLED(req)) {
+        m = req;
+        postCommand(CMD_SET_MODE, m);
       }
     }
-    server.send(200, "text/plain", MODE_NAMES[mode]);
+    replyText(server, 200, MODE_NAMES[m]);
   });
   
   // 404
   server.onNotFound([]() {
-    server.send(404, "text/plain", "Not Found");
+    replyText(server, 404, "Not Found");
   });
 }
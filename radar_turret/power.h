@@ -0,0 +1,180 @@
+/*
+ * ============================================================================
+ * RADAR TURRET POWER SAVING
+ * ============================================================================
+ *
+ * Low-power mode for battery-backed units, off unless the sketch asks
+ * for it (powerBegin(true, ...)):
+ *
+ *   clock     the CPU runs at POWER_CPU_MHZ, the lowest the WiFi stack
+ *             allows
+ *   pace      the sweep slows down by POWER_SLOW_FACTOR once the
+ *             background model has seen nothing for POWER_QUIET_MS, and
+ *             runs at the fast step period (MODE_AGGRESSIVE's in v3)
+ *             from the first deviation until the lock ends (radar.h
+ *             sets powerPace)
+ *   radio     with no station on the AP and no mesh (mesh.h) for
+ *             powerRadioIdleMs the AP is parked; a button press brings
+ *             it back (the press still does what it always does)
+ *   sleep     while the radio is parked, loop() light-sleeps between
+ *             jobs instead of delay(): woken by the timer for the next
+ *             job or by the button. The sketch's housekeeping jobs
+ *             (powerRelax()) drop to POWER_PARKED_TICK_MS meanwhile, and
+ *             the sense job stops between steps (radar.h)
+ *
+ * The classic ESP32 drops the AP in light sleep and cannot wake on
+ * WiFi, so the CPU only sleeps with the radio parked. radarIdle()
+ * (radar.h) also keeps it awake while a burst is out, the horn is
+ * moving, a tone plays or a target is locked; the servos get no pulses
+ * while asleep and hold where they are. Without THREADED_MODE only:
+ * the tasks keep delaying as before.
+ *
+ * USAGE:
+ *   powerBegin(POWER_SAVE, PIN_BUTTON, bootWifi);   // setup()
+ *   powerRelax(jobLeds, LED_FRAME_MS);              // setup(), per job
+ *   powerPump(radioNeeded);                         // web side
+ *   powerIdle(ms, sleepable);                       // loop(), via radarIdle()
+ *
+ * ============================================================================
+ */
+
+#ifndef POWER_H
+#define POWER_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include <driver/gpio.h>
+#include "tasks.h"
+#include "boot.h"
+
+#define POWER_CPU_MHZ        80
+#define POWER_QUIET_MS       10000    // Empty scene this long slows the sweep
+#define POWER_SLOW_FACTOR    3        // Step period stretch while slow
+#define POWER_SLEEP_MIN_MS   3        // Shorter idle is not worth a wake-up
+#define POWER_RADIO_IDLE_MS  300000   // AP unused this long is parked
+#define POWER_PARKED_TICK_MS 100      // Housekeeping period while parked
+#define POWER_MAX_JOBS       4
+
+enum PowerPace {
+  PACE_NORMAL,        // The mode's own step period
+  PACE_SLOW,          // Empty scene
+  PACE_FAST           // Deviation seen, until the lock ends
+};
+
+bool powerSave = false;             // Set once in setup()
+uint8_t powerButton = 0;
+void (*powerRadioUp)() = nullptr;   // Brings the AP back (the sketch's bootWifi)
+uint32_t powerRadioIdleMs = POWER_RADIO_IDLE_MS;
+
+volatile uint8_t powerPace = PACE_NORMAL;   // Radar side writes
+volatile bool powerRadioOff = false;        // Web side writes
+unsigned long tPowerRadio = 0;              // Last time the radio was in use
+
+int8_t powerJobs[POWER_MAX_JOBS];   // powerRelax() jobs and their own periods
+uint32_t powerJobMs[POWER_MAX_JOBS];
+uint8_t powerJobCount = 0;
+
+uint64_t powerSleptUs = 0;
+uint32_t powerSleeps = 0;
+uint32_t powerRadioParks = 0;
+
+/*
+ * powerBegin(on, button, radioUp)
+ * -------------------------------
+ * Enables low-power mode. button is the active-low wake pin, radioUp
+ * restarts the AP after it was parked. Call in setup(); does nothing
+ * with on false.
+ */
+void powerBegin(bool on, uint8_t button, void (*radioUp)()) {
+  powerSave = on;
+  powerButton = button;
+  powerRadioUp = radioUp;
+  if (!on) return;
+
+  setCpuFrequencyMhz(POWER_CPU_MHZ);
+  gpio_wakeup_enable((gpio_num_t)button, GPIO_INTR_LOW_LEVEL);
+  esp_sleep_enable_gpio_wakeup();
+  Serial.printf("[+] Low-power mode, CPU at %d MHz\n", POWER_CPU_MHZ);
+}
+
+// sched.h includes metrics.h, which reports the counters above
+void schedPeriod(int8_t id, uint32_t periodMs);
+
+/*
+ * powerRelax(id, periodMs)
+ * ------------------------
+ * Registers a periodic sched job (LEDs, control tick) and its own
+ * period; it runs every POWER_PARKED_TICK_MS while the radio is parked.
+ */
+void powerRelax(int8_t id, uint32_t periodMs) {
+  if (id < 0 || powerJobCount >= POWER_MAX_JOBS) return;
+  powerJobs[powerJobCount] = id;
+  powerJobMs[powerJobCount++] = periodMs;
+}
+
+// powerRelax() jobs at their parked or own period
+static void powerStretch(bool parked) {
+  for (uint8_t i = 0; i < powerJobCount; i++) {
+    uint32_t ms = powerJobMs[i];
+    schedPeriod(powerJobs[i], parked ? max(ms, (uint32_t)POWER_PARKED_TICK_MS) : ms);
+  }
+}
+
+/*
+ * powerPump(radioNeeded)
+ * ----------------------
+ * Web side: parks the AP once nothing has used the radio for
+ * powerRadioIdleMs, and brings it back while the button is held.
+ * radioNeeded keeps it up for other users (the mesh).
+ */
+void powerPump(bool radioNeeded) {
+  if (!powerSave || !bootComplete) return;
+  unsigned long now = millis();
+
+  if (powerRadioOff) {
+    if (digitalRead(powerButton) != LOW) return;
+    powerRadioOff = false;
+    powerStretch(false);
+    tPowerRadio = now;
+    if (powerRadioUp) powerRadioUp();
+    Serial.println("[+] Radio back up");
+    return;
+  }
+
+  if (radioNeeded || WiFi.softAPgetStationNum() > 0) {
+    tPowerRadio = now;
+    return;
+  }
+  if (now - tPowerRadio < powerRadioIdleMs) return;
+
+  WiFi.softAPdisconnect(true);
+  WiFi.mode(WIFI_OFF);
+  powerRadioOff = true;
+  powerStretch(true);
+  powerRadioParks++;
+  Serial.println("[*] Radio parked, press the button to bring it back");
+}
+
+/*
+ * powerIdle(ms, sleepable)
+ * ------------------------
+ * What loop() does with ms of idle time: light sleep if low-power mode
+ * has the radio parked and the caller says nothing is in flight,
+ * otherwise the usual delay (at most LOOP_WEB_POLL_MS).
+ */
+void powerIdle(uint32_t ms, bool sleepable) {
+  if (!powerSave || !powerRadioOff || !sleepable || ms < POWER_SLEEP_MIN_MS) {
+    delay(min(ms, (uint32_t)LOOP_WEB_POLL_MS));
+    return;
+  }
+
+  int64_t start = esp_timer_get_time();
+  esp_sleep_enable_timer_wakeup((uint64_t)ms * 1000);
+  esp_light_sleep_start();
+  powerSleptUs += esp_timer_get_time() - start;
+  powerSleeps++;
+}
+
+#endif // POWER_H
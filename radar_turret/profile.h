@@ -0,0 +1,88 @@
+/*
+ * ============================================================================
+ * RADAR TURRET BOARD PROFILES
+ * ============================================================================
+ *
+ * One struct per hardware variant, all constexpr, selected at build time
+ * with TURRET_PROFILE (e.g. -DTURRET_PROFILE=PROFILE_MINI). Sketches read
+ * Board:: instead of their own pin #defines, so code behind a feature a
+ * board lacks (buzzer, modes) folds away instead of being tested at run
+ * time.
+ *
+ *   pin*        GPIO assignment
+ *   numLeds     NeoPixels fitted (at most LED_MAX_PIXELS)
+ *   hasBuzzer   false drops every tone and tune
+ *   modes       MODE_BIT mask of the operating modes offered (new.ino)
+ *   defaultMode mode at boot, must be in modes
+ *   logMaxSize  SPIFFS budget for the intrusion log (eventlog.h)
+ *
+ * Only the HC-SR04 driver exists (echo.h), so the sensor is selected by
+ * its pins.
+ *
+ * ============================================================================
+ */
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <Arduino.h>
+
+#define PROFILE_DEVKIT   1    // Reference build: 3 LEDs, buzzer, all modes
+#define PROFILE_MINI     2    // Single LED, no buzzer, quiet modes only
+#define PROFILE_RING     3    // 8-LED ring, larger log
+
+#ifndef TURRET_PROFILE
+#define TURRET_PROFILE   PROFILE_DEVKIT
+#endif
+
+// Bit positions follow enum Mode in new.ino
+#define MODE_BIT(m)      (1u << (m))
+#define MODES_ALL        0x0Fu
+
+struct ProfileDevKit {
+  static constexpr uint8_t pinTrig = 5;
+  static constexpr uint8_t pinEcho = 35;
+  static constexpr uint8_t pinServoScan = 19;
+  static constexpr uint8_t pinServoArrow = 18;
+  static constexpr uint8_t pinNeopixel = 26;
+  static constexpr uint8_t pinBuzzer = 23;
+  static constexpr uint8_t pinButton = 27;
+  static constexpr uint8_t numLeds = 3;
+  static constexpr bool hasBuzzer = true;
+  static constexpr uint8_t modes = MODES_ALL;
+  static constexpr uint8_t defaultMode = 0;        // SENTRY
+  static constexpr uint32_t logMaxSize = 50000;
+  static constexpr uint32_t traceSize = 131072;    // ~5 min of readings
+};
+
+struct ProfileMini : ProfileDevKit {
+  static constexpr uint8_t numLeds = 1;
+  static constexpr bool hasBuzzer = false;
+  static constexpr uint8_t modes = MODE_BIT(0) | MODE_BIT(1);   // SENTRY, STEALTH
+  static constexpr uint32_t logMaxSize = 20000;
+  static constexpr uint32_t traceSize = 65536;
+};
+
+struct ProfileRing : ProfileDevKit {
+  static constexpr uint8_t numLeds = 8;
+  static constexpr uint32_t logMaxSize = 100000;
+  static constexpr uint32_t traceSize = 262144;
+};
+
+#if TURRET_PROFILE == PROFILE_DEVKIT
+typedef ProfileDevKit Board;
+#elif TURRET_PROFILE == PROFILE_MINI
+typedef ProfileMini Board;
+#elif TURRET_PROFILE == PROFILE_RING
+typedef ProfileRing Board;
+#else
+#error "Unknown TURRET_PROFILE"
+#endif
+
+static_assert(Board::modes & MODE_BIT(Board::defaultMode), "defaultMode not in modes");
+
+// eventlog.h and trace.h pick these up in place of their own defaults
+#define LOG_MAX_SIZE     (Board::logMaxSize)
+#define TRACE_FILE_SIZE  (Board::traceSize)
+
+#endif // PROFILE_H
@@ -0,0 +1,695 @@
+/*
+ * ============================================================================
+ * RADAR TURRET CORE
+ * ============================================================================
+ *
+ * The radar hot path and the web plumbing shared by both sketches. v2
+ * (radar_turret.ino) and v3 (new.ino) keep only their state machine,
+ * config layout, LED/buzzer behaviour and UI; everything a performance
+ * fix is likely to touch lives here once:
+ *
+ *   radar side:  sense (1ms)    echo bursts (or trace replay), background,
+ *                               tracker, log, trace capture
+ *                step (ms/deg)  scan servo, sweep boundaries, pace
+ *                lock (20ms)    track expiry, mode alert
+ *                radarIdle()    loop()'s sleep between jobs (power.h)
+ *   web side:    webStep()      boot stages, server, streams, log, trace,
+ *                               mesh, radio, config
+ *                radarRoutes()  status, frames, sweep, time, logs, trace,
+ *                               mesh, metrics
+ *
+ * SKETCH SUPPLIES:
+ *   RadarMode      what the current mode does with a quiet reading and
+ *                  with a live track; selected at run time with
+ *                  radarSetMode() (v2 has one, v3 one per Mode)
+ *   radarConfigure() the sweep geometry and step period from its Config,
+ *                  on the radar side (CMD_APPLY_CONFIG, mode changes),
+ *                  and the fast period low-power mode uses on a target
+ *   onLock         called when a lock starts and ends, so the sketch's
+ *                  state machine follows; it must call radarRun() from
+ *                  its state changes
+ *
+ * Both Config structs carry maxDist, lockTime, minAngle, maxAngle and
+ * samples under the same names, so the helpers that parse, validate and
+ * report those fields are templates over the sketch's Config.
+ *
+ * ============================================================================
+ */
+
+#ifndef RADAR_H
+#define RADAR_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+#include <ESP32Servo.h>
+#include <time.h>
+#include <sys/time.h>
+#include "tasks.h"
+#include "echo.h"
+#include "background.h"
+#include "motion.h"
+#include "tracks.h"
+#include "frame.h"
+#include "eventlog.h"
+#include "trace.h"
+#include "mesh.h"
+#include "telemetry.h"
+#include "xfer.h"
+#include "metrics.h"
+#include "sched.h"
+#include "leds.h"
+#include "audio.h"
+#include "configstore.h"
+#include "reply.h"
+#include "boot.h"
+#include "power.h"
+
+#define RADAR_SENSE_MS    1
+#define RADAR_LOCK_MS     20
+#define RADAR_FAST_STEP_MS 10       // Low-power fast pace (v3's MODE_AGGRESSIVE)
+
+struct RadarMode {
+  const char *name;
+  uint8_t logMode;            // Tag for eventlog.h, LOG_NO_MODE for none
+  void (*idle)();             // Reading with nothing in range while scanning
+  void (*alert)(int dist);    // Every lock tick while a track is alive
+};
+
+struct RadarParams {
+  int minAngle;
+  int maxAngle;
+  int maxDist;
+  int lockTime;
+  int samples;
+  uint16_t stepMs;            // Sweep step period
+  uint16_t fastMs;            // ... on a target in low-power mode (power.h)
+};
+
+WebServer server(80);
+
+// Radar side only, set through radarConfigure() / radarSetMode()
+RadarParams radarParams = { 15, 165, 50, 2000, 3, 20, RADAR_FAST_STEP_MS };
+const RadarMode *radarMode = nullptr;
+void (*radarOnLock)(bool locked) = nullptr;
+
+Servo *radarScanServo = nullptr;
+Servo *radarArrowServo = nullptr;
+int8_t jobSense, jobStep, jobLock;
+
+bool radarSweeping = false;
+bool radarLocked = false;
+
+// Radar position
+int scanPos = 90;           // Current servo angle
+int scanDir = 1;            // Sweep direction (+1 or -1)
+int pingAngle = 90;         // Where the ping in flight is recorded (motion.h)
+int arrowPos = 90;          // Last angle written to the arrow
+int lastDist = 0;           // Last distance reading
+
+// Primary track, mirrored for the UI
+int lastIntrudeAngle = 0;
+int lastIntrudeDist = 0;
+
+unsigned long tScan = 0;    // Last scan step time (lateness metric)
+bool timeSynced = false;    // Web side sets it, log records carry it
+
+// Step period for the current pace
+static uint16_t radarStepMs() {
+  switch (powerPace) {
+    case PACE_SLOW: return radarParams.stepMs * POWER_SLOW_FACTOR;
+    case PACE_FAST: return radarParams.fastMs;
+    default:        return radarParams.stepMs;
+  }
+}
+
+static void radarPace(uint8_t pace) {
+  if (pace == powerPace) return;
+  powerPace = pace;
+  schedPeriod(jobStep, radarStepMs());
+}
+
+static void radarLock(bool on) {
+  if (on == radarLocked) return;
+  radarLocked = on;
+  if (on) {
+    schedStart(jobLock);
+  } else {
+    schedStop(jobLock);
+    ledsFill(0);
+    audioTone(0);
+    radarPace(PACE_NORMAL);
+  }
+  if (radarOnLock) radarOnLock(on);
+}
+
+// Glides the arrow towards the primary track's predicted angle, or back
+// to center with no track (rate limited, see tracks.h), and mirrors the
+// track into lastIntrude* for the UI
+static void radarAim() {
+  int a = arrowStep(millis());
+  if (a != arrowPos) {
+    radarArrowServo->write(a);
+    arrowPos = a;
+  }
+
+  int p = trackPrimary();
+  if (p < 0) return;
+  lastIntrudeAngle = constrain((int)(tracks[p].angle + 0.5f), 0, 180);
+  lastIntrudeDist = (int)(tracks[p].dist + 0.5f);
+}
+
+// Runs one reading at pingAngle through the background model, sweep
+// map, trace, tracker and log; locks on a target
+static void radarReading(int dist) {
+  lastDist = dist;
+  bool hit = bgCheck(pingAngle, dist, radarParams.maxDist);
+  sweepRecord(pingAngle, dist, hit);
+  traceRecord(pingAngle, dist, hit);
+
+  if (hit) {
+    if (powerSave) radarPace(PACE_FAST);
+    // Only a new track is a new intrusion
+    if (trackUpdate(pingAngle, dist, millis())) {
+      uint8_t mode = radarMode->logMode | (traceReplaying ? LOGF_REPLAY : 0);
+      logEvent(pingAngle, dist, mode, timeSynced);
+    }
+    radarLock(true);
+  } else if (!radarLocked) {
+    if (radarMode->idle) radarMode->idle();
+    audioTone(0);
+  }
+}
+
+// Trace replay (trace.h): the next due reading comes from the file and
+// the horn follows its angle; a turn ends the sweep like a live one
+static void radarReplay() {
+  if (echoBurstActive()) echoCancel();
+
+  int angle, dist;
+  if (!traceReplayNext(angle, dist)) return;
+
+  if ((angle - scanPos) * scanDir < 0) {
+    scanDir = -scanDir;
+    sweepNext();
+  }
+  scanPos = angle;
+  pingAngle = angle;
+  radarScanServo->write(angle);
+  motionMove(angle, false);
+  radarReading(dist);
+}
+
+/*
+ * radarSense()
+ * ------------
+ * Every RADAR_SENSE_MS while sweeping:
+ *   1. Picks up the burst median when it is in (never blocks), or the
+ *      next replayed reading (trace.h)
+ *   2. If the reading deviates from the background model
+ *      (background.h), feeds the tracker (tracks.h), logs a new track
+ *      and locks
+ *   3. Fires the next burst (echo.h) once the horn has arrived
+ *      (motion.h)
+ *   4. Steers the arrow
+ * In low-power mode it stops itself once nothing is left to do before
+ * the next step (radarAdvance() restarts it), so loop() can sleep.
+ */
+void radarSense() {
+  if (traceReplaying) {
+    radarReplay();
+    radarAim();
+    return;
+  }
+
+  int dist;
+  EchoStatus echo = echoBurstPoll(dist);
+
+  if (echo == ECHO_READY) {
+    radarReading(dist);
+  } else if (echo == ECHO_PENDING && echoCount == 1 && pingAngle != motionTo) {
+    // A burst fired on the move wants confirming, but its next pings
+    // land after arrival: confirm at the target instead
+    echoBurstRestart();
+    pingAngle = motionTo;
+  } else if (echo == ECHO_IDLE && motionPingReady(pingAngle)) {
+    // Fire the burst as soon as the horn is where it will be recorded.
+    // Near the last intrusion use every ping we can and retry misses too.
+    bool focus = lastIntrudeDist > 0 &&
+                 abs(pingAngle - lastIntrudeAngle) <= ECHO_FOCUS_DEG;
+    echoBurstStart(focus ? ECHO_BURST_MAX : radarParams.samples, radarParams.maxDist, focus);
+  }
+
+  radarAim();
+
+  if (powerSave && !radarLocked && !motionPingDue && !echoBurstActive() && arrowSettled) {
+    schedStop(jobSense);
+  }
+}
+
+/*
+ * radarAdvance()
+ * --------------
+ * Every step period while sweeping (radarParams.stepMs, or the pace's
+ * in low-power mode): advances the scan servo, or retries in 1ms if the
+ * last step's reading is not in yet. Idle while a trace replay moves the
+ * servo instead.
+ */
+void radarAdvance() {
+  if (traceReplaying) return;
+  if (echoBurstActive() || motionPingDue) {
+    schedStart(jobStep, 1);
+    return;
+  }
+
+  unsigned long now = millis();
+  metricStep(now - tScan, radarStepMs());
+  tScan = now;
+
+  // Coarse across quiet sectors, see background.h
+  scanPos += scanDir * bgStride(scanPos, scanDir);
+  bool turn = false;
+  if (scanPos >= radarParams.maxAngle) { scanPos = radarParams.maxAngle; scanDir = -1; turn = true; }
+  if (scanPos <= radarParams.minAngle) { scanPos = radarParams.minAngle; scanDir = 1; turn = true; }
+  if (turn) {
+    sweepNext();
+    // Low-power mode slows down over an empty scene (power.h)
+    if (powerSave && !radarLocked &&
+        bgQuiet(radarParams.minAngle, radarParams.maxAngle, POWER_QUIET_MS)) {
+      radarPace(PACE_SLOW);
+    }
+  }
+  radarScanServo->write(scanPos);
+  motionMove(scanPos);
+  // Low-power mode stopped the sense job after the last reading; back on
+  // its usual cadence so the ping timing matches normal mode
+  if (powerSave) schedStart(jobSense, RADAR_SENSE_MS);
+}
+
+/*
+ * radarHold()
+ * -----------
+ * Every RADAR_LOCK_MS while locked. The sweep keeps running so other
+ * targets are still seen; the mode's alert runs while any track is
+ * alive, and the lock ends once none has been seen for the lock time.
+ */
+void radarHold() {
+  if (trackExpire(millis(), radarParams.lockTime) > 0) {
+    if (radarMode->alert) radarMode->alert(lastIntrudeDist);
+  } else {
+    radarLock(false);   // Arrow glides back to center (radarAim)
+  }
+}
+
+/*
+ * radarBegin(scan, arrow, mode, onLock)
+ * -------------------------------------
+ * Registers the radar jobs (stopped until radarRun()). Call once the
+ * servos are attached.
+ */
+void radarBegin(Servo &scan, Servo &arrow, const RadarMode *mode, void (*onLock)(bool)) {
+  radarScanServo = &scan;
+  radarArrowServo = &arrow;
+  radarMode = mode;
+  radarOnLock = onLock;
+
+  jobSense = schedAdd(radarSense, RADAR_SENSE_MS);
+  jobStep  = schedAdd(radarAdvance, radarParams.stepMs);
+  jobLock  = schedAdd(radarHold, RADAR_LOCK_MS);
+}
+
+/*
+ * radarRun(sweeping)
+ * ------------------
+ * Starts or stops the sweep jobs. Stopping also drops the lock (without
+ * calling onLock: the sketch is already changing state). Radar side.
+ */
+void radarRun(bool sweeping) {
+  if (sweeping == radarSweeping) return;
+  radarSweeping = sweeping;
+  if (sweeping) {
+    schedStart(jobSense);
+    schedStart(jobStep);
+  } else {
+    schedStop(jobSense);
+    schedStop(jobStep);
+    schedStop(jobLock);
+    radarLocked = false;
+  }
+}
+
+/*
+ * radarSetMode(mode)
+ * ------------------
+ * Switches the quiet/alert behaviour. Radar side.
+ */
+void radarSetMode(const RadarMode *mode) {
+  radarMode = mode;
+}
+
+/*
+ * radarConfigure(c, stepMs, fastMs)
+ * ---------------------------------
+ * Copies the sweep fields of the sketch's Config for the radar side and
+ * sets the step period, and the one low-power mode switches to on a
+ * target (never slower than stepMs). Radar side (CMD_APPLY_CONFIG); the
+ * web side never touches radarParams.
+ */
+template <class C>
+void radarConfigure(const C &c, uint16_t stepMs, uint16_t fastMs = RADAR_FAST_STEP_MS) {
+  radarParams.minAngle = c.minAngle;
+  radarParams.maxAngle = c.maxAngle;
+  radarParams.maxDist  = c.maxDist;
+  radarParams.lockTime = c.lockTime;
+  radarParams.samples  = c.samples;
+  radarParams.stepMs   = stepMs;
+  radarParams.fastMs   = min(fastMs, stepMs);
+  schedPeriod(jobStep, radarStepMs());
+}
+
+/*
+ * radarCenter()
+ * -------------
+ * Centers both servos; the horn is settled before the next ping.
+ */
+void radarCenter() {
+  radarScanServo->write(90);
+  motionMove(90, false);
+  radarArrowServo->write(90);
+  arrowPos = 90;
+  arrowReset(90);
+  scanPos = 90;
+}
+
+/*
+ * radarHalt()
+ * -----------
+ * Cleanup when scanning stops: drops the ping in flight and the tracks,
+ * flushes the log soon, centers and goes dark and silent. The sketch
+ * has already left the sweeping states.
+ */
+void radarHalt() {
+  echoCancel();
+  trackClear();
+  logFlushSoon();
+  radarCenter();
+  ledsFill(0);
+  audioStop();
+}
+
+/*
+ * radarClearIntrusion()
+ * ---------------------
+ * Forgets the last intrusion and every track (CMD_CLEAR_INTRUSION).
+ */
+void radarClearIntrusion() {
+  lastIntrudeAngle = 0;
+  lastIntrudeDist = 0;
+  trackClear();
+}
+
+/*
+ * radarReplayStart()
+ * ------------------
+ * Starts a trace replay from a fresh background model and no tracks,
+ * like a boot (CMD_TRACE_REPLAY, after traceReplayBegin()).
+ */
+void radarReplayStart() {
+  bgReset();
+  radarClearIntrusion();
+  traceReplayArm();
+}
+
+/*
+ * radarPublish(state, mode)
+ * -------------------------
+ * Copies the values the web side needs into the shared snapshot, and
+ * the tracks for the mesh (mesh.h).
+ */
+void radarPublish(int state, int mode) {
+  RadarSnapshot s;
+  s.angle   = scanPos;
+  s.dist    = lastDist;
+  s.range   = radarParams.maxDist;
+  s.state   = state;
+  s.mode    = mode;
+  s.running = radarSweeping ? 1 : 0;
+  s.liAngle = lastIntrudeAngle;
+  s.liDist  = lastIntrudeDist;
+  s.sweep   = sweepId;
+  snapshotPublish(s);
+  meshPublish();
+}
+
+// ============================================================================
+// LOOP STEPS
+// ============================================================================
+
+/*
+ * radarStep()
+ * -----------
+ * One pass of the radar side: runs due jobs. Returns how many ms the
+ * caller may sleep.
+ */
+uint32_t radarStep() {
+  METRIC_SCOPE(M_RADAR);
+  metricLoop(LOOP_RADAR);
+  return schedRun();
+}
+
+/*
+ * radarIdle(ms)
+ * -------------
+ * Sleeps off idle time from loop() (power.h): light sleep is only
+ * allowed with no burst out, the horn still, no tone and no lock.
+ */
+void radarIdle(uint32_t ms) {
+  bool still = !echoBusy && !echoBurstActive() && !motionPingDue;
+  powerIdle(ms, still && !radarLocked && !audioPlaying() && audioAlertHz == 0);
+}
+
+/*
+ * webStep()
+ * ---------
+ * One pass of the web side.
+ */
+void webStep() {
+  metricLoop(LOOP_WEB);
+  if (!bootPump()) return;    // Still bringing up fs, AP, server
+  {
+    METRIC_SCOPE(M_HTTP);
+    server.handleClient();
+  }
+  telemetryPump();
+  xferPump();
+  logPump();
+  tracePump();
+  meshPump();
+  powerPump(meshUp);
+  cfgStorePump();
+}
+
+// ============================================================================
+// CONFIG FIELDS
+// ============================================================================
+
+/*
+ * radarConfigArgs(c)
+ * ------------------
+ * Reads the shared fields from the query (d, l, mn, mx, sm).
+ */
+template <class C>
+void radarConfigArgs(C &c) {
+  replyArgInt(server, "d",  c.maxDist);
+  replyArgInt(server, "l",  c.lockTime);
+  replyArgInt(server, "mn", c.minAngle);
+  replyArgInt(server, "mx", c.maxAngle);
+  replyArgInt(server, "sm", c.samples);
+}
+
+/*
+ * radarConfigValidate(c)
+ * ----------------------
+ * Resets impossible angles and clamps the shared fields.
+ */
+template <class C>
+void radarConfigValidate(C &c) {
+  if (c.minAngle >= c.maxAngle) {
+    c.minAngle = 15;
+    c.maxAngle = 165;
+    Serial.println("[!] Invalid angles, reset to defaults");
+  }
+  c.maxDist  = constrain(c.maxDist, 10, 200);
+  c.lockTime = constrain(c.lockTime, 500, 5000);
+  c.minAngle = constrain(c.minAngle, 0, 80);
+  c.maxAngle = constrain(c.maxAngle, 100, 180);
+  c.samples  = constrain(c.samples, 1, ECHO_BURST_MAX);
+}
+
+/*
+ * radarConfigJson(j, c)
+ * ---------------------
+ * Writes the shared fields for /get_config (dst, lck, min, max, smp).
+ */
+template <class C>
+void radarConfigJson(JsonOut &j, const C &c) {
+  jsonInt(j, "dst", c.maxDist);
+  jsonInt(j, "lck", c.lockTime);
+  jsonInt(j, "min", c.minAngle);
+  jsonInt(j, "max", c.maxAngle);
+  jsonInt(j, "smp", c.samples);
+}
+
+// ============================================================================
+// SHARED ROUTES
+// ============================================================================
+
+static void radarHandleStatus() {
+  char buf[150];
+  RadarSnapshot s;
+  snapshotRead(s);
+
+  JsonOut j;
+  jsonBegin(j, buf, sizeof(buf));
+  jsonInt(j, "a", s.angle);
+  jsonInt(j, "d", s.dist);
+  jsonInt(j, "r", s.range);
+  jsonInt(j, "running", s.running);
+  jsonInt(j, "mode", s.mode);
+  jsonInt(j, "li_a", s.liAngle);
+  jsonInt(j, "li_d", s.liDist);
+  jsonUInt(j, "sw", s.sweep);
+  replyJson(server, j);
+}
+
+static void radarHandleTimeSync() {
+  int ts;
+  if (replyArgInt(server, "ts", ts)) {
+    struct timeval tv;
+    tv.tv_sec = ts;
+    tv.tv_usec = 0;
+    settimeofday(&tv, NULL);
+    timeSynced = true;
+    Serial.println("[+] Time synced");
+    replyText(server, 200, "OK");
+  } else {
+    replyText(server, 400, "Bad Request");
+  }
+}
+
+static void radarHandleTraceStatus() {
+  char buf[96];
+  JsonOut j;
+  jsonBegin(j, buf, sizeof(buf));
+  jsonInt(j, "cap", traceCapturing ? 1 : 0);
+  jsonInt(j, "rep", traceReplaying ? 1 : 0);
+  jsonUInt(j, "n", traceCount());
+  jsonUInt(j, "max", TRACE_RECS);
+  jsonUInt(j, "drop", traceDropped);
+  replyJson(server, j);
+}
+
+/*
+ * radarRoutes(lockedState, minAngle, maxAngle)
+ * --------------------------------------------
+ * Registers the routes both sketches serve the same way:
+ *   /status /events /frame /sweep /time_sync /get_logs /clear_logs
+ *   /center /relearn /trace_start /trace_stop /trace_replay
+ *   /trace_status /get_trace /mesh /mesh_config /metrics
+ * lockedState is the sketch's LOCKED state value (for frame flags);
+ * minAngle/maxAngle point at its config's sweep range (web side copy).
+ */
+void radarRoutes(int lockedState, const int *minAngle, const int *maxAngle) {
+  static int locked;
+  static const int *mn;
+  static const int *mx;
+  locked = lockedState;
+  mn = minAngle;
+  mx = maxAngle;
+
+  // Polling fallback for browsers without EventSource
+  server.on("/status", radarHandleStatus);
+
+  // Live stream, one frame per sweep step
+  server.on("/events", []() { telemetrySubscribe(server); });
+
+  // Binary equivalent of /status (see frame.h)
+  server.on("/frame", []() {
+    uint8_t buf[32];
+    RadarSnapshot s;
+    snapshotRead(s);
+    size_t len = frameStatus(buf, s, s.state == locked);
+    server.send_P(200, "application/octet-stream", (const char*)buf, len);
+  });
+
+  // Latest reading for every degree of the sweep, or ?since=<sweep ID>
+  // for only the degrees that changed
+  server.on("/sweep", []() {
+    static uint8_t buf[sizeof(FrameHeader) + ANGLE_CELLS * sizeof(FramePoint)];
+    int since = -1;
+    replyArgInt(server, "since", since);
+    size_t len = frameSweep(buf, *mn, *mx, since);
+    server.send_P(200, "application/octet-stream", (const char*)buf, len);
+  });
+
+  server.on("/time_sync", radarHandleTimeSync);
+
+  // Binary LogRecords by default, ?fmt=txt for text (see eventlog.h)
+  server.on("/get_logs", []() {
+    LogQuery q;
+    logParseQuery(server, q);
+    logQuery(server, q);
+  });
+
+  server.on("/clear_logs", []() {
+    logWipe();
+    postCommand(CMD_CLEAR_INTRUSION);
+    Serial.println("[!] Logs cleared");
+    replyText(server, 200, "CLEARED");
+  });
+
+  server.on("/center", []() {
+    postCommand(CMD_CENTER);
+    replyText(server, 200, "CENTERED");
+  });
+
+  server.on("/relearn", []() {
+    postCommand(CMD_RELEARN);
+    replyText(server, 200, "RELEARNING");
+  });
+
+  // Raw sensor capture and replay (see trace.h)
+  server.on("/trace_start", []() {
+    if (traceStart()) replyText(server, 200, "CAPTURING");
+    else replyText(server, 507, "NO SPACE");
+  });
+
+  server.on("/trace_stop", []() {
+    traceStop();
+    replyText(server, 200, "STOPPED");
+  });
+
+  // The file is rewound here, the pipeline reset on the radar side
+  server.on("/trace_replay", []() {
+    if (!traceReplayBegin()) {
+      replyText(server, 409, "EMPTY");
+      return;
+    }
+    postCommand(CMD_TRACE_REPLAY);
+    replyText(server, 200, "REPLAYING");
+  });
+
+  server.on("/trace_status", radarHandleTraceStatus);
+
+  // Binary TraceSamples by default, ?fmt=csv for text lines
+  server.on("/get_trace", []() {
+    traceDownload(server, replyArgIs(server, "fmt", "csv"));
+  });
+
+  // Fused view and this turret's place in it (see mesh.h)
+  server.on("/mesh", []() { meshHandleStatus(server); });
+  server.on("/mesh_config", []() { meshHandleConfig(server); });
+
+  server.on("/metrics", []() { metricsHandle(server); });
+}
+
+#endif // RADAR_H
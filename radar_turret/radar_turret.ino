@@ -26,24 +26,29 @@
 #include <Preferences.h>
 #include <time.h>
 
+#include "profile.h" // Board variant (pins, LEDs, buzzer)
+#include "radar.h"  // Shared core: sweep, tracking, log, web plumbing
+#include "assets.h" // Gzipped dashboard (web_gz.h)
+
 // ============================================================================
-// PIN DEFINITIONS
+// PIN DEFINITIONS (profile.h)
 // ============================================================================
-#define TRIG_PIN        5
-#define ECHO_PIN        35
-#define SERVO_SCAN_PIN  19
-#define SERVO_ARROW_PIN 18
-#define NEOPIXEL_PIN    26
-#define BUZZER_PIN      23
-#define BUTTON_PIN      27
+#define TRIG_PIN        Board::pinTrig
+#define ECHO_PIN        Board::pinEcho
+#define SERVO_SCAN_PIN  Board::pinServoScan
+#define SERVO_ARROW_PIN Board::pinServoArrow
+#define NEOPIXEL_PIN    Board::pinNeopixel
+#define BUZZER_PIN      Board::pinBuzzer
+#define BUTTON_PIN      Board::pinButton
 
 // ============================================================================
 // CONSTANTS
 // ============================================================================
-#define NUM_PIXELS      3
-#define LOG_MAX_SIZE    50000   // 50KB max log size
+#define NUM_PIXELS      Board::numLeds
 #define DEBOUNCE_MS     50
 #define ANIM_FRAME_MS   80
+#define THREADED_MODE   0       // 1 = radar on core 1, web server on core 0
+#define POWER_SAVE      0       // 1 = low-power mode for battery units (power.h)
 
 // ============================================================================
 // OBJECTS
@@ -51,12 +56,13 @@
 Servo scanServo;
 Servo arrowServo;
 Adafruit_NeoPixel strip(NUM_PIXELS, NEOPIXEL_PIN, NEO_GRB + NEO_KHZ800);
-WebServer server(80);
 Preferences preferences;
 
 // ============================================================================
 // CONFIGURATION (with defaults)
 // ============================================================================
+#define CONFIG_VERSION  1   // Bump when Config changes (configstore.h)
+
 struct Config {
   int scanSpeed   = 20;     // Delay in ms per degree
   int maxDist     = 50;     // Max detection range cm
@@ -64,8 +70,14 @@ struct Config {
   int ledBright   = 50;     // 0-255
   int minAngle    = 15;     // Sweep start
   int maxAngle    = 165;    // Sweep end
+  int samples     = 3;      // Max pings per step (median)
   bool buzzerOn   = true;
-} cfg;
+} cfg;                      // Radar side once running
+
+Config cfgNext;             // Web side's copy, staged for CMD_APPLY_CONFIG (tasks.h)
+
+// Constant false on boards without a buzzer (profile.h)
+#define BUZZER_ON       (Board::hasBuzzer && cfg.buzzerOn)
 
 // ============================================================================
 // STATE MACHINE
@@ -83,23 +95,22 @@ SystemState currentState = STATE_IDLE;
 // ============================================================================
 // STATE VARIABLES
 // ============================================================================
-int scanPos = 90;
-int scanDirection = 1;
-int lastDistance = 0;
-int lastIntrusionAngle = 0;
-int lastIntrusionDist = 0;
+// Sweep position, readings and intrusions live in the core (radar.h)
 
 // Timing (non-blocking)
-unsigned long lastScanTime = 0;
-unsigned long lockOnStartTime = 0;
-unsigned long animStartTime = 0;
 unsigned long lastButtonTime = 0;
 unsigned long lastTimeSyncAttempt = 0;
 
 // Flags
-bool timeSynced = false;
 int animFrame = 0;
-int lastArrowPos = 90;
+
+// Scheduler jobs (sched.h); the sweep jobs belong to radar.h
+int8_t jobControl, jobAnim, jobLeds;
+
+// The one v2 behaviour for the core: dim green when quiet, distance alert
+void ledIdle();
+void runAlert(int dist);
+const RadarMode CLASSIC_MODE = { "CLASSIC", LOG_NO_MODE, ledIdle, runAlert };
 
 // ============================================================================
 // WIFI CONFIG
@@ -281,6 +292,16 @@ const char index_html[] PROGMEM = R"rawliteral(
         </div>
       </div>
       
+      <div class="setting">
+        <label>PINGS / STEP</label>
+        <div class="ctrl">
+          <button class="adj-btn" onclick="adj('cfg-samp', -1)">-</button>
+          <input type="range" id="cfg-samp" min="1" max="5">
+          <button class="adj-btn" onclick="adj('cfg-samp', 1)">+</button>
+          <span id="val-samp" class="val"></span>
+        </div>
+      </div>
+      
       <div class="setting">
         <label>BUZZER</label>
         <div class="ctrl"><input type="checkbox" id="cfg-bz" style="width:20px; height:20px; flex:0;"></div>
@@ -302,6 +323,9 @@ const char index_html[] PROGMEM = R"rawliteral(
   let isRunning = false;
   let isOffline = true;
   let reconnectAttempts = 0;
+  let lastFrame = 0, lastDraw = 0;
+  let sweepId = -1;
+  let cells = [], sweepBase = -1;  // Per-degree table patched by deltas
   
   function resize() {
     const box = document.getElementById('radar-box');
@@ -317,57 +341,118 @@ const char index_html[] PROGMEM = R"rawliteral(
   }
   syncTime();
 
-  resize(); draw({a:90, d:0});
+  resize(); draw();
 
-  setInterval(() => {
+  function onStatus(d) {
+    isOffline = false;
+    reconnectAttempts = 0;
+    lastFrame = Date.now();
+    scanAngle = d.a;
+    maxRange = d.r || 50;
+    isRunning = d.running === 1;
+    
+    // Update status badge
+    const badge = document.getElementById('status-badge');
+    if(isRunning) {
+      badge.className = 'scanning';
+      badge.textContent = 'SCANNING';
+      document.getElementById('btn-toggle').textContent = '[ STOP ]';
+      document.getElementById('btn-toggle').classList.add('active');
+    } else {
+      badge.className = 'online';
+      badge.textContent = 'PAUSED';
+      document.getElementById('btn-toggle').textContent = '[ START ]';
+      document.getElementById('btn-toggle').classList.remove('active');
+    }
+    
+    if(d.d > 0) objects.push({ a: d.a, r: d.d, t: 1.0 });
+    
+    // New sweep finished: fetch what changed and redraw the whole arc
+    if(d.sw !== undefined && d.sw !== sweepId) {
+      sweepId = d.sw;
+      loadSweep();
+    }
+    
+    // Update last intrusion
+    if(d.li_a && d.li_d) {
+      document.getElementById('last-intrusion').textContent = 
+        `LAST: ${d.li_d}cm @ ${d.li_a}°`;
+    }
+  }
+  
+  function onOffline() {
+    isOffline = true;
+    reconnectAttempts++;
+    sweepBase = -1;  // Device may have rebooted: next fetch is a full frame
+    const badge = document.getElementById('status-badge');
+    badge.className = 'offline';
+    badge.textContent = 'OFFLINE';
+  }
+  
+  // Binary frame (frame.h): 12-byte header + 4-byte points, little-endian
+  function parseFrame(buf) {
+    const v = new DataView(buf);
+    if(v.getUint8(0) !== 1) return null;  // FRAME_VERSION
+    const f = { type: v.getUint8(1), sweep: v.getUint32(4, true), ts: v.getUint32(8, true), pts: [] };
+    const n = v.getUint16(2, true);
+    for(let i = 0; i < n; i++) {
+      const o = 12 + i * 4;
+      f.pts.push({ a: v.getUint8(o), d: v.getUint16(o + 1, true), flags: v.getUint8(o + 3) });
+    }
+    return f;
+  }
+  
+  // Type 2 (full sweep) replaces the table, type 3 (delta) patches it
+  function loadSweep() {
+    fetch(sweepBase < 0 ? '/sweep' : '/sweep?since=' + sweepBase).then(r => r.arrayBuffer()).then(buf => {
+      const f = parseFrame(buf);
+      if(!f) return;
+      if(f.type === 2) cells = [];
+      f.pts.forEach(p => cells[p.a] = p);
+      sweepBase = f.sweep;
+      objects = cells.filter(p => p.flags & 0x01).map(p => ({ a: p.a, r: p.d, t: 1.0 }));
+    }).catch(() => {});
+  }
+  
+  // Push stream: one frame per sweep step, "a,d,r,running,mode,li_a,li_d,sweep"
+  function connectStream() {
+    const es = new EventSource('/events');
+    es.onopen = () => { if(reconnectAttempts > 0) syncTime(); };
+    es.onmessage = e => {
+      const v = e.data.split(',').map(Number);
+      onStatus({a:v[0], d:v[1], r:v[2], running:v[3], mode:v[4], li_a:v[5], li_d:v[6], sw:v[7]});
+    };
+    es.onerror = onOffline;
+  }
+  
+  function pollStatus() {
     fetch('/status')
     .then(r => { if(!r.ok) throw 1; return r.json() })
-    .then(d => {
-      isOffline = false;
-      reconnectAttempts = 0;
-      scanAngle = d.a;
-      maxRange = d.r || 50;
-      isRunning = d.running === 1;
-      
-      // Update status badge
-      const badge = document.getElementById('status-badge');
-      if(isRunning) {
-        badge.className = 'scanning';
-        badge.textContent = 'SCANNING';
-        document.getElementById('btn-toggle').textContent = '[ STOP ]';
-        document.getElementById('btn-toggle').classList.add('active');
-      } else {
-        badge.className = 'online';
-        badge.textContent = 'PAUSED';
-        document.getElementById('btn-toggle').textContent = '[ START ]';
-        document.getElementById('btn-toggle').classList.remove('active');
-      }
-      
-      if(d.d > 0) objects.push({ a: d.a, r: d.d, t: 1.0 });
-      
-      // Update last intrusion
-      if(d.li_a && d.li_d) {
-        document.getElementById('last-intrusion').textContent = 
-          `LAST: ${d.li_d}cm @ ${d.li_a}°`;
-      }
-      
-      draw(d);
-    })
-    .catch(e => {
-      isOffline = true;
-      reconnectAttempts++;
-      const badge = document.getElementById('status-badge');
-      badge.className = 'offline';
-      badge.textContent = 'OFFLINE';
-      
+    .then(onStatus)
+    .catch(() => {
+      onOffline();
       // Retry time sync on reconnect
       if(reconnectAttempts === 3) syncTime();
-      
-      draw({a:scanAngle, d:0}); 
     });
-  }, 100);
+  }
+  
+  if(window.EventSource) connectStream();
+  else setInterval(pollStatus, 100);
+  
+  // Heartbeat arrives every 2s; treat 5s of silence as a dead link
+  setInterval(() => { if(Date.now() - lastFrame > 5000) onOffline(); }, 1000);
+  
+  // Render at display rate, independent of frame arrival
+  function frame(ts) {
+    const dt = lastDraw ? (ts - lastDraw) / 1000 : 0;
+    lastDraw = ts;
+    objects.forEach(o => o.t -= 0.15 * dt);
+    draw();
+    requestAnimationFrame(frame);
+  }
+  requestAnimationFrame(frame);
 
-  function draw(data) {
+  function draw() {
     ctx.fillStyle = '#000'; ctx.fillRect(0,0,width,height);
     const ox = width / 2; const oy = height - 10; const maxR = height - 20;
     
@@ -398,8 +483,7 @@ const char index_html[] PROGMEM = R"rawliteral(
     ctx.fillStyle = grad;
     ctx.beginPath(); ctx.moveTo(ox,oy); ctx.arc(ox, oy, maxR, rad - 0.15, rad + 0.05); ctx.fill();
 
-    // Objects (fade out)
-    objects.forEach(o => o.t -= 0.015); 
+    // Objects (faded in frame())
     objects = objects.filter(o => o.t > 0);
     objects.forEach(o => {
       const br = -(o.a * Math.PI / 180);
@@ -435,17 +519,45 @@ const char index_html[] PROGMEM = R"rawliteral(
   }
 
   // === LOGS ===
+  // Live tail: only records after logCursor are fetched (X-Log-Cursor)
+  let logCursor = 0, logLines = [], logTimer = null;
   function openLogs() {
     document.getElementById('modal-logs').classList.add('active');
-    document.getElementById('log-display').value = "Fetching...";
-    fetch('/get_logs?t='+Date.now()).then(r => r.ok?r.text():"Error").then(t => {
-      document.getElementById('log-display').value = t;
-    });
+    if(logCursor === 0) document.getElementById('log-display').value = "Fetching...";
+    tailLogs();
+    logTimer = setInterval(tailLogs, 2000);
+  }
+  
+  function tailLogs() {
+    fetch('/get_logs?since='+logCursor).then(r => {
+      if(!r.ok) throw 1;
+      const next = +r.headers.get('X-Log-Cursor') || 0;
+      return r.arrayBuffer().then(buf => ({next, buf}));
+    }).then(({next, buf}) => {
+      if(next < logCursor) { logCursor = 0; logLines = []; return tailLogs(); }  // Device log restarted
+      logCursor = next;
+      const t = renderLogs(buf);
+      if(t) logLines.push(t);
+      document.getElementById('log-display').value = logLines.join('\n') || "-- EMPTY LOG --";
+    }).catch(() => { document.getElementById('log-display').value = "Error"; });
+  }
+  
+  // 8-byte LogRecords: time u32, angle u8, flags u8 (0x80 = epoch), dist u16
+  function renderLogs(buf) {
+    const v = new DataView(buf);
+    const lines = [];
+    for(let o = 0; o + 8 <= buf.byteLength; o += 8) {
+      const t = v.getUint32(o, true), a = v.getUint8(o + 4), f = v.getUint8(o + 5), d = v.getUint16(o + 6, true);
+      const ts = (f & 0x80) ? new Date(t * 1000).toTimeString().slice(0, 8) : t;
+      lines.push(`[${ts}] INTRUSION: ${d}cm @ ${a}°`);
+    }
+    return lines.join('\n');
   }
   
   function clearLogs() {
     if(confirm("Confirm Wipe Data?")) {
       fetch('/clear_logs');
+      logLines = [];
       document.getElementById('log-display').value = "[CLEARED]";
     }
   }
@@ -467,6 +579,7 @@ const char index_html[] PROGMEM = R"rawliteral(
       setVal('cfg-bright', c.brt);
       setVal('cfg-min', c.min);
       setVal('cfg-max', c.max);
+      setVal('cfg-samp', c.smp);
       document.getElementById('cfg-bz').checked = (c.bz == 1);
     });
   }
@@ -504,6 +617,7 @@ const char index_html[] PROGMEM = R"rawliteral(
       'br='+document.getElementById('cfg-bright').value,
       'mn='+document.getElementById('cfg-min').value,
       'mx='+document.getElementById('cfg-max').value,
+      'sm='+document.getElementById('cfg-samp').value,
       'b='+(document.getElementById('cfg-bz').checked ? 1 : 0)
     ].join('&');
     
@@ -511,9 +625,12 @@ const char index_html[] PROGMEM = R"rawliteral(
     closeModal('modal-config');
   }
 
-  function closeModal(id) { document.getElementById(id).classList.remove('active'); }
+  function closeModal(id) {
+    document.getElementById(id).classList.remove('active');
+    if(id === 'modal-logs') clearInterval(logTimer);
+  }
   
-  ['speed','dist','lock','bright','min','max'].forEach(k => {
+  ['speed','dist','lock','bright','min','max','samp'].forEach(k => {
     document.getElementById('cfg-'+k).oninput = function() { upd('cfg-'+k); }
   });
   
@@ -525,24 +642,23 @@ const char index_html[] PROGMEM = R"rawliteral(
 // ============================================================================
 // SETUP
 // ============================================================================
+// Only what the radar side needs runs here; the file system, AP and
+// web server come up from webStep() (see boot.h)
 void setup() {
   Serial.begin(115200);
   Serial.println("\n=== RADAR TURRET v2.0 ===");
+  bootMark("serial");
 
-  // Initialize SPIFFS
-  if(!SPIFFS.begin(true)) {
-    Serial.println("[!] SPIFFS Formatting...");
-  }
-  
   // Load configuration
   preferences.begin("radar-app", false);
-  loadConfig();
-  validateConfig();
+  loadConfig(cfg);
+  validateConfig(cfg);
+  cfgNext = cfg;
+  bootMark("config");
   
   // GPIO Setup
-  pinMode(TRIG_PIN, OUTPUT);
-  pinMode(ECHO_PIN, INPUT);
-  pinMode(BUZZER_PIN, OUTPUT);
+  echoBegin(TRIG_PIN, ECHO_PIN);
+  if (Board::hasBuzzer) audioBegin(BUZZER_PIN);
   pinMode(BUTTON_PIN, INPUT_PULLUP);
 
   // Servo Setup
@@ -560,33 +676,70 @@ void setup() {
   strip.begin();
   strip.setBrightness(cfg.ledBright);
   strip.show();
+  static_assert(NUM_PIXELS <= LED_MAX_PIXELS, "profile has more LEDs than leds.h holds");
+  ledsBegin(strip, NUM_PIXELS);
+  ledsBrightness(cfg.ledBright);
+  bootMark("hw");
 
-  // WiFi AP Setup
+  bootDefer("fs", bootFs);
+  bootDefer("wifi", bootWifi);
+  bootDefer("mesh", meshBegin);
+  bootDefer("web", bootWeb);
+  
+  // Radar jobs, started and stopped by enterState()
+  radarBegin(scanServo, arrowServo, &CLASSIC_MODE, onLock);
+  radarConfigure(cfg, cfg.scanSpeed);
+  powerBegin(POWER_SAVE, BUTTON_PIN, bootWifi);
+  jobControl = schedAdd(controlTick, 10);
+  jobAnim    = schedAdd(animTick, ANIM_FRAME_MS);
+  jobLeds    = schedAdd(ledsTick, LED_FRAME_MS);
+  powerRelax(jobControl, 10);
+  powerRelax(jobLeds, LED_FRAME_MS);
+  schedStart(jobControl);
+  schedStart(jobLeds);
+  
+  // Initial state
+  radarCenter();
+  ledOff();
+  radarPublish(currentState, 0);
+  
+#if THREADED_MODE
+  startTasks(radarStep, webStep);
+#endif
+  
+  bootRadarUp();
+}
+
+// ============================================================================
+// DEFERRED BOOT STAGES (web side, see boot.h)
+// ============================================================================
+void bootFs() {
+  if(!SPIFFS.begin(true)) {
+    Serial.println("[!] SPIFFS Formatting...");
+  }
+  logBegin();
+  traceBegin();
+}
+
+void bootWifi() {
   WiFi.softAP(ssid, password);
   Serial.print("[+] AP IP: ");
   Serial.println(WiFi.softAPIP());
+}
 
-  // --- HTTP Endpoints ---
+void bootWeb() {
+  assetsBegin(server);
+  radarRoutes(STATE_LOCKED, &cfgNext.minAngle, &cfgNext.maxAngle);
   server.on("/", handleRoot);
-  server.on("/status", handleStatus);
-  server.on("/time_sync", handleTimeSync);
-  server.on("/get_logs", handleGetLogs);
-  server.on("/clear_logs", handleClearLogs);
   server.on("/get_config", handleGetConfig);
   server.on("/save_config", handleSaveConfig);
   server.on("/reset_config", handleResetConfig);
   server.on("/toggle", handleToggle);
-  server.on("/center", handleCenter);
   server.on("/test_alert", handleTestAlert);
-  server.onNotFound([]() { server.send(404, "text/plain", "404"); });
+  server.onNotFound([]() { replyText(server, 404, "404"); });
 
   server.begin();
   Serial.println("[+] Web server started");
-  
-  // Initial state
-  centerServos();
-  ledOff();
-  
   Serial.println("[+] Ready!");
 }
 
@@ -594,28 +747,50 @@ void setup() {
 // MAIN LOOP
 // ============================================================================
 void loop() {
-  server.handleClient();
-  handleButton();
-  
-  switch(currentState) {
-    case STATE_IDLE:
-      // Do nothing, waiting for start
+#if THREADED_MODE
+  vTaskDelete(NULL);  // Work runs in radarTask / webTask
+#else
+  webStep();
+  uint32_t idle = radarStep();
+  if (idle > 0) radarIdle(idle);
+#endif
+}
+
+// Runs on the radar side (see tasks.h)
+void runCommand(uint8_t cmd, int arg) {
+  switch(cmd) {
+    case CMD_TOGGLE:
+      toggleRunning();
+      break;
+      
+    case CMD_CENTER:
+      radarCenter();
+      break;
+      
+    case CMD_TEST_ALERT:
+      if (currentState == STATE_IDLE) enterState(STATE_TEST_ALERT);
       break;
       
-    case STATE_SCANNING:
-      runRadarScan();
+    case CMD_CLEAR_INTRUSION:
+      radarClearIntrusion();
       break;
       
-    case STATE_LOCKED:
-      handleLockOn();
+    case CMD_APPLY_CONFIG:
+      stageRead(&cfg, &cfgNext, sizeof(cfg));
+      ledsBrightness(cfg.ledBright);
+      radarConfigure(cfg, cfg.scanSpeed);
       break;
       
-    case STATE_STARTUP:
-      runStartupAnimation();
+    case CMD_RELEARN:
+      bgReset();
       break;
       
-    case STATE_TEST_ALERT:
-      runTestAlert();
+    case CMD_CUE:
+      arrowCue(arg);
+      break;
+
+    case CMD_TRACE_REPLAY:
+      radarReplayStart();
       break;
   }
 }
@@ -623,116 +798,75 @@ void loop() {
 // ============================================================================
 // STATE HANDLERS
 // ============================================================================
-void runRadarScan() {
-  unsigned long now = millis();
+// Each state runs as a set of scheduler jobs (sched.h). enterState() is
+// the only place that starts and stops them; the sweep jobs are the
+// core's (radar.h), which moves between SCANNING and LOCKED by onLock().
+void enterState(SystemState s) {
+  if (s == currentState) return;
+  currentState = s;
   
-  if (now - lastScanTime >= (unsigned long)cfg.scanSpeed) {
-    lastScanTime = now;
-    
-    // Update scan position
-    scanPos += scanDirection;
-    if (scanPos >= cfg.maxAngle) {
-      scanPos = cfg.maxAngle;
-      scanDirection = -1;
-    }
-    if (scanPos <= cfg.minAngle) {
-      scanPos = cfg.minAngle;
-      scanDirection = 1;
-    }
-    
-    scanServo.write(scanPos);
-    
-    // Get distance reading
-    int dist = getDistance();
-    lastDistance = dist;
-    
-    if (dist > 0 && dist < cfg.maxDist) {
-      // Object detected!
-      currentState = STATE_LOCKED;
-      lockOnStartTime = now;
-      
-      // Move arrow to target
-      arrowServo.write(scanPos);
-      lastArrowPos = scanPos;
-      
-      // Log intrusion
-      lastIntrusionAngle = scanPos;
-      lastIntrusionDist = dist;
-      logIntrusion(scanPos, dist);
-      
-      // Alert!
-      runAlert(dist);
-    } else {
-      ledIdle();
-      noTone(BUZZER_PIN);
-    }
+  radarRun(s == STATE_SCANNING || s == STATE_LOCKED);
+  
+  if (s == STATE_STARTUP || s == STATE_TEST_ALERT) {
+    animFrame = 0;
+    schedPeriod(jobAnim, s == STATE_STARTUP ? ANIM_FRAME_MS : 100);
+    schedStart(jobAnim);
+  } else {
+    schedStop(jobAnim);
   }
 }
 
-void handleLockOn() {
-  unsigned long now = millis();
-  
-  // Keep alerting based on last known distance
-  runAlert(lastDistance);
-  
-  // Check if lock time expired
-  if (now - lockOnStartTime > (unsigned long)cfg.lockTime) {
-    currentState = STATE_SCANNING;
-    ledOff();
-    noTone(BUZZER_PIN);
-    
-    // Reset arrow to center
-    arrowServo.write(90);
-    lastArrowPos = 90;
-  }
+// Every 10ms: web commands, button, snapshot
+void controlTick() {
+  drainCommands();
+  handleButton();
+  radarPublish(currentState, 0);
+}
+
+// The core gained or dropped its lock
+void onLock(bool locked) {
+  enterState(locked ? STATE_LOCKED : STATE_SCANNING);
+}
+
+// Animation frames for STARTUP and TEST_ALERT
+void animTick() {
+  if (currentState == STATE_STARTUP) runStartupAnimation();
+  else if (currentState == STATE_TEST_ALERT) runTestAlert();
 }
 
 void runStartupAnimation() {
-  unsigned long now = millis();
+  if (animFrame % 2 == 0) {
+    setAllLeds(0, 0, 255);  // Blue
+  } else {
+    ledOff();
+  }
   
-  if (now - animStartTime >= ANIM_FRAME_MS) {
-    animStartTime = now;
-    
-    if (animFrame % 2 == 0) {
-      setAllLeds(0, 0, 255);  // Blue
-    } else {
-      ledOff();
-    }
-    
-    animFrame++;
-    
-    if (animFrame >= 6) {  // 3 blinks done
-      animFrame = 0;
-      currentState = STATE_SCANNING;
-      ledIdle();
-    }
+  animFrame++;
+  
+  if (animFrame >= 6) {  // 3 blinks done
+    enterState(STATE_SCANNING);
+    ledIdle();
   }
 }
 
 void runTestAlert() {
-  unsigned long now = millis();
+  animFrame++;
   
-  if (now - animStartTime >= 100) {
-    animStartTime = now;
-    animFrame++;
-    
-    // Cycle through alerts
-    if (animFrame < 3) {
-      setAllLeds(255, 255, 0);  // Yellow
-      if(cfg.buzzerOn) tone(BUZZER_PIN, 1000);
-    } else if (animFrame < 6) {
-      setAllLeds(255, 140, 0);  // Orange
-      if(cfg.buzzerOn) tone(BUZZER_PIN, 1500);
-    } else if (animFrame < 9) {
-      if (animFrame % 2) setAllLeds(255, 0, 0);
-      else ledOff();
-      if(cfg.buzzerOn) tone(BUZZER_PIN, 2000);
-    } else {
-      animFrame = 0;
-      currentState = STATE_IDLE;
-      ledOff();
-      noTone(BUZZER_PIN);
-    }
+  // Cycle through alerts
+  if (animFrame < 3) {
+    setAllLeds(255, 255, 0);  // Yellow
+    if(BUZZER_ON) audioTone(1000);
+  } else if (animFrame < 6) {
+    setAllLeds(255, 140, 0);  // Orange
+    if(BUZZER_ON) audioTone(1500);
+  } else if (animFrame < 9) {
+    if (animFrame % 2) setAllLeds(255, 0, 0);
+    else ledOff();
+    if(BUZZER_ON) audioTone(2000);
+  } else {
+    enterState(STATE_IDLE);
+    ledOff();
+    audioTone(0);
   }
 }
 
@@ -747,26 +881,29 @@ void runAlert(int dist) {
     } else {
       ledOff();
     }
-    if(cfg.buzzerOn) tone(BUZZER_PIN, 2000);
+    if(BUZZER_ON) audioTone(2000);
   } else if (dist < 15) {
     // WARNING: Orange + mid pitch
     setAllLeds(255, 140, 0);
-    if(cfg.buzzerOn) tone(BUZZER_PIN, 1500);
+    if(BUZZER_ON) audioTone(1500);
   } else {
     // CAUTION: Yellow + low pitch
     setAllLeds(255, 255, 0);
-    if(cfg.buzzerOn) tone(BUZZER_PIN, 1000);
+    if(BUZZER_ON) audioTone(1000);
   }
 }
 
 // ============================================================================
 // LED HELPERS
 // ============================================================================
+// Helpers only stage the frame; ledsTick() pushes it when it changed
 void setAllLeds(uint8_t r, uint8_t g, uint8_t b) {
-  for(int i = 0; i < NUM_PIXELS; i++) {
-    strip.setPixelColor(i, strip.Color(r, g, b));
-  }
-  strip.show();
+  ledsFill(strip.Color(r, g, b));
+}
+
+// Every LED_FRAME_MS: push the staged frame, not while a ping is in flight
+void ledsTick() {
+  ledsFlush(!echoBusy);
 }
 
 void ledOff() {
@@ -778,102 +915,47 @@ void ledIdle() {
 }
 
 // ============================================================================
-// SENSOR
+// CONFIG MANAGEMENT
 // ============================================================================
-int getDistance() {
-  digitalWrite(TRIG_PIN, LOW);
-  delayMicroseconds(2);
-  digitalWrite(TRIG_PIN, HIGH);
-  delayMicroseconds(10);
-  digitalWrite(TRIG_PIN, LOW);
-  
-  long duration = pulseIn(ECHO_PIN, HIGH, 25000);  // 25ms timeout (~4m max)
+void loadConfig(Config &c) {
+  if (cfgStoreLoad(preferences, CONFIG_VERSION, &c, sizeof(c))) {
+    Serial.println("[+] Config loaded");
+    return;
+  }
   
-  if (duration == 0) return -1;
+  // No blob yet: migrate the old per-key layout (or take the defaults)
+  c.scanSpeed  = preferences.getInt("speed", 20);
+  c.maxDist    = preferences.getInt("dist", 50);
+  c.lockTime   = preferences.getInt("lock", 2000);
+  c.ledBright  = preferences.getInt("bright", 50);
+  c.minAngle   = preferences.getInt("min", 15);
+  c.maxAngle   = preferences.getInt("max", 165);
+  c.samples    = preferences.getInt("samp", 3);
+  c.buzzerOn   = preferences.getBool("bz", true);
+  saveConfig(c);
   
-  return (int)(duration * 0.034 / 2);
+  Serial.println("[+] Config created");
 }
 
-// ============================================================================
-// CONFIG MANAGEMENT
-// ============================================================================
-void loadConfig() {
-  cfg.scanSpeed  = preferences.getInt("speed", 20);
-  cfg.maxDist    = preferences.getInt("dist", 50);
-  cfg.lockTime   = preferences.getInt("lock", 2000);
-  cfg.ledBright  = preferences.getInt("bright", 50);
-  cfg.minAngle   = preferences.getInt("min", 15);
-  cfg.maxAngle   = preferences.getInt("max", 165);
-  cfg.buzzerOn   = preferences.getBool("bz", true);
-  
-  Serial.println("[+] Config loaded");
+// Stages the config; cfgStorePump() writes it once saves go quiet
+void saveConfig(const Config &c) {
+  cfgStoreSave(&c, sizeof(c));
 }
 
-void saveConfig() {
-  preferences.putInt("speed", cfg.scanSpeed);
-  preferences.putInt("dist", cfg.maxDist);
-  preferences.putInt("lock", cfg.lockTime);
-  preferences.putInt("bright", cfg.ledBright);
-  preferences.putInt("min", cfg.minAngle);
-  preferences.putInt("max", cfg.maxAngle);
-  preferences.putBool("bz", cfg.buzzerOn);
-  
-  Serial.println("[+] Config saved");
+// Web side: makes next the config and hands it to the radar side, which
+// never sees a half-written copy (stageRead() in CMD_APPLY_CONFIG)
+void stageConfig(const Config &next) {
+  if (next.minAngle != cfgNext.minAngle || next.maxAngle != cfgNext.maxAngle) sweepRestart();
+  stageWrite(&cfgNext, &next, sizeof(next));
+  saveConfig(next);
+  postCommand(CMD_APPLY_CONFIG);
 }
 
-void validateConfig() {
-  // Ensure angles are valid
-  if (cfg.minAngle >= cfg.maxAngle) {
-    cfg.minAngle = 15;
-    cfg.maxAngle = 165;
-    Serial.println("[!] Invalid angles, reset to defaults");
-  }
-  
-  // Clamp values
-  cfg.scanSpeed = constrain(cfg.scanSpeed, 5, 100);
-  cfg.maxDist   = constrain(cfg.maxDist, 10, 200);
-  cfg.lockTime  = constrain(cfg.lockTime, 500, 5000);
-  cfg.ledBright = constrain(cfg.ledBright, 0, 255);
-  cfg.minAngle  = constrain(cfg.minAngle, 0, 80);
-  cfg.maxAngle  = constrain(cfg.maxAngle, 100, 180);
-}
-
-// ============================================================================
-// LOGGING
-// ============================================================================
-void logIntrusion(int ang, int dist) {
-  // Check log file size and rotate if needed
-  if (SPIFFS.exists("/log.txt")) {
-    File check = SPIFFS.open("/log.txt", "r");
-    if (check && check.size() > LOG_MAX_SIZE) {
-      check.close();
-      SPIFFS.remove("/log.txt");
-      Serial.println("[!] Log rotated (size limit)");
-    } else if (check) {
-      check.close();
-    }
-  }
-  
-  // Append log entry
-  File f = SPIFFS.open("/log.txt", FILE_APPEND);
-  if (f) {
-    char buf[80];
-    
-    if (timeSynced) {
-      time_t now;
-      time(&now);
-      struct tm *t = localtime(&now);
-      sprintf(buf, "[%02d:%02d:%02d] INTRUSION: %dcm @ %d°\n", 
-              t->tm_hour, t->tm_min, t->tm_sec, dist, ang);
-    } else {
-      sprintf(buf, "[%lu] INTRUSION: %dcm @ %d°\n", 
-              millis() / 1000, dist, ang);
-    }
-    
-    f.print(buf);
-    f.close();
-    Serial.print("[LOG] "); Serial.print(buf);
-  }
+// Sweep fields as in the core, plus the v2-only ones
+void validateConfig(Config &c) {
+  radarConfigValidate(c);
+  c.scanSpeed = constrain(c.scanSpeed, 5, 100);
+  c.ledBright = constrain(c.ledBright, 0, 255);
 }
 
 // ============================================================================
@@ -908,145 +990,74 @@ void handleButton() {
 void toggleRunning() {
   if (currentState == STATE_IDLE) {
     // Start scanning with animation
-    currentState = STATE_STARTUP;
-    animStartTime = millis();
-    animFrame = 0;
+    enterState(STATE_STARTUP);
     Serial.println("[*] Starting scan...");
   } else {
     // Stop
-    currentState = STATE_IDLE;
-    centerServos();
-    ledOff();
-    noTone(BUZZER_PIN);
+    enterState(STATE_IDLE);
+    radarHalt();
     Serial.println("[*] Stopped");
   }
 }
 
-// ============================================================================
-// SERVO HELPERS
-// ============================================================================
-void centerServos() {
-  scanServo.write(90);
-  arrowServo.write(90);
-  scanPos = 90;
-  lastArrowPos = 90;
-}
-
 // ============================================================================
 // HTTP HANDLERS
 // ============================================================================
 void handleRoot() {
-  server.send(200, "text/html", index_html);
-}
-
-void handleStatus() {
-  char buf[128];
-  int running = (currentState == STATE_SCANNING || currentState == STATE_LOCKED) ? 1 : 0;
-  
-  sprintf(buf, "{\"a\":%d,\"d\":%d,\"r\":%d,\"running\":%d,\"li_a\":%d,\"li_d\":%d}",
-          scanPos, lastDistance, cfg.maxDist, running, 
-          lastIntrusionAngle, lastIntrusionDist);
-  
-  server.send(200, "application/json", buf);
-}
-
-void handleTimeSync() {
-  if (server.hasArg("ts")) {
-    struct timeval tv;
-    tv.tv_sec = server.arg("ts").toInt();
-    tv.tv_usec = 0;
-    settimeofday(&tv, NULL);
-    timeSynced = true;
-    Serial.println("[+] Time synced");
-    server.send(200, "text/plain", "OK");
-  } else {
-    server.send(400, "text/plain", "Bad Request");
-  }
-}
-
-void handleGetLogs() {
-  if (SPIFFS.exists("/log.txt")) {
-    File f = SPIFFS.open("/log.txt", "r");
-    if (f.size() == 0) {
-      server.send(200, "text/plain", "-- EMPTY LOG --");
-    } else {
-      server.streamFile(f, "text/plain");
-    }
-    f.close();
-  } else {
-    server.send(200, "text/plain", "-- NO DATA --");
-  }
-}
-
-void handleClearLogs() {
-  SPIFFS.remove("/log.txt");
-  lastIntrusionAngle = 0;
-  lastIntrusionDist = 0;
-  Serial.println("[!] Logs cleared");
-  server.send(200, "text/plain", "CLEARED");
+  sendAsset(server, V2_INDEX_GZ, V2_INDEX_GZ_LEN, V2_INDEX_ETAG, index_html);
 }
 
 void handleGetConfig() {
-  String json = "{";
-  json += "\"spd\":" + String(cfg.scanSpeed) + ",";
-  json += "\"dst\":" + String(cfg.maxDist) + ",";
-  json += "\"lck\":" + String(cfg.lockTime) + ",";
-  json += "\"brt\":" + String(cfg.ledBright) + ",";
-  json += "\"min\":" + String(cfg.minAngle) + ",";
-  json += "\"max\":" + String(cfg.maxAngle) + ",";
-  json += "\"bz\":" + String(cfg.buzzerOn ? 1 : 0);
-  json += "}";
-  
-  server.send(200, "application/json", json);
+  char buf[128];
+  JsonOut j;
+  jsonBegin(j, buf, sizeof(buf));
+  jsonInt(j, "spd", cfgNext.scanSpeed);
+  jsonInt(j, "brt", cfgNext.ledBright);
+  jsonInt(j, "bz", cfgNext.buzzerOn ? 1 : 0);
+  radarConfigJson(j, cfgNext);
+  replyJson(server, j);
 }
 
 void handleSaveConfig() {
-  if (server.hasArg("s"))  cfg.scanSpeed  = server.arg("s").toInt();
-  if (server.hasArg("d"))  cfg.maxDist    = server.arg("d").toInt();
-  if (server.hasArg("l"))  cfg.lockTime   = server.arg("l").toInt();
-  if (server.hasArg("br")) cfg.ledBright  = server.arg("br").toInt();
-  if (server.hasArg("mn")) cfg.minAngle   = server.arg("mn").toInt();
-  if (server.hasArg("mx")) cfg.maxAngle   = server.arg("mx").toInt();
-  if (server.hasArg("b"))  cfg.buzzerOn   = server.arg("b").toInt();
-  
-  validateConfig();
-  saveConfig();
+  Config next = cfgNext;
+  radarConfigArgs(next);
+  replyArgInt(server, "s",  next.scanSpeed);
+  replyArgInt(server, "br", next.ledBright);
+  int bz;
+  if (replyArgInt(server, "b", bz)) next.buzzerOn = bz;
   
-  strip.setBrightness(cfg.ledBright);
-  strip.show();
+  validateConfig(next);
+  stageConfig(next);
   
-  server.send(200, "text/plain", "SAVED");
+  replyText(server, 200, "SAVED");
 }
 
 void handleResetConfig() {
-  preferences.clear();
-  loadConfig();
-  validateConfig();
-  
-  strip.setBrightness(cfg.ledBright);
-  strip.show();
+  cfgStoreClear();
+  Config next;
+  loadConfig(next);
+  validateConfig(next);
+  sweepRestart();
+  stageConfig(next);
   
   Serial.println("[!] Config reset to defaults");
-  server.send(200, "text/plain", "RESET");
+  replyText(server, 200, "RESET");
 }
 
 void handleToggle() {
-  toggleRunning();
-  server.send(200, "text/plain", currentState != STATE_IDLE ? "RUNNING" : "STOPPED");
-}
-
-void handleCenter() {
-  centerServos();
-  server.send(200, "text/plain", "CENTERED");
+  RadarSnapshot s;
+  snapshotRead(s);
+  postCommand(CMD_TOGGLE);
+  replyText(server, 200, s.state == STATE_IDLE ? "RUNNING" : "STOPPED");
 }
 
 void handleTestAlert() {
-  if (currentState == STATE_IDLE) {
-    currentState = STATE_TEST_ALERT;
-    animStartTime = millis();
-    animFrame = 0;
-    server.send(200, "text/plain", "TESTING");
+  RadarSnapshot s;
+  snapshotRead(s);
+  if (s.state == STATE_IDLE) {
+    postCommand(CMD_TEST_ALERT);
+    replyText(server, 200, "TESTING");
   } else {
-    server.send(200, "text/plain", "BUSY");
+    replyText(server, 200, "BUSY");
   }
 }
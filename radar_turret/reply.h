@@ -0,0 +1,186 @@
+/*
+ * ============================================================================
+ * RADAR TURRET HTTP REPLIES
+ * ============================================================================
+ *
+ * Heap-free building blocks for the web handlers:
+ *
+ *   JsonOut          appends "key":value pairs into a caller's buffer
+ *   replyJson()      sends it with an explicit length
+ *   replyText()      sends a constant string
+ *   replyArgInt()    reads one numeric query argument
+ *   replyArgIs()     compares one query argument with a constant
+ *
+ * WebServer::send() takes the body as a String, so every reply through
+ * it copied the body to the heap first. Everything here goes through
+ * send_P() with a length instead. The request line, headers and
+ * argument table are still Strings inside WebServer itself.
+ *
+ * WebServer::argName(i) and arg(i) also return a String by value, so
+ * the argument helpers below copy each name they compare and the value
+ * they parse. String keeps up to 11 characters inline on the ESP32, so
+ * short names and numbers ("since", "fmt", epoch seconds) never touch
+ * the heap. A longer argument costs one allocation per read.
+ *
+ * USAGE:
+ *   char buf[96];
+ *   JsonOut j;
+ *   jsonBegin(j, buf, sizeof(buf));
+ *   jsonInt(j, "a", angle);
+ *   jsonStr(j, "mode", "SENTRY");
+ *   replyJson(server, j);
+ *
+ * A value that does not fit marks the writer as overflowed and the
+ * reply becomes a 500, never a truncated document.
+ *
+ * ============================================================================
+ */
+
+#ifndef REPLY_H
+#define REPLY_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+#include <stdarg.h>
+
+struct JsonOut {
+  char *buf;
+  size_t cap;
+  size_t len;
+  bool comma;       // A field was written, the next needs a separator
+  bool overflow;
+};
+
+static void jsonPut(JsonOut &j, const char *fmt, ...) {
+  if (j.overflow) return;
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(j.buf + j.len, j.cap - j.len, fmt, ap);
+  va_end(ap);
+  if (n < 0 || (size_t)n >= j.cap - j.len) j.overflow = true;
+  else j.len += n;
+}
+
+static void jsonChar(JsonOut &j, char c) {
+  if (j.overflow) return;
+  if (j.len + 1 >= j.cap) {
+    j.overflow = true;
+    return;
+  }
+  j.buf[j.len++] = c;
+  j.buf[j.len] = '\0';
+}
+
+static void jsonKey(JsonOut &j, const char *key) {
+  jsonPut(j, j.comma ? ",\"%s\":" : "\"%s\":", key);
+  j.comma = true;
+}
+
+/*
+ * jsonBegin(j, buf, cap)
+ * ----------------------
+ * Starts an object in buf.
+ */
+void jsonBegin(JsonOut &j, char *buf, size_t cap) {
+  j.buf = buf;
+  j.cap = cap;
+  j.len = 0;
+  j.comma = false;
+  j.overflow = cap == 0;
+  jsonPut(j, "{");
+}
+
+void jsonInt(JsonOut &j, const char *key, long v) {
+  jsonKey(j, key);
+  jsonPut(j, "%ld", v);
+}
+
+void jsonUInt(JsonOut &j, const char *key, unsigned long v) {
+  jsonKey(j, key);
+  jsonPut(j, "%lu", v);
+}
+
+// Plain ASCII only: quotes and backslashes are escaped, nothing else
+void jsonStr(JsonOut &j, const char *key, const char *v) {
+  jsonKey(j, key);
+  jsonChar(j, '"');
+  for (; *v; v++) {
+    if (*v == '"' || *v == '\\') jsonChar(j, '\\');
+    jsonChar(j, *v);
+  }
+  jsonChar(j, '"');
+}
+
+/*
+ * jsonEnd(j)
+ * ----------
+ * Closes the object. Returns its length, 0 if it did not fit.
+ */
+size_t jsonEnd(JsonOut &j) {
+  jsonPut(j, "}");
+  return j.overflow ? 0 : j.len;
+}
+
+/*
+ * replyJson(srv, j)
+ * -----------------
+ * Closes and sends the object, or a 500 if it overflowed.
+ */
+void replyJson(WebServer &srv, JsonOut &j) {
+  size_t len = jsonEnd(j);
+  if (len == 0) {
+    srv.send_P(500, "text/plain", "JSON overflow");
+    return;
+  }
+  srv.send_P(200, "application/json", j.buf, len);
+}
+
+/*
+ * replyText(srv, code, msg)
+ * -------------------------
+ * Sends a constant text/plain body.
+ */
+void replyText(WebServer &srv, int code, const char *msg) {
+  srv.send_P(code, "text/plain", msg);
+}
+
+// Index of query argument name, -1 if absent
+static int replyArgFind(WebServer &srv, const char *name) {
+  for (int i = 0; i < srv.args(); i++) {
+    if (strcmp(srv.argName(i).c_str(), name) == 0) return i;
+  }
+  return -1;
+}
+
+/*
+ * replyArgInt(srv, name, out)
+ * ---------------------------
+ * Parses query argument name into out. Returns false (out untouched)
+ * if it is absent. The uint32_t form takes the full unsigned range
+ * (epoch seconds, sequence numbers).
+ */
+bool replyArgInt(WebServer &srv, const char *name, int &out) {
+  int i = replyArgFind(srv, name);
+  if (i < 0) return false;
+  out = atoi(srv.arg(i).c_str());
+  return true;
+}
+
+bool replyArgInt(WebServer &srv, const char *name, uint32_t &out) {
+  int i = replyArgFind(srv, name);
+  if (i < 0) return false;
+  out = strtoul(srv.arg(i).c_str(), nullptr, 10);
+  return true;
+}
+
+/*
+ * replyArgIs(srv, name, value)
+ * ----------------------------
+ * True if query argument name is present and equals value.
+ */
+bool replyArgIs(WebServer &srv, const char *name, const char *value) {
+  int i = replyArgFind(srv, name);
+  return i >= 0 && strcmp(srv.arg(i).c_str(), value) == 0;
+}
+
+#endif // REPLY_H
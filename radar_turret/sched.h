@@ -0,0 +1,130 @@
+/*
+ * ============================================================================
+ * RADAR TURRET SCHEDULER
+ * ============================================================================
+ *
+ * Cooperative deadline scheduler for the radar side. Subsystems register
+ * jobs once in setup(); state changes start and stop them. schedRun()
+ * runs whatever is due and returns how long the caller may sleep, so the
+ * loop no longer busy-spins between scattered "now - tX >= period"
+ * checks.
+ *
+ * JOBS:
+ *   periodic  schedAdd(fn, periodMs)  - next deadline = previous + period
+ *   one-shot  schedAdd(fn, 0)         - runs once per schedStart()
+ *
+ *   A job may call schedStart() on itself to move its own next deadline
+ *   (e.g. retry in 1ms, or the duration of the next melody note).
+ *
+ * OVERRUNS:
+ *   A periodic job that falls more than a whole period behind is
+ *   re-phased to now instead of running back-to-back to catch up, and
+ *   counted in metricOverruns. Start lateness of every job is recorded in
+ *   the M_SCHED_LATE metric.
+ *
+ * Radar side only. The table is tiny, so a linear scan beats a heap.
+ *
+ * ============================================================================
+ */
+
+#ifndef SCHED_H
+#define SCHED_H
+
+#include <Arduino.h>
+#include "metrics.h"
+
+#define SCHED_MAX_JOBS   8
+#define SCHED_IDLE_MS    20     // Sleep cap when nothing is due soon
+
+struct SchedJob {
+  void (*fn)();
+  uint32_t period;        // ms, 0 = one-shot
+  unsigned long due;      // millis() deadline
+  bool active;
+};
+
+SchedJob schedJobs[SCHED_MAX_JOBS];
+uint8_t schedCount = 0;
+
+/*
+ * schedAdd(fn, periodMs)
+ * ----------------------
+ * Registers a job (inactive until schedStart). Returns its id.
+ */
+int8_t schedAdd(void (*fn)(), uint32_t periodMs) {
+  if (schedCount >= SCHED_MAX_JOBS) return -1;
+  SchedJob &j = schedJobs[schedCount];
+  j.fn = fn;
+  j.period = periodMs;
+  j.active = false;
+  return schedCount++;
+}
+
+/*
+ * schedStart(id, delayMs)
+ * -----------------------
+ * Activates a job (or moves its deadline) to run delayMs from now.
+ */
+void schedStart(int8_t id, uint32_t delayMs = 0) {
+  if (id < 0) return;
+  schedJobs[id].due = millis() + delayMs;
+  schedJobs[id].active = true;
+}
+
+/*
+ * schedStop(id)
+ * -------------
+ * Deactivates a job.
+ */
+void schedStop(int8_t id) {
+  if (id >= 0) schedJobs[id].active = false;
+}
+
+/*
+ * schedPeriod(id, periodMs)
+ * -------------------------
+ * Changes a periodic job's period from its next run on.
+ */
+void schedPeriod(int8_t id, uint32_t periodMs) {
+  if (id >= 0) schedJobs[id].period = periodMs;
+}
+
+/*
+ * schedRun()
+ * ----------
+ * Runs every due job in registration order. Returns the milliseconds
+ * until the next deadline (0 if something is already due again).
+ */
+uint32_t schedRun() {
+  for (uint8_t i = 0; i < schedCount; i++) {
+    SchedJob &j = schedJobs[i];
+    unsigned long now = millis();
+    if (!j.active || (long)(now - j.due) < 0) continue;
+
+    unsigned long late = now - j.due;
+    metricRecord(M_SCHED_LATE, late * 1000);
+
+    // Re-arm before running so the job can override its own deadline
+    if (j.period == 0) {
+      j.active = false;
+    } else if (late >= j.period) {
+      j.due = now + j.period;
+      metricOverruns++;
+    } else {
+      j.due += j.period;
+    }
+    j.fn();
+  }
+
+  unsigned long now = millis();
+  uint32_t wait = SCHED_IDLE_MS;
+  for (uint8_t i = 0; i < schedCount; i++) {
+    if (!schedJobs[i].active) continue;
+    long left = (long)(schedJobs[i].due - now);
+    if (left <= 0) return 0;
+    if ((uint32_t)left < wait) wait = left;
+  }
+  return wait;
+}
+
+#endif // SCHED_H
@@ -0,0 +1,223 @@
+/*
+ * ============================================================================
+ * RADAR TURRET TASKS
+ * ============================================================================
+ *
+ * Optional dual-core layout (enabled with THREADED_MODE in the sketch):
+ *
+ *   CORE 1  radarTask  (high priority)  button, sweep, lock, LEDs, buzzer
+ *   CORE 0  webTask    (low priority)   server.handleClient(), WiFi stack
+ *
+ * The two sides never share mutable state directly:
+ *   - Radar -> Web: a single-producer snapshot guarded by a sequence
+ *     counter (seqlock). The radar task publishes, handlers read a
+ *     consistent copy without ever blocking the writer.
+ *   - Web -> Radar: small commands on a FreeRTOS queue, drained by the
+ *     radar task at the top of each step. A struct too big for a
+ *     command (the config) is staged behind the same kind of sequence
+ *     counter, written by the web side, and copied by the command.
+ *
+ * Without THREADED_MODE the same API is used from loop(): commands run
+ * immediately and the snapshot is simply refreshed every pass.
+ *
+ * ============================================================================
+ */
+
+#ifndef TASKS_H
+#define TASKS_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+
+#define RADAR_TASK_CORE   1
+#define RADAR_TASK_PRIO   3
+#define RADAR_TASK_STACK  4096
+#define WEB_TASK_CORE     0
+#define WEB_TASK_PRIO     1
+#define WEB_TASK_STACK    8192
+#define CMD_QUEUE_LEN     8
+#define LOOP_WEB_POLL_MS  5     // Longest single-loop sleep between web polls
+
+// ============================================================================
+// SNAPSHOT (radar -> web)
+// ============================================================================
+
+struct RadarSnapshot {
+  int angle;      // Current scan angle
+  int dist;       // Last distance reading
+  int range;      // Max detection range
+  int state;      // Sketch state machine value
+  int mode;       // Operating mode (0 if the sketch has none)
+  int running;    // 1 while scanning or locked
+  int liAngle;    // Last intrusion angle
+  int liDist;     // Last intrusion distance
+  uint32_t sweep; // Completed sweep counter
+};
+
+RadarSnapshot snapData = {};
+volatile uint32_t snapSeq = 0;
+
+/*
+ * snapshotPublish(s)
+ * ------------------
+ * Called by the radar side only. An odd sequence number marks a write
+ * in progress.
+ */
+void snapshotPublish(const RadarSnapshot &s) {
+  snapSeq = snapSeq + 1;
+  __sync_synchronize();
+  snapData = s;
+  __sync_synchronize();
+  snapSeq = snapSeq + 1;
+}
+
+/*
+ * snapshotRead(out)
+ * -----------------
+ * Copies the latest snapshot, retrying if the writer was mid-update.
+ */
+void snapshotRead(RadarSnapshot &out) {
+  uint32_t seq;
+  do {
+    seq = snapSeq;
+    __sync_synchronize();
+    out = snapData;
+    __sync_synchronize();
+  } while ((seq & 1) || seq != snapSeq);
+}
+
+// ============================================================================
+// STAGING (web -> radar)
+// ============================================================================
+
+volatile uint32_t stageSeq = 0;
+
+/*
+ * stageWrite(stage, src, len)
+ * ---------------------------
+ * Web side only: copies src into the staging copy, then a command
+ * tells the radar side to pick it up with stageRead().
+ */
+void stageWrite(void *stage, const void *src, size_t len) {
+  stageSeq = stageSeq + 1;
+  __sync_synchronize();
+  memcpy(stage, src, len);
+  __sync_synchronize();
+  stageSeq = stageSeq + 1;
+}
+
+/*
+ * stageRead(dst, stage, len)
+ * --------------------------
+ * Radar side: copies the staging copy, retrying if the web side was
+ * mid-write.
+ */
+void stageRead(void *dst, const void *stage, size_t len) {
+  uint32_t seq;
+  do {
+    seq = stageSeq;
+    __sync_synchronize();
+    memcpy(dst, stage, len);
+    __sync_synchronize();
+  } while ((seq & 1) || seq != stageSeq);
+}
+
+// ============================================================================
+// COMMANDS (web -> radar)
+// ============================================================================
+
+enum RadarCmd {
+  CMD_TOGGLE,            // Start/stop scanning
+  CMD_CENTER,            // Center both servos
+  CMD_TEST_ALERT,        // Run alert test (if idle)
+  CMD_CLEAR_INTRUSION,   // Forget last intrusion
+  CMD_APPLY_CONFIG,      // Take the staged config, push it to hardware
+  CMD_SET_MODE,          // Switch operating mode (arg = mode)
+  CMD_RELEARN,           // Forget the background model
+  CMD_CUE,               // Mesh target for the arrow (arg = ARROW_CUE(), -1 = none)
+  CMD_TRACE_REPLAY       // Reset the pipeline and start the rewound trace
+};
+
+struct RadarCommand {
+  uint8_t cmd;
+  int arg;
+};
+
+QueueHandle_t cmdQueue = nullptr;
+
+// Implemented by the sketch, always runs on the radar side
+void runCommand(uint8_t cmd, int arg);
+
+/*
+ * postCommand(cmd, arg)
+ * ---------------------
+ * Queues a command for the radar task, or runs it inline when the
+ * tasks are not started.
+ */
+void postCommand(uint8_t cmd, int arg = 0) {
+  if (cmdQueue == nullptr) {
+    runCommand(cmd, arg);
+    return;
+  }
+  RadarCommand c = { cmd, arg };
+  if (xQueueSend(cmdQueue, &c, 0) != pdTRUE) {
+    Serial.println("[!] Command queue full");
+  }
+}
+
+/*
+ * drainCommands()
+ * ---------------
+ * Runs every queued command. Called by the radar side each step.
+ */
+void drainCommands() {
+  if (cmdQueue == nullptr) return;
+  RadarCommand c;
+  while (xQueueReceive(cmdQueue, &c, 0) == pdTRUE) {
+    runCommand(c.cmd, c.arg);
+  }
+}
+
+// ============================================================================
+// TASKS
+// ============================================================================
+
+uint32_t (*radarStepFn)() = nullptr;   // Returns ms it may sleep
+void (*webStepFn)() = nullptr;
+
+void radarTask(void *) {
+  for (;;) {
+    uint32_t idle = radarStepFn();
+    vTaskDelay(max((TickType_t)1, pdMS_TO_TICKS(idle)));
+  }
+}
+
+void webTask(void *) {
+  for (;;) {
+    webStepFn();
+    vTaskDelay(1);
+  }
+}
+
+/*
+ * startTasks(radarStep, webStep)
+ * ------------------------------
+ * Creates the command queue and pins both tasks. After this, loop()
+ * has nothing left to do.
+ */
+void startTasks(uint32_t (*radarStep)(), void (*webStep)()) {
+  radarStepFn = radarStep;
+  webStepFn = webStep;
+  cmdQueue = xQueueCreate(CMD_QUEUE_LEN, sizeof(RadarCommand));
+
+  xTaskCreatePinnedToCore(radarTask, "radar", RADAR_TASK_STACK, NULL,
+                          RADAR_TASK_PRIO, NULL, RADAR_TASK_CORE);
+  xTaskCreatePinnedToCore(webTask, "web", WEB_TASK_STACK, NULL,
+                          WEB_TASK_PRIO, NULL, WEB_TASK_CORE);
+
+  Serial.println("[+] Radar task on core 1, web task on core 0");
+}
+
+#endif // TASKS_H
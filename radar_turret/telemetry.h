@@ -0,0 +1,143 @@
+/*
+ * ============================================================================
+ * RADAR TURRET TELEMETRY STREAM
+ * ============================================================================
+ *
+ * Server-Sent Events push channel on /events. Replaces the 100ms /status
+ * poll: every browser keeps one long-lived connection open and receives
+ * a frame whenever any snapshot field changes: the angle each sweep
+ * step, but also the reading, state, mode and last intrusion.
+ *
+ * FRAME FORMAT (one SSE "data:" line, same fields as /status):
+ *   data:<a>,<d>,<r>,<running>,<mode>,<li_a>,<li_d>,<sweep>
+ *
+ * The last frame is repeated every SSE_HEARTBEAT_MS so idle clients can
+ * tell a quiet radar from a dead link.
+ *
+ * Frames go out with a non-blocking send(): WiFiClient::write() keeps
+ * retrying a peer that left the AP for seconds, which would stall the
+ * sweep without THREADED_MODE. A subscriber whose socket is full misses
+ * that frame; after SSE_MAX_SKIPS misses in a row it is dropped.
+ *
+ * Other producers share the subscribers with named events
+ * (telemetryEvent()), e.g. mesh.h's fused targets:
+ *   event:<name>
+ *   data:<text>
+ * EventSource clients only see those if they listen for the name.
+ *
+ * USAGE:
+ *   server.on("/events", []() { telemetrySubscribe(server); });
+ *   telemetryPump();                 // web side, after handleClient()
+ *   telemetryEvent("mesh", text);    // web side
+ *
+ * ============================================================================
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <WiFi.h>
+#include <WebServer.h>
+#include <lwip/sockets.h>
+#include <errno.h>
+#include "tasks.h"
+
+#define SSE_MAX_CLIENTS   4
+#define SSE_HEARTBEAT_MS  2000
+#define SSE_MAX_SKIPS     25      // Frames missed in a row before a drop
+
+WiFiClient sseClients[SSE_MAX_CLIENTS];
+uint8_t sseSkips[SSE_MAX_CLIENTS];
+RadarSnapshot sseLast = {};
+bool sseForce = true;
+unsigned long tSseBeat = 0;
+
+/*
+ * telemetrySubscribe(srv)
+ * -----------------------
+ * Handler for /events. Takes over the request's socket and keeps it in
+ * a free subscriber slot.
+ */
+void telemetrySubscribe(WebServer &srv) {
+  int slot = -1;
+  for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+    if (!sseClients[i].connected()) { slot = i; break; }
+  }
+
+  if (slot < 0) {
+    srv.send_P(503, "text/plain", "BUSY");
+    return;
+  }
+
+  WiFiClient c = srv.client();
+  c.print("HTTP/1.1 200 OK\r\n"
+          "Content-Type: text/event-stream\r\n"
+          "Cache-Control: no-cache\r\n"
+          "Connection: keep-alive\r\n\r\n"
+          "retry: 1000\n\n");
+  sseClients[slot] = c;
+  sseSkips[slot] = 0;
+
+  // Drop the server's reference only; our copy keeps the socket open
+  // and the server is free to accept the next request right away.
+  srv.client().stop();
+
+  sseForce = true;  // Newcomer gets the current frame immediately
+}
+
+// Writes len bytes to every subscriber that can take them now. A full
+// socket skips the frame; an error, a torn frame or too many skips in a
+// row drop the subscriber.
+static void telemetrySend(const char *buf, int len) {
+  for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+    if (!sseClients[i].connected()) continue;
+    int n = send(sseClients[i].fd(), buf, len, MSG_DONTWAIT);
+    if (n == len) {
+      sseSkips[i] = 0;
+      continue;
+    }
+    bool full = n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+    if (full && ++sseSkips[i] < SSE_MAX_SKIPS) continue;
+    sseClients[i].stop();
+  }
+}
+
+/*
+ * telemetryPump()
+ * ---------------
+ * Broadcasts the snapshot if it changed (or the heartbeat is due).
+ * Never blocks on a slow client (telemetrySend()).
+ */
+void telemetryPump() {
+  RadarSnapshot s;
+  snapshotRead(s);
+
+  unsigned long now = millis();
+  bool changed = memcmp(&s, &sseLast, sizeof(s)) != 0;
+  if (!changed && !sseForce && now - tSseBeat < SSE_HEARTBEAT_MS) return;
+
+  sseLast = s;
+  sseForce = false;
+  tSseBeat = now;
+
+  char buf[64];
+  int len = snprintf(buf, sizeof(buf), "data:%d,%d,%d,%d,%d,%d,%d,%lu\n\n",
+                     s.angle, s.dist, s.range, s.running, s.mode,
+                     s.liAngle, s.liDist, (unsigned long)s.sweep);
+  telemetrySend(buf, len);
+}
+
+/*
+ * telemetryEvent(name, data)
+ * --------------------------
+ * Sends one named event to every subscriber. data is a single line.
+ * Web side.
+ */
+void telemetryEvent(const char *name, const char *data) {
+  char buf[192];
+  int len = snprintf(buf, sizeof(buf), "event:%s\ndata:%s\n\n", name, data);
+  if (len < 0 || len >= (int)sizeof(buf)) return;
+  telemetrySend(buf, len);
+}
+
+#endif // TELEMETRY_H
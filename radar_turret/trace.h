@@ -0,0 +1,440 @@
+/*
+ * ============================================================================
+ * RADAR TURRET SENSOR TRACE
+ * ============================================================================
+ *
+ * Raw capture of what the sensor reports, for tuning the background
+ * model and tracker on real data: while capturing, every burst result
+ * (time, angle, distance, and whether the pipeline called it a target)
+ * goes into a preallocated circular file, TRACE_PATH. A capture can be
+ * downloaded and replayed through the detection pipeline in place of
+ * the live sensor.
+ *
+ *   radar side:  traceRecord()       push (one flag test when idle)
+ *                traceReplayNext()   next due reading while replaying
+ *   web side:    tracePump()         file writes and reads, in batches
+ *
+ * Samples cross between the sides in a RAM ring, like eventlog.h: the
+ * radar side produces while capturing and the web side while replaying
+ * (the two never run together). A full ring drops samples and counts
+ * them (traceDropped).
+ *
+ * RECORD FORMAT (8 bytes, little-endian, see TraceSample):
+ *   ms u32      millis() of the reading
+ *   dist i16    cm, -1 = no echo
+ *   angle u8
+ *   flags u8    TRACEF_HIT
+ *
+ * FILE:
+ *   TRACE_FILE_SIZE bytes (profile.h sets it per board), zero-filled by
+ *   the first traceStart() so capturing never grows the file, then
+ *   overwritten in place as a ring. At 50 readings/s (SENTRY) 128KB is
+ *   about five and a half minutes. The write position is saved to
+ *   Preferences every TRACE_SYNC_RECS records and when capture stops;
+ *   after a reset mid-capture the samples since the last save are
+ *   lost.
+ *
+ * REPLAY:
+ *   Samples are fed in the order and with the spacing they were
+ *   captured; the scan servo follows the recorded angle. The radar must
+ *   be scanning. Intrusions it finds are logged with LOGF_REPLAY.
+ *
+ * TEXT FORMAT (/get_trace?fmt=csv):
+ *   "t_ms,angle,dist" lines, which tools/sim replays on the host (-t).
+ *
+ * ============================================================================
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <Arduino.h>
+#include <SPIFFS.h>
+#include <Preferences.h>
+#include <WebServer.h>
+#include "metrics.h"
+#include "xfer.h"
+
+#ifndef TRACE_FILE_SIZE
+#define TRACE_FILE_SIZE   131072
+#endif
+#define TRACE_PATH        "/trace.bin"
+#define TRACE_RING        256     // Samples held in RAM
+#define TRACE_BATCH       64      // Samples per file write or read
+#define TRACE_SYNC_RECS   4096    // Position saved this often (~80s)
+
+#define TRACEF_HIT        0x01    // The pipeline called it a target
+
+struct __attribute__((packed)) TraceSample {
+  uint32_t ms;
+  int16_t dist;
+  uint8_t angle;
+  uint8_t flags;
+};
+
+#define TRACE_RECS        (TRACE_FILE_SIZE / sizeof(TraceSample))
+
+TraceSample traceRing[TRACE_RING];
+volatile uint16_t traceHead = 0;        // Written by the producer
+volatile uint16_t traceTail = 0;        // Written by the consumer
+volatile bool traceCapturing = false;
+volatile bool traceReplaying = false;   // Cleared by the radar side at the end
+volatile bool traceFed = false;         // Replay: the last sample is in the ring
+volatile uint32_t traceDropped = 0;
+
+// File (web side only)
+Preferences tracePrefs;
+bool traceReady = false;        // File is preallocated
+uint32_t traceNext = 0;         // Record slot the next write goes to
+bool traceWrapped = false;      // Every slot holds a sample
+uint32_t traceUnsynced = 0;     // Records written since the last save
+uint32_t traceReadPos = 0;      // Replay: next record to read
+uint32_t traceReadLeft = 0;
+
+// Replay clock (radar side only)
+bool traceReplayArmed = false;  // Next sample is the first
+uint32_t traceReplayT0 = 0;
+unsigned long traceReplayStart = 0;
+
+static inline uint16_t tracePending() {
+  return (uint16_t)(traceHead - traceTail);
+}
+
+static void traceSave() {
+  tracePrefs.putUInt("next", traceNext);
+  tracePrefs.putBool("wrap", traceWrapped);
+  traceUnsynced = 0;
+}
+
+/*
+ * traceBegin()
+ * ------------
+ * Restores the write position. Call after SPIFFS.begin().
+ */
+void traceBegin() {
+  tracePrefs.begin("radar-trace", false);
+  traceNext = tracePrefs.getUInt("next", 0) % TRACE_RECS;
+  traceWrapped = tracePrefs.getBool("wrap", false);
+
+  traceReady = false;
+  if (SPIFFS.exists(TRACE_PATH)) {
+    File f = SPIFFS.open(TRACE_PATH, "r");
+    if (f) {
+      traceReady = f.size() == TRACE_RECS * sizeof(TraceSample);
+      f.close();
+    }
+  }
+  if (!traceReady) {
+    traceNext = 0;
+    traceWrapped = false;
+  }
+}
+
+/*
+ * traceCount()
+ * ------------
+ * Samples in the file.
+ */
+uint32_t traceCount() {
+  return traceWrapped ? TRACE_RECS : traceNext;
+}
+
+// Oldest sample's slot
+static inline uint32_t traceFirst() {
+  return traceWrapped ? traceNext : 0;
+}
+
+// Zero-fills the file once, so capture only ever overwrites in place
+static bool tracePrealloc() {
+  if (traceReady) return true;
+
+  File f = SPIFFS.open(TRACE_PATH, FILE_WRITE);
+  if (!f) return false;
+  static const uint8_t zero[256] = {};
+  size_t left = TRACE_RECS * sizeof(TraceSample);
+  while (left > 0) {
+    size_t n = f.write(zero, min(left, sizeof(zero)));
+    if (n == 0) break;
+    left -= n;
+  }
+  f.close();
+  traceReady = left == 0;
+  if (!traceReady) SPIFFS.remove(TRACE_PATH);
+  return traceReady;
+}
+
+/*
+ * traceRecord(angle, dist, hit)
+ * -----------------------------
+ * Queues one reading while capturing. Radar side.
+ */
+void traceRecord(int angle, int dist, bool hit) {
+  if (!traceCapturing) return;
+  if (tracePending() >= TRACE_RING) {
+    traceDropped = traceDropped + 1;
+    return;
+  }
+
+  TraceSample &s = traceRing[traceHead % TRACE_RING];
+  s.ms = millis();
+  s.dist = dist;
+  s.angle = angle;
+  s.flags = hit ? TRACEF_HIT : 0;
+
+  __sync_synchronize();
+  traceHead = traceHead + 1;
+}
+
+/*
+ * traceFlush()
+ * ------------
+ * Writes every queued capture sample with one open/close. Web side.
+ */
+void traceFlush() {
+  uint16_t head = traceHead;
+  __sync_synchronize();
+  if (head == traceTail || !traceReady) return;
+
+  METRIC_SCOPE(M_TRACE_IO);
+  File f = SPIFFS.open(TRACE_PATH, "r+");
+  if (!f) return;  // Keep them queued, retry next pump
+
+  uint16_t tail = traceTail;
+  f.seek(traceNext * sizeof(TraceSample));
+  while (tail != head) {
+    if (f.write((const uint8_t*)&traceRing[tail % TRACE_RING], sizeof(TraceSample)) != sizeof(TraceSample)) break;
+    tail++;
+    traceUnsynced++;
+    if (++traceNext >= TRACE_RECS) {
+      traceNext = 0;
+      traceWrapped = true;
+      f.seek(0);
+    }
+  }
+  f.close();
+
+  __sync_synchronize();
+  traceTail = tail;
+  if (traceUnsynced >= TRACE_SYNC_RECS) traceSave();
+}
+
+/*
+ * traceStart()
+ * ------------
+ * Starts a new capture over the old one (ends a replay). The first
+ * call zero-fills the file, which holds up the web side for a moment.
+ * Returns false if the file cannot be made. Web side.
+ */
+bool traceStart() {
+  traceCapturing = false;
+  traceReplaying = false;
+  if (!tracePrealloc()) return false;
+
+  traceTail = traceHead;
+  traceDropped = 0;
+  traceNext = 0;
+  traceWrapped = false;
+  traceSave();
+
+  __sync_synchronize();
+  traceCapturing = true;
+  Serial.println("[+] Trace capture started");
+  return true;
+}
+
+/*
+ * traceStop()
+ * -----------
+ * Ends a capture (writing what is queued) or a replay. Web side.
+ */
+void traceStop() {
+  if (traceCapturing) {
+    traceCapturing = false;
+    traceFlush();
+    traceSave();
+    Serial.printf("[+] Trace capture stopped, %lu samples\n", (unsigned long)traceCount());
+  }
+  traceReplaying = false;
+}
+
+/*
+ * traceReplayBegin()
+ * ------------------
+ * Ends a capture and rewinds the file to its oldest sample. Returns
+ * false if there is nothing to replay. Web side; the replay starts once
+ * the radar side calls traceReplayArm() (CMD_TRACE_REPLAY).
+ */
+bool traceReplayBegin() {
+  traceStop();
+  if (traceCount() == 0) return false;
+
+  traceReadPos = traceFirst();
+  traceReadLeft = traceCount();
+  traceFed = false;
+  return true;
+}
+
+/*
+ * traceReplayArm()
+ * ----------------
+ * Empties the ring and starts feeding the rewound file to
+ * traceReplayNext(). Radar side, so it can never meet a traceRecord()
+ * still in progress. A capture started since traceReplayBegin() wins.
+ */
+void traceReplayArm() {
+  if (traceCapturing) return;
+  traceTail = traceHead;
+  traceReplayArmed = true;
+
+  __sync_synchronize();
+  traceReplaying = true;
+  Serial.printf("[+] Replaying %lu trace samples\n", (unsigned long)traceReadLeft);
+}
+
+// Tops up the ring from the file, a batch at a time
+static void traceFeed() {
+  static TraceSample batch[TRACE_BATCH];
+  while (traceReadLeft > 0 && TRACE_RING - tracePending() >= TRACE_BATCH) {
+    uint32_t n = min(traceReadLeft, (uint32_t)TRACE_BATCH);
+    n = min(n, (uint32_t)(TRACE_RECS - traceReadPos));   // Up to the file's end
+
+    METRIC_SCOPE(M_TRACE_IO);
+    File f = SPIFFS.open(TRACE_PATH, "r");
+    if (!f) return;
+    f.seek(traceReadPos * sizeof(TraceSample));
+    n = f.read((uint8_t*)batch, n * sizeof(TraceSample)) / sizeof(TraceSample);
+    f.close();
+    if (n == 0) {
+      traceReadLeft = 0;
+      break;
+    }
+
+    uint16_t head = traceHead;
+    for (uint32_t i = 0; i < n; i++) traceRing[(head + i) % TRACE_RING] = batch[i];
+    __sync_synchronize();
+    traceHead = head + n;
+
+    traceReadPos = (traceReadPos + n) % TRACE_RECS;
+    traceReadLeft -= n;
+  }
+  if (traceReadLeft == 0) traceFed = true;
+}
+
+/*
+ * traceReplayNext(angle, dist)
+ * ----------------------------
+ * Hands out the next replayed reading once it is due (captured spacing,
+ * from the first sample on). Ends the replay after the last one.
+ * Radar side.
+ */
+bool traceReplayNext(int &angle, int &dist) {
+  if (tracePending() == 0) {
+    if (traceFed) {
+      traceReplaying = false;
+      Serial.println("[+] Trace replay done");
+    }
+    return false;
+  }
+
+  const TraceSample &s = traceRing[traceTail % TRACE_RING];
+  unsigned long now = millis();
+  if (traceReplayArmed) {
+    traceReplayArmed = false;
+    traceReplayT0 = s.ms;
+    traceReplayStart = now;
+  }
+  if (s.ms - traceReplayT0 > now - traceReplayStart) return false;
+
+  angle = s.angle;
+  dist = s.dist;
+  __sync_synchronize();
+  traceTail = traceTail + 1;
+  return true;
+}
+
+/*
+ * tracePump()
+ * -----------
+ * Writes capture samples a batch at a time, or keeps the replay fed.
+ * Call from the web side / loop().
+ */
+void tracePump() {
+  if (traceCapturing) {
+    if (tracePending() >= TRACE_BATCH) traceFlush();
+  } else if (traceReplaying) {
+    traceFeed();
+  }
+}
+
+// ============================================================================
+// DOWNLOAD
+// ============================================================================
+
+// Resumable position for one /get_trace transfer (xfer.h)
+struct TraceCursor {
+  uint32_t pos;         // Next record slot
+  uint32_t left;
+  bool text;
+};
+
+#define TRACE_LINE_MAX    24      // "4294967295,180,-1\n"
+
+static_assert(sizeof(TraceCursor) <= XFER_STATE_MAX, "TraceCursor too big for xfer.h");
+
+static bool traceCursorFill(void *state, uint8_t *buf, size_t cap, size_t &len) {
+  TraceCursor &c = *(TraceCursor*)state;
+  static TraceSample batch[TRACE_BATCH];
+  len = 0;
+  if (c.left == 0) return false;
+
+  uint32_t fit = c.text ? cap / TRACE_LINE_MAX : cap / sizeof(TraceSample);
+  uint32_t n = min(min(c.left, (uint32_t)TRACE_BATCH), fit);
+  n = min(n, (uint32_t)(TRACE_RECS - c.pos));
+
+  File f = SPIFFS.open(TRACE_PATH, "r");
+  if (f) {
+    f.seek(c.pos * sizeof(TraceSample));
+    n = f.read((uint8_t*)batch, n * sizeof(TraceSample)) / sizeof(TraceSample);
+    f.close();
+  } else {
+    n = 0;
+  }
+  if (n == 0) return false;
+
+  for (uint32_t i = 0; i < n; i++) {
+    const TraceSample &s = batch[i];
+    if (c.text) {
+      len += snprintf((char*)buf + len, cap - len, "%lu,%u,%d\n",
+                      (unsigned long)s.ms, s.angle, s.dist);
+    } else {
+      memcpy(buf + len, &s, sizeof(s));
+      len += sizeof(s);
+    }
+  }
+  c.pos = (c.pos + n) % TRACE_RECS;
+  c.left -= n;
+  return c.left > 0;
+}
+
+/*
+ * traceDownload(srv, text)
+ * ------------------------
+ * Starts a background transfer (xfer.h) of the file, oldest sample
+ * first: raw TraceSamples, or "t_ms,angle,dist" lines. A capture
+ * running meanwhile can overwrite the oldest samples under it.
+ */
+void traceDownload(WebServer &srv, bool text) {
+  traceFlush();
+
+  TraceCursor c;
+  c.pos = traceFirst();
+  c.left = traceReady ? traceCount() : 0;
+  c.text = text;
+
+  char hdr[40];
+  snprintf(hdr, sizeof(hdr), "X-Trace-Samples: %lu\r\n", (unsigned long)c.left);
+  xferStart(srv, text ? "text/csv" : "application/octet-stream",
+            traceCursorFill, &c, sizeof(c), hdr);
+}
+
+#endif // TRACE_H
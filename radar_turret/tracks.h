@@ -0,0 +1,267 @@
+/*
+ * ============================================================================
+ * RADAR TURRET TARGET TRACKER
+ * ============================================================================
+ *
+ * Small fixed table of targets so two people in the room are both kept,
+ * and locking on one no longer stops the sweep from finding the other.
+ *
+ * Each hit is associated with the nearest live track whose predicted
+ * position (angle, range + velocity * dt) is inside the gate; otherwise
+ * it starts a new track, replacing the stalest one if the table is full.
+ *
+ * PASSES:
+ *   The sonar cone is ~15 degrees wide, so one sweep over a target gives
+ *   a run of hits that moves with the beam, not with the target. Hits
+ *   closer together than TRACK_PASS_GAP_MS form one pass; the track
+ *   position is the centroid of the current pass, and velocity is only
+ *   measured from one pass centroid to the next (smoothed by TRACK_BETA).
+ *
+ * Tracks that are not seen for the hold time are dropped. The primary
+ * track (the one the arrow points at) is the closest live target.
+ *
+ * ARROW:
+ *   arrowStep() drives the arrow towards the primary track's predicted
+ *   angle (extrapolated ARROW_LEAD_MS ahead to hide servo lag), limited
+ *   to ARROW_RATE_DPS so it glides instead of jumping. A cue (arrowCue(),
+ *   a target only another turret sees, see mesh.h) is aimed at instead
+ *   when it is closer than the primary track, for up to ARROW_CUE_MS
+ *   after the last refresh. With neither it glides back to center.
+ *
+ * Radar side only.
+ *
+ * ============================================================================
+ */
+
+#ifndef TRACKS_H
+#define TRACKS_H
+
+#include <Arduino.h>
+
+#define TRACK_MAX           4
+#define TRACK_GATE_DEG      12     // Association gate, angle
+#define TRACK_GATE_CM       30     // Association gate, range
+#define TRACK_PASS_GAP_MS   300    // Gap that ends a pass over a target
+#define TRACK_BETA          0.5f   // Velocity smoothing (per pass)
+#define TRACK_PREDICT_MS    1500   // Never extrapolate further than this
+#define TRACK_MIN_HOLD_MS   3000   // Survive at least one sweep round trip
+#define ARROW_RATE_DPS      240    // Arrow slew limit
+#define ARROW_LEAD_MS       80     // Arrow servo lag to aim ahead by
+#define ARROW_CUE_MS        1000   // A cue holds this long without a refresh
+
+#define ARROW_CUE(angle, dist)  ((angle) | ((dist) << 8))   // CMD_CUE arg
+
+struct Track {
+  bool used;
+  float angle;          // deg, centroid of the current pass
+  float dist;           // cm
+  float vAngle;         // deg/s, pass to pass
+  float vDist;          // cm/s
+  unsigned long born;   // millis() of the first hit
+  unsigned long seen;   // millis() of the last hit
+  uint16_t hits;
+
+  // Current pass
+  float sumA, sumD;
+  uint16_t n;
+  unsigned long passStart;
+
+  // Previous pass centroid
+  float prevA, prevD;
+  unsigned long prevT;
+  bool hasPrev;
+};
+
+Track tracks[TRACK_MAX];
+
+/*
+ * trackClear()
+ * ------------
+ * Drops every track.
+ */
+void trackClear() {
+  memset(tracks, 0, sizeof(tracks));
+}
+
+// Time the current pass centroid refers to
+static inline unsigned long trackMid(const Track &t) {
+  return t.passStart + (t.seen - t.passStart) / 2;
+}
+
+/*
+ * trackPredict(t, now, angle, dist)
+ * ---------------------------------
+ * Extrapolates a track to time now (at most TRACK_PREDICT_MS ahead).
+ */
+void trackPredict(const Track &t, unsigned long now, float &angle, float &dist) {
+  float dt = min(now - trackMid(t), (unsigned long)TRACK_PREDICT_MS) / 1000.0f;
+  angle = t.angle + t.vAngle * dt;
+  dist  = t.dist + t.vDist * dt;
+}
+
+// Closes the current pass: its centroid becomes a velocity sample
+static void trackEndPass(Track &t) {
+  unsigned long mid = trackMid(t);
+  if (t.hasPrev && mid > t.prevT) {
+    float dt = (mid - t.prevT) / 1000.0f;
+    t.vAngle += TRACK_BETA * ((t.angle - t.prevA) / dt - t.vAngle);
+    t.vDist  += TRACK_BETA * ((t.dist - t.prevD) / dt - t.vDist);
+  }
+  t.prevA = t.angle;
+  t.prevD = t.dist;
+  t.prevT = mid;
+  t.hasPrev = true;
+  t.n = 0;
+}
+
+static void trackAddHit(Track &t, int angle, int dist, unsigned long now) {
+  if (t.n == 0) {
+    t.sumA = 0;
+    t.sumD = 0;
+    t.passStart = now;
+  }
+  t.sumA += angle;
+  t.sumD += dist;
+  t.n++;
+  t.angle = t.sumA / t.n;
+  t.dist  = t.sumD / t.n;
+  t.seen = now;
+  t.hits++;
+}
+
+/*
+ * trackUpdate(angle, dist, now)
+ * -----------------------------
+ * Feeds one hit into the table. Returns true if it started a new track
+ * (a new target, worth logging), false if it refined an existing one.
+ */
+bool trackUpdate(int angle, int dist, unsigned long now) {
+  int best = -1;
+  float bestCost = 2.0f;
+
+  for (int i = 0; i < TRACK_MAX; i++) {
+    if (!tracks[i].used) continue;
+    float pa, pd;
+    trackPredict(tracks[i], now, pa, pd);
+    float da = fabsf(angle - pa);
+    float dd = fabsf(dist - pd);
+    if (da > TRACK_GATE_DEG || dd > TRACK_GATE_CM) continue;
+
+    float cost = da / TRACK_GATE_DEG + dd / TRACK_GATE_CM;
+    if (cost < bestCost) { bestCost = cost; best = i; }
+  }
+
+  if (best >= 0) {
+    Track &t = tracks[best];
+    if (now - t.seen > TRACK_PASS_GAP_MS) trackEndPass(t);
+    trackAddHit(t, angle, dist, now);
+    return false;
+  }
+
+  // New target: take a free slot, or the one seen longest ago
+  int slot = 0;
+  for (int i = 0; i < TRACK_MAX; i++) {
+    if (!tracks[i].used) { slot = i; break; }
+    if (tracks[i].seen < tracks[slot].seen) slot = i;
+  }
+
+  Track &t = tracks[slot];
+  memset(&t, 0, sizeof(t));
+  t.used = true;
+  t.born = now;
+  trackAddHit(t, angle, dist, now);
+  return true;
+}
+
+/*
+ * trackExpire(now, holdMs)
+ * ------------------------
+ * Drops tracks not seen for holdMs (floored at TRACK_MIN_HOLD_MS).
+ * Returns the number of live tracks.
+ */
+int trackExpire(unsigned long now, unsigned long holdMs) {
+  holdMs = max(holdMs, (unsigned long)TRACK_MIN_HOLD_MS);
+
+  int live = 0;
+  for (int i = 0; i < TRACK_MAX; i++) {
+    if (!tracks[i].used) continue;
+    if (now - tracks[i].seen > holdMs) tracks[i].used = false;
+    else live++;
+  }
+  return live;
+}
+
+/*
+ * trackPrimary()
+ * --------------
+ * Index of the highest-priority (closest) live track, or -1.
+ */
+int trackPrimary() {
+  int best = -1;
+  for (int i = 0; i < TRACK_MAX; i++) {
+    if (!tracks[i].used) continue;
+    if (best < 0 || tracks[i].dist < tracks[best].dist) best = i;
+  }
+  return best;
+}
+
+// ============================================================================
+// ARROW
+// ============================================================================
+
+float arrowSet = 90;              // Rate-limited setpoint (deg)
+unsigned long tArrow = 0;
+int arrowCueAngle = -1;           // -1 = no cue
+int arrowCueDist = 0;
+unsigned long tArrowCue = 0;
+bool arrowSettled = true;         // Setpoint is where arrowStep() wants it
+
+/*
+ * arrowReset(angle)
+ * -----------------
+ * Syncs the setpoint after the arrow was written directly (centering).
+ */
+void arrowReset(int angle) {
+  arrowSet = angle;
+  tArrow = millis();
+}
+
+/*
+ * arrowCue(cue)
+ * -------------
+ * Takes a CMD_CUE argument: ARROW_CUE(angle, cm), or -1 for none.
+ */
+void arrowCue(int cue) {
+  arrowCueAngle = cue < 0 ? -1 : constrain(cue & 0xFF, 0, 180);
+  arrowCueDist = cue < 0 ? 0 : cue >> 8;
+  tArrowCue = millis();
+}
+
+/*
+ * arrowStep(now)
+ * --------------
+ * Moves the setpoint towards the primary track's predicted angle, a
+ * closer cue, or center with neither, by at most ARROW_RATE_DPS. Call
+ * every pass.
+ * Returns the angle to write to the arrow servo.
+ */
+int arrowStep(unsigned long now) {
+  float target = 90;
+  int p = trackPrimary();
+  bool cued = arrowCueAngle >= 0 && now - tArrowCue < ARROW_CUE_MS;
+  if (cued && (p < 0 || arrowCueDist < tracks[p].dist)) {
+    target = arrowCueAngle;
+  } else if (p >= 0) {
+    float pd;
+    trackPredict(tracks[p], now + ARROW_LEAD_MS, target, pd);
+  }
+  target = constrain(target, 0.0f, 180.0f);
+
+  float maxStep = ARROW_RATE_DPS * (now - tArrow) / 1000.0f;
+  tArrow = now;
+  arrowSet += constrain(target - arrowSet, -maxStep, maxStep);
+  arrowSettled = fabsf(target - arrowSet) < 0.5f;
+  return (int)(arrowSet + 0.5f);
+}
+
+#endif // TRACKS_H
@@ -7,7 +7,7 @@
  * It is included by the main .ino file and served to connected clients.
  * 
  * FEATURES:
- *   - Real-time radar visualization with canvas
+ *   - Real-time radar visualization with canvas (SSE push on /events)
  *   - Mode selection buttons (SENTRY, STEALTH, AGGRESSIVE, PARTY)
  *   - Start/Stop scanning control
  *   - Configuration modal for settings
@@ -354,6 +354,16 @@ const char INDEX_HTML[] PROGMEM = R"rawliteral(
       </div>
     </div>
     
+    <div class="setting">
+      <label>PINGS / STEP</label>
+      <div class="controls">
+        <button class="adj-btn" onclick="adjust('samp',-1)">-</button>
+        <input type="range" id="cfg-samp" min="1" max="5" oninput="updateVal('samp')">
+        <button class="adj-btn" onclick="adjust('samp',1)">+</button>
+        <span class="val" id="val-samp">3</span>
+      </div>
+    </div>
+    
     <div class="modal-actions">
       <button class="btn" onclick="resetSettings()">RESET</button>
       <button class="btn" onclick="saveSettings()">SAVE</button>
@@ -374,6 +384,11 @@ let currentMode = 0;
 let isRunning = false;
 let isOffline = true;
 let objects = [];
+let lastFrame = 0;
+let lastDraw = 0;
+let sweepId = -1;
+let cells = [];       // Device's per-degree table, patched by deltas
+let sweepBase = -1;   // Sweep ID of the last frame applied, -1 = none
 
 const modeNames = ['sentry', 'stealth', 'aggressive', 'party'];
 const modeColors = ['#0f0', '#666', '#f00', '#f0f'];
@@ -382,13 +397,22 @@ const modeColors = ['#0f0', '#666', '#f00', '#f0f'];
 function init() {
   resizeCanvas();
   window.addEventListener('resize', resizeCanvas);
-  draw();
+  requestAnimationFrame(frame);
   
   // Sync time with ESP32
   fetch('/time_sync?ts=' + Math.floor(Date.now() / 1000)).catch(() => {});
   
-  // Start polling
-  setInterval(pollStatus, 100);
+  // Live stream, or polling on browsers without EventSource
+  if (window.EventSource) {
+    connectStream();
+  } else {
+    setInterval(pollStatus, 100);
+  }
+  
+  // Heartbeat arrives every 2s; 5s of silence means the link is down
+  setInterval(() => {
+    if (Date.now() - lastFrame > 5000) goOffline();
+  }, 1000);
 }
 
 function resizeCanvas() {
@@ -399,36 +423,92 @@ function resizeCanvas() {
   canvas.height = height;
 }
 
-// ========== POLLING ==========
+// ========== STREAM ==========
+// One frame per sweep step: "a,d,r,running,mode,li_a,li_d,sweep"
+function connectStream() {
+  const es = new EventSource('/events');
+  es.onmessage = e => {
+    const v = e.data.split(',').map(Number);
+    applyStatus({ a: v[0], d: v[1], r: v[2], running: v[3], mode: v[4], li_a: v[5], li_d: v[6], sw: v[7] });
+  };
+  es.onerror = goOffline;  // EventSource reconnects by itself
+}
+
 function pollStatus() {
   fetch('/status')
     .then(r => r.ok ? r.json() : Promise.reject())
-    .then(data => {
-      isOffline = false;
-      scanAngle = data.a;
-      maxRange = data.r || 50;
-      currentMode = data.mode || 0;
-      isRunning = data.running === 1;
-      
-      // Add detected object
-      if (data.d > 0) {
-        objects.push({ a: data.a, r: data.d, life: 1.0 });
-      }
-      
-      // Update last detection
-      if (data.li_a && data.li_d) {
-        document.getElementById('last-detection').textContent = 
-          `LAST: ${data.li_d}cm @ ${data.li_a}°`;
-      }
-      
-      updateUI();
-      draw();
+    .then(applyStatus)
+    .catch(goOffline);
+}
+
+function applyStatus(data) {
+  isOffline = false;
+  lastFrame = Date.now();
+  scanAngle = data.a;
+  maxRange = data.r || 50;
+  currentMode = data.mode || 0;
+  isRunning = data.running === 1;
+  
+  // Add detected object
+  if (data.d > 0) {
+    objects.push({ a: data.a, r: data.d, life: 1.0 });
+  }
+  
+  // Sweep finished: fetch the degrees that changed and redraw the arc
+  if (data.sw !== undefined && data.sw !== sweepId) {
+    sweepId = data.sw;
+    loadSweep();
+  }
+  
+  // Update last detection
+  if (data.li_a && data.li_d) {
+    document.getElementById('last-detection').textContent = 
+      `LAST: ${data.li_d}cm @ ${data.li_a}°`;
+  }
+  
+  updateUI();
+}
+
+// ========== BINARY FRAMES ==========
+// See frame.h: 12-byte header, then 4-byte points (all little-endian)
+function parseFrame(buf) {
+  const v = new DataView(buf);
+  if (v.getUint8(0) !== 1) return null;  // FRAME_VERSION
+  const frame = {
+    type: v.getUint8(1),
+    sweep: v.getUint32(4, true),
+    ts: v.getUint32(8, true),
+    points: []
+  };
+  const count = v.getUint16(2, true);
+  for (let i = 0; i < count; i++) {
+    const o = 12 + i * 4;
+    frame.points.push({ a: v.getUint8(o), d: v.getUint16(o + 1, true), flags: v.getUint8(o + 3) });
+  }
+  return frame;
+}
+
+// FRAME_SWEEP (2) replaces the table, FRAME_DELTA (3) patches it
+function loadSweep() {
+  fetch(sweepBase < 0 ? '/sweep' : '/sweep?since=' + sweepBase)
+    .then(r => r.arrayBuffer())
+    .then(buf => {
+      const frame = parseFrame(buf);
+      if (!frame) return;
+      if (frame.type === 2) cells = [];
+      frame.points.forEach(p => cells[p.a] = p);
+      sweepBase = frame.sweep;
+      objects = cells
+        .filter(p => p.flags & 0x01)  // PT_HIT
+        .map(p => ({ a: p.a, r: p.d, life: 1.0 }));
     })
-    .catch(() => {
-      isOffline = true;
-      updateUI();
-      draw();
-    });
+    .catch(() => {});
+}
+
+function goOffline() {
+  isOffline = true;
+  sweepBase = -1;  // Device may have rebooted: start over with a full frame
+  updateUI();
 }
 
 function updateUI() {
@@ -453,6 +533,15 @@ function updateUI() {
 }
 
 // ========== RADAR DRAWING ==========
+// Renders at display rate; objects fade by elapsed time, not by frame count
+function frame(ts) {
+  const dt = lastDraw ? (ts - lastDraw) / 1000 : 0;
+  lastDraw = ts;
+  objects.forEach(obj => obj.life -= 0.2 * dt);
+  draw();
+  requestAnimationFrame(frame);
+}
+
 function draw() {
   ctx.fillStyle = '#000';
   ctx.fillRect(0, 0, width, height);
@@ -497,7 +586,6 @@ function draw() {
   ctx.fill();
   
   // Draw detected objects
-  objects.forEach(obj => obj.life -= 0.02);
   objects = objects.filter(obj => obj.life > 0);
   
   objects.forEach(obj => {
@@ -538,10 +626,9 @@ function openModal(name) {
   document.getElementById('modal-' + name).classList.add('active');
   
   if (name === 'logs') {
-    document.getElementById('log-text').value = 'Loading...';
-    fetch('/get_logs').then(r => r.text()).then(t => {
-      document.getElementById('log-text').value = t;
-    });
+    if (logCursor === 0) document.getElementById('log-text').value = 'Loading...';
+    tailLogs();
+    logTimer = setInterval(tailLogs, 2000);
   }
   
   if (name === 'config') {
@@ -550,15 +637,42 @@ function openModal(name) {
       setInput('lock', c.lck);
       setInput('min', c.min);
       setInput('max', c.max);
+      setInput('samp', c.smp);
     });
   }
 }
 
 function closeModal(name) {
   document.getElementById('modal-' + name).classList.remove('active');
+  if (name === 'logs') clearInterval(logTimer);
 }
 
 // ========== LOGS ==========
+// Live tail: only records after logCursor are fetched (X-Log-Cursor)
+let logCursor = 0;
+let logLines = [];
+let logTimer = null;
+
+function tailLogs() {
+  fetch('/get_logs?since=' + logCursor)
+    .then(r => {
+      const next = +r.headers.get('X-Log-Cursor') || 0;
+      return r.arrayBuffer().then(buf => ({ next, buf }));
+    })
+    .then(({ next, buf }) => {
+      if (next < logCursor) {           // Device log restarted
+        logCursor = 0;
+        logLines = [];
+        return tailLogs();
+      }
+      logCursor = next;
+      const text = renderLogs(buf);
+      if (text) logLines.push(text);
+      document.getElementById('log-text').value = logLines.join('\n') || '-- EMPTY --';
+    })
+    .catch(() => {});
+}
+
 function exportLogs() {
   const text = document.getElementById('log-text').value;
   const blob = new Blob([text], { type: 'text/csv' });
@@ -568,9 +682,27 @@ function exportLogs() {
   a.click();
 }
 
+// Binary log (eventlog.h): 8-byte records
+//   time u32, angle u8, flags u8 (low nibble mode, 0x80 epoch), dist u16
+function renderLogs(buf) {
+  const v = new DataView(buf);
+  const lines = [];
+  for (let o = 0; o + 8 <= buf.byteLength; o += 8) {
+    const t = v.getUint32(o, true);
+    const angle = v.getUint8(o + 4);
+    const flags = v.getUint8(o + 5);
+    const dist = v.getUint16(o + 6, true);
+    const name = (modeNames[flags & 0x0F] || 'intrusion').toUpperCase();
+    const ts = (flags & 0x80) ? new Date(t * 1000).toTimeString().slice(0, 8) : t;
+    lines.push(`[${ts}] ${name}: ${dist}cm @ ${angle}°`);
+  }
+  return lines.join('\n');
+}
+
 function wipeLogs() {
   if (confirm('Delete all logs?')) {
     fetch('/clear_logs');
+    logLines = [];
     document.getElementById('log-text').value = '[CLEARED]';
   }
 }
@@ -599,7 +731,8 @@ function saveSettings() {
     d: document.getElementById('cfg-dist').value,
     l: document.getElementById('cfg-lock').value,
     mn: document.getElementById('cfg-min').value,
-    mx: document.getElementById('cfg-max').value
+    mx: document.getElementById('cfg-max').value,
+    sm: document.getElementById('cfg-samp').value
   });
   fetch('/save_config?' + params);
   closeModal('config');
@@ -0,0 +1,760 @@
+/*
+ * ============================================================================
+ * RADAR TURRET COMPRESSED DASHBOARDS
+ * ============================================================================
+ *
+ * GENERATED by tools/gzip_web.py - do not edit, re-run the script instead.
+ *
+ * ============================================================================
+ */
+
+#ifndef WEB_GZ_H
+#define WEB_GZ_H
+
+// index_html (radar_turret.ino): 19771 bytes -> 5878 bytes gzipped
+#define V2_INDEX_ETAG "\"e68d0932a10ca4e6\""
+const size_t V2_INDEX_GZ_LEN = 5878;
+const uint8_t V2_INDEX_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x3c, 0xeb, 0x5a, 0xdb, 0x56,
+  0xb6, 0xff, 0xf3, 0x14, 0xbb, 0x4e, 0xa7, 0x96, 0x8a, 0x2d, 0x6c, 0x83, 0x73, 0xa8, 0x8d, 0xc9,
+  0x50, 0xe2, 0xa4, 0x7c, 0x87, 0x00, 0x1f, 0x26, 0x6d, 0x67, 0x38, 0x7c, 0xa9, 0x6c, 0x6d, 0x19,
+  0x35, 0xb2, 0xa4, 0x4a, 0xb2, 0x81, 0x32, 0xbc, 0xd3, 0x3c, 0xc3, 0x3c, 0xd9, 0x59, 0x6b, 0xed,
+  0x8b, 0xb6, 0x64, 0x1b, 0x08, 0x69, 0xe6, 0x4b, 0x1a, 0xa4, 0x7d, 0x59, 0x7b, 0xdd, 0x6f, 0xda,
+  0xf4, 0xc5, 0xee, 0x37, 0x6f, 0x4e, 0x0e, 0xce, 0xff, 0x71, 0x3a, 0x64, 0x57, 0xf9, 0x2c, 0xdc,
+  0x7b, 0xb1, 0x8b, 0x3f, 0x58, 0xe8, 0x46, 0xd3, 0x41, 0x8d, 0x47, 0x35, 0x1c, 0xe0, 0xae, 0x07,
+  0x3f, 0x66, 0x3c, 0x77, 0xd9, 0xe4, 0xca, 0x4d, 0x33, 0x9e, 0x0f, 0x6a, 0x1f, 0xce, 0xdf, 0x36,
+  0x77, 0x6a, 0x6a, 0x38, 0x72, 0x67, 0x7c, 0x50, 0x5b, 0x04, 0xfc, 0x3a, 0x89, 0xd3, 0xbc, 0xc6,
+  0x26, 0x71, 0x94, 0xf3, 0x08, 0x96, 0x5d, 0x07, 0x5e, 0x7e, 0x35, 0xf0, 0xf8, 0x22, 0x98, 0xf0,
+  0x26, 0xbd, 0x34, 0x58, 0x10, 0x05, 0x79, 0xe0, 0x86, 0xcd, 0x6c, 0xe2, 0x86, 0x7c, 0xd0, 0x76,
+  0x5a, 0x0d, 0x36, 0xcf, 0x78, 0x4a, 0xef, 0xee, 0x18, 0x86, 0xa2, 0x18, 0x01, 0xe7, 0x41, 0x1e,
+  0xf2, 0xbd, 0xb3, 0xfd, 0x37, 0xfb, 0x67, 0xbb, 0x9b, 0xe2, 0xe5, 0xc5, 0x6e, 0x96, 0xdf, 0xe2,
+  0x4f, 0xc6, 0x7a, 0x69, 0x1c, 0xe7, 0xec, 0x8e, 0x35, 0x9b, 0xe3, 0x69, 0x8f, 0xbd, 0x6c, 0xb5,
+  0x5a, 0x7d, 0x78, 0xf6, 0xf1, 0xd9, 0xf7, 0x7d, 0x7c, 0xf6, 0x82, 0x19, 0xbc, 0x74, 0x3a, 0x1d,
+  0x7c, 0x71, 0x27, 0x13, 0xc0, 0x07, 0x17, 0xfa, 0xb0, 0xf0, 0x1e, 0x00, 0x7c, 0x0f, 0x9b, 0xc7,
+  0xf1, 0x4d, 0x33, 0x0b, 0xfe, 0x0c, 0x22, 0xd8, 0x36, 0x8e, 0x53, 0x0f, 0x90, 0x80, 0x21, 0x31,
+  0x3f, 0x8e, 0xbd, 0x5b, 0x5c, 0xe2, 0x4e, 0x3e, 0x4d, 0xd3, 0x78, 0x1e, 0x79, 0x3d, 0xb6, 0x70,
+  0x53, 0x0b, 0xcf, 0xb3, 0xfb, 0x40, 0x60, 0x18, 0xa7, 0x6a, 0xc4, 0xc7, 0x11, 0x1f, 0x48, 0x6e,
+  0xfa, 0xee, 0x2c, 0x08, 0x6f, 0x7b, 0xac, 0x7e, 0x10, 0xcf, 0xd3, 0x80, 0xa7, 0xec, 0x98, 0x5f,
+  0xd7, 0x1b, 0x6c, 0x16, 0x47, 0x71, 0x96, 0xb8, 0x13, 0xde, 0x67, 0x33, 0x37, 0x9d, 0x06, 0x51,
+  0x8f, 0x01, 0x16, 0x89, 0xeb, 0x79, 0x74, 0x34, 0x3c, 0xc7, 0x0b, 0x9e, 0xfa, 0x61, 0x7c, 0xdd,
+  0x63, 0x57, 0x81, 0xe7, 0xf1, 0xa8, 0xcf, 0xae, 0x78, 0x30, 0xbd, 0x02, 0x8c, 0xdb, 0xad, 0xd6,
+  0xe2, 0xaa, 0xcf, 0xbc, 0x20, 0x4b, 0x42, 0x17, 0x40, 0xfb, 0x21, 0x07, 0x0c, 0xf1, 0x5f, 0xa0,
+  0x30, 0xe5, 0x93, 0x3c, 0x88, 0x01, 0x1c, 0xe0, 0x33, 0x9f, 0xc1, 0x2e, 0x37, 0x0c, 0xa6, 0x51,
+  0x33, 0xc8, 0xf9, 0x2c, 0x83, 0x41, 0x20, 0x99, 0xa7, 0x7d, 0xf6, 0xfb, 0x3c, 0xcb, 0x03, 0xff,
+  0xb6, 0x29, 0xa5, 0x52, 0x4c, 0x20, 0x9d, 0xf0, 0xf7, 0x65, 0xea, 0x7a, 0x2e, 0x91, 0x0e, 0x04,
+  0x27, 0x71, 0x16, 0x08, 0x98, 0x29, 0x0f, 0xdd, 0x3c, 0x58, 0x00, 0xd2, 0x24, 0x38, 0x42, 0xe5,
+  0x6f, 0x48, 0xc1, 0x4d, 0x53, 0x0e, 0xbc, 0x6a, 0xb5, 0x92, 0x9b, 0x02, 0xd5, 0xad, 0x2e, 0xbd,
+  0x56, 0x50, 0x5d, 0x7b, 0x7a, 0x09, 0x57, 0x22, 0x88, 0x47, 0xde, 0x2a, 0x56, 0x20, 0x9a, 0x13,
+  0x37, 0x5a, 0xb8, 0x19, 0xe0, 0x57, 0xc2, 0xc5, 0x60, 0xd2, 0xdf, 0x8c, 0x83, 0xc7, 0x61, 0x3c,
+  0xf9, 0xd4, 0x2f, 0xc9, 0x4e, 0x68, 0xc8, 0xfd, 0x0b, 0x00, 0xe5, 0xcc, 0x83, 0xe6, 0x38, 0x8f,
+  0x00, 0x16, 0xbc, 0xb0, 0x15, 0xab, 0x96, 0x85, 0x2b, 0x94, 0x03, 0xce, 0x49, 0x6e, 0x58, 0x16,
+  0x87, 0x81, 0x67, 0x4e, 0x6a, 0x39, 0xee, 0xc0, 0x6c, 0xfb, 0x15, 0xb2, 0x80, 0x00, 0x4f, 0xe6,
+  0x69, 0x86, 0x70, 0x92, 0x38, 0x10, 0x04, 0x93, 0x8a, 0x80, 0xbe, 0x71, 0x00, 0xd4, 0xc1, 0x65,
+  0x34, 0x70, 0x2d, 0x69, 0x18, 0xc7, 0x21, 0x50, 0x9f, 0xf3, 0x9b, 0xbc, 0x99, 0xa7, 0x6e, 0x94,
+  0xf9, 0x71, 0x0a, 0x0a, 0x3c, 0x4f, 0x12, 0x9e, 0x4e, 0xdc, 0x8c, 0x4b, 0xa0, 0x34, 0x25, 0x05,
+  0xe4, 0x86, 0x21, 0x6b, 0x39, 0x9d, 0xac, 0x0f, 0x33, 0xf7, 0x05, 0x61, 0xbd, 0x2b, 0x64, 0xe1,
+  0x4a, 0xdd, 0xf5, 0x97, 0x74, 0x97, 0xb4, 0xd9, 0xdc, 0xec, 0x4e, 0x50, 0xe6, 0x95, 0xdd, 0x2f,
+  0x77, 0x76, 0x76, 0x4a, 0xcb, 0x9c, 0x95, 0xcb, 0x04, 0x48, 0x61, 0x6b, 0xc5, 0x41, 0x82, 0xa9,
+  0xd2, 0xbe, 0x4a, 0x87, 0xeb, 0x95, 0x26, 0x64, 0x0f, 0x5c, 0x8f, 0x40, 0xbf, 0xb4, 0xe3, 0xa5,
+  0xdf, 0xed, 0x16, 0x20, 0xe9, 0x65, 0x79, 0xd7, 0x4a, 0xd2, 0xcb, 0x3b, 0xa5, 0x1e, 0x08, 0xc5,
+  0x47, 0xd7, 0x46, 0xeb, 0x0b, 0xad, 0x77, 0xc7, 0x20, 0xe0, 0x79, 0x0e, 0xfc, 0xce, 0xe3, 0x84,
+  0x6c, 0xb3, 0xa4, 0x71, 0x5a, 0xd8, 0xed, 0xee, 0x53, 0x74, 0x9d, 0xac, 0xbe, 0x39, 0xe6, 0xf9,
+  0x35, 0xe7, 0xeb, 0xcc, 0x73, 0x9d, 0x17, 0xfa, 0xb3, 0x19, 0x44, 0x1e, 0xbf, 0xc1, 0x93, 0x4b,
+  0x56, 0xb7, 0x23, 0xac, 0x0e, 0x69, 0x78, 0x49, 0x7e, 0x11, 0xf0, 0x37, 0x55, 0x6b, 0x67, 0x8d,
+  0x6a, 0x85, 0x3c, 0xcf, 0xd1, 0xcd, 0x02, 0x4a, 0x74, 0x16, 0xa9, 0xa0, 0x3e, 0x30, 0xcf, 0xe3,
+  0x19, 0x8d, 0xad, 0x55, 0x70, 0xbd, 0x68, 0x15, 0xe5, 0x2b, 0x29, 0x9b, 0xba, 0x09, 0x62, 0xaf,
+  0xb1, 0xcd, 0x72, 0x37, 0x9f, 0x67, 0xcd, 0xb1, 0xeb, 0x4d, 0xab, 0x48, 0xd3, 0x22, 0xcd, 0xdc,
+  0x2d, 0x40, 0x63, 0xa7, 0x40, 0xcf, 0x30, 0x3c, 0x8d, 0x31, 0xf8, 0xac, 0x60, 0x9e, 0x49, 0x2a,
+  0x96, 0xa0, 0x3b, 0x71, 0x14, 0x06, 0x11, 0x5f, 0xd6, 0x22, 0xf2, 0xff, 0xa5, 0x97, 0xe5, 0xbd,
+  0x10, 0x88, 0xa2, 0x08, 0xf0, 0x78, 0xca, 0x6e, 0x53, 0xd1, 0xd2, 0xe9, 0xd8, 0xb5, 0x5a, 0x8d,
+  0x4e, 0xb7, 0xdb, 0x68, 0x35, 0x5a, 0x4e, 0xdb, 0x5e, 0x05, 0x3c, 0x71, 0x21, 0xd8, 0x79, 0x2b,
+  0xd4, 0x7b, 0xc7, 0x00, 0x4d, 0x2f, 0x2b, 0x88, 0xf2, 0xfd, 0xd5, 0x54, 0xf9, 0x2d, 0x73, 0xb3,
+  0xa9, 0xe1, 0x60, 0x1b, 0x4d, 0xc4, 0x2f, 0x81, 0x4d, 0x15, 0x91, 0x19, 0xd2, 0x21, 0xef, 0x7b,
+  0x9d, 0xe2, 0x00, 0xfe, 0xbb, 0x42, 0x91, 0x0b, 0xff, 0xac, 0x20, 0xfb, 0x10, 0x80, 0xd7, 0xda,
+  0x8e, 0x52, 0x15, 0x01, 0xbe, 0x64, 0x41, 0x4f, 0x0d, 0x0f, 0x06, 0x7a, 0x25, 0x4b, 0x20, 0xb6,
+  0x84, 0x6e, 0x96, 0xc3, 0x60, 0x9e, 0xce, 0x33, 0x38, 0xb9, 0xa2, 0x4b, 0x6d, 0xdc, 0xa3, 0xb8,
+  0xa1, 0x3d, 0x17, 0x3a, 0x8b, 0x59, 0xec, 0xb9, 0xa1, 0xc9, 0x89, 0x28, 0x8e, 0x00, 0xdb, 0x82,
+  0x02, 0x3f, 0xb8, 0xe1, 0x5e, 0x61, 0xfa, 0x21, 0xf7, 0xf3, 0x65, 0x1f, 0x50, 0x8e, 0x3a, 0x2b,
+  0x34, 0x80, 0xfe, 0x38, 0x3f, 0x74, 0x6d, 0x03, 0xf5, 0x4e, 0xeb, 0xaf, 0x8a, 0xda, 0x78, 0xa0,
+  0x97, 0xc6, 0x49, 0xd3, 0x0f, 0xc2, 0x1c, 0x8d, 0x63, 0x1c, 0xce, 0x53, 0x0b, 0xec, 0x40, 0x39,
+  0x52, 0xa2, 0xb2, 0xf0, 0xd0, 0x15, 0x86, 0x17, 0x4b, 0x14, 0x68, 0x15, 0x09, 0x25, 0x91, 0x3f,
+  0x54, 0xa2, 0x7c, 0x57, 0x84, 0x75, 0x1c, 0x51, 0x94, 0xff, 0x40, 0x39, 0x89, 0x8a, 0xd4, 0x4d,
+  0x80, 0xed, 0xce, 0xf3, 0xb8, 0x2f, 0xe2, 0xa9, 0x34, 0xd9, 0xce, 0x83, 0xb1, 0xb2, 0x43, 0x4e,
+  0x64, 0x39, 0xf6, 0x4a, 0x10, 0xe0, 0x11, 0xaf, 0x5c, 0x0f, 0x93, 0x80, 0x16, 0xfc, 0xd9, 0x02,
+  0x04, 0x04, 0x6f, 0xd1, 0xb6, 0xd4, 0x7f, 0xc2, 0xc2, 0x9e, 0x98, 0x18, 0x09, 0x6d, 0xc2, 0x43,
+  0x55, 0xb0, 0x14, 0xba, 0x70, 0xd5, 0x01, 0xea, 0x75, 0x52, 0x06, 0x7f, 0x50, 0xe3, 0x58, 0x6b,
+  0xc9, 0x31, 0x16, 0x91, 0xff, 0xe5, 0xd6, 0xd6, 0xd6, 0xb2, 0x4f, 0x94, 0x76, 0x64, 0x68, 0xa1,
+  0xb3, 0x9d, 0xf2, 0xd9, 0xb2, 0xd7, 0x6d, 0x2b, 0x7f, 0x85, 0x38, 0x40, 0x2a, 0x9d, 0x0b, 0x47,
+  0xf3, 0x57, 0x04, 0x92, 0x22, 0x36, 0x3d, 0x4a, 0x43, 0xbb, 0xdd, 0x96, 0x9a, 0xa0, 0x50, 0x80,
+  0xd4, 0x9b, 0x87, 0x65, 0x43, 0x02, 0x15, 0x26, 0x12, 0x56, 0xc4, 0x12, 0xc4, 0x12, 0x00, 0x56,
+  0x60, 0x38, 0x93, 0x3c, 0x0d, 0x97, 0x89, 0x59, 0x1f, 0x1b, 0x76, 0x94, 0xf3, 0x01, 0x85, 0x78,
+  0x8a, 0xd3, 0x09, 0xa2, 0x64, 0x9e, 0x5f, 0xe4, 0xb7, 0x09, 0x54, 0x1b, 0x29, 0x46, 0xfc, 0xda,
+  0x25, 0xa2, 0xac, 0x90, 0x11, 0xf9, 0x44, 0x73, 0x39, 0x7f, 0x5b, 0x4a, 0xc5, 0x94, 0x22, 0x77,
+  0x4d, 0x69, 0xb8, 0xde, 0xef, 0x66, 0x62, 0x28, 0xd5, 0x5f, 0x68, 0xaa, 0xda, 0xb0, 0xac, 0xb7,
+  0x94, 0x91, 0x25, 0x6e, 0x0a, 0x27, 0x3f, 0x2d, 0x75, 0x7c, 0xb9, 0xbd, 0xbd, 0xbd, 0x2e, 0x45,
+  0x7c, 0x0a, 0xe7, 0xd6, 0x3a, 0x86, 0x65, 0x39, 0xd1, 0x21, 0xa6, 0x52, 0x52, 0x76, 0x6a, 0xe6,
+  0x90, 0x02, 0xbd, 0x72, 0x1a, 0x29, 0xf9, 0x50, 0x24, 0x53, 0x95, 0x60, 0x83, 0xf5, 0x55, 0xc9,
+  0x72, 0xb5, 0x36, 0xc1, 0x5f, 0x60, 0x45, 0xe4, 0x2c, 0x5c, 0xad, 0x4a, 0x65, 0xbd, 0x91, 0x3c,
+  0xdd, 0x26, 0x2e, 0x52, 0xae, 0x4b, 0x24, 0x82, 0xe7, 0xc4, 0x55, 0x65, 0x03, 0xda, 0x36, 0xdd,
+  0x38, 0x1d, 0x2a, 0x8f, 0xc0, 0x7d, 0xc0, 0x6f, 0x77, 0x5d, 0x35, 0xd0, 0x11, 0x0e, 0x6b, 0x19,
+  0x45, 0x05, 0x8c, 0x73, 0xbe, 0x52, 0x30, 0x64, 0xd9, 0x4f, 0x2c, 0xe4, 0x96, 0x92, 0xf9, 0x94,
+  0x8b, 0x37, 0x19, 0x52, 0x4c, 0x5b, 0x5c, 0x9f, 0xe3, 0xc5, 0xf3, 0x1c, 0x23, 0xba, 0xda, 0xa5,
+  0x35, 0x91, 0xbc, 0x57, 0xf6, 0x60, 0xcc, 0x16, 0x4e, 0xab, 0x49, 0xa1, 0xaa, 0x43, 0x23, 0x0f,
+  0xd8, 0xcf, 0x52, 0x80, 0x97, 0x27, 0xf5, 0x7a, 0x20, 0xa0, 0xf1, 0xa7, 0x00, 0x48, 0x99, 0xa4,
+  0x71, 0x18, 0x8e, 0xdd, 0xb4, 0xe0, 0xea, 0x2b, 0x65, 0x1c, 0x2b, 0x56, 0x35, 0xf3, 0xab, 0xf9,
+  0x6c, 0x5c, 0xcd, 0xb4, 0x89, 0x81, 0x95, 0x04, 0x6d, 0x4b, 0x40, 0xd9, 0xdd, 0x94, 0xb5, 0xfb,
+  0xee, 0xa6, 0x6c, 0x28, 0x60, 0x85, 0xbd, 0x87, 0x05, 0xd9, 0xae, 0x17, 0x2c, 0x58, 0xe0, 0x0d,
+  0x6a, 0x22, 0x1d, 0xaf, 0xed, 0x91, 0xda, 0xea, 0x51, 0xca, 0x71, 0xe5, 0x20, 0x63, 0xd4, 0x10,
+  0x60, 0xe7, 0x1f, 0xce, 0xce, 0x86, 0xe7, 0x72, 0x68, 0x17, 0x75, 0x8e, 0x96, 0x9a, 0xd9, 0x52,
+  0x8d, 0x4d, 0x20, 0x4b, 0xc8, 0x06, 0x35, 0x99, 0x35, 0xd5, 0xf6, 0x4e, 0xde, 0xbe, 0x3d, 0x3a,
+  0x3c, 0x1e, 0x02, 0x26, 0xb0, 0x5e, 0x1e, 0xb2, 0x09, 0xa7, 0x54, 0xce, 0xd3, 0x29, 0x93, 0x3e,
+  0x73, 0x77, 0x3c, 0x07, 0x0f, 0x1a, 0x29, 0x80, 0xa2, 0xe4, 0xa8, 0xe9, 0xc5, 0x79, 0x3c, 0x9d,
+  0x02, 0x86, 0x2c, 0x8e, 0x26, 0x61, 0x30, 0xf9, 0x04, 0x18, 0xd3, 0xc0, 0x08, 0xd2, 0x48, 0xcb,
+  0xae, 0xed, 0x5d, 0xb0, 0xd1, 0xf9, 0xfe, 0xd9, 0x39, 0xbb, 0xdc, 0xdd, 0x14, 0x70, 0x1e, 0x01,
+  0xab, 0xc1, 0xc4, 0x09, 0x8f, 0x8e, 0xe2, 0x69, 0x26, 0x80, 0x1c, 0x9d, 0xbc, 0x1b, 0x3d, 0x0f,
+  0xc6, 0x41, 0x1c, 0xf9, 0xc1, 0x54, 0x40, 0x39, 0x38, 0x39, 0x7e, 0x7b, 0xf8, 0xae, 0x0a, 0x47,
+  0xb3, 0x41, 0x3e, 0x98, 0x42, 0xd1, 0xcd, 0x01, 0x25, 0x17, 0x59, 0x8a, 0xeb, 0xb9, 0x03, 0x7a,
+  0xaf, 0xed, 0xed, 0x6e, 0x8a, 0x19, 0x03, 0x0e, 0xe9, 0x98, 0x86, 0x24, 0x32, 0x46, 0x05, 0x46,
+  0x0b, 0xad, 0x9c, 0xcb, 0xd5, 0xf6, 0x9a, 0xcd, 0x92, 0x84, 0x1e, 0x21, 0x30, 0xe7, 0x59, 0xbe,
+  0x1f, 0xf2, 0x34, 0x07, 0xfa, 0x18, 0xa9, 0xd8, 0xa0, 0xa6, 0x8c, 0x6f, 0x5b, 0x96, 0x11, 0x85,
+  0xad, 0x92, 0xe9, 0xd4, 0xf6, 0xce, 0x87, 0xa3, 0xf3, 0x0a, 0x07, 0x1e, 0x39, 0x46, 0xf8, 0xd8,
+  0x11, 0x4f, 0x17, 0x71, 0xf6, 0x39, 0x27, 0x1d, 0x0c, 0x8f, 0xcf, 0x87, 0x67, 0xe6, 0x59, 0x2b,
+  0x58, 0x2c, 0xb2, 0xb1, 0x10, 0x44, 0xad, 0x95, 0x96, 0x86, 0x4c, 0x4b, 0x30, 0xc7, 0x95, 0x85,
+  0x17, 0x0a, 0x7a, 0xd5, 0xd9, 0x1b, 0x0d, 0x0f, 0x3e, 0x9c, 0x1d, 0x9e, 0xff, 0x83, 0x14, 0x05,
+  0x8c, 0xac, 0xa3, 0x27, 0xb5, 0xbf, 0x24, 0x6e, 0xc7, 0xd3, 0xa6, 0x74, 0x2a, 0x35, 0xf0, 0x59,
+  0x90, 0x64, 0x45, 0xe1, 0xed, 0xde, 0x51, 0xec, 0x22, 0x1d, 0x8e, 0xe3, 0xec, 0x6e, 0xaa, 0xe5,
+  0x7a, 0xbf, 0x71, 0xbc, 0x74, 0x4c, 0xfa, 0xe0, 0xc7, 0x19, 0x07, 0x49, 0x5c, 0x14, 0x02, 0x74,
+  0xa5, 0xc8, 0xc3, 0x5f, 0x4f, 0x4f, 0xce, 0xce, 0xab, 0x6a, 0xbc, 0x06, 0x0e, 0x13, 0x65, 0xbd,
+  0x29, 0x87, 0x90, 0xbb, 0xa9, 0x82, 0xf5, 0xcb, 0xe1, 0xe9, 0xf0, 0x89, 0x90, 0x4a, 0x20, 0xe2,
+  0x8c, 0xbf, 0x47, 0x3e, 0x5a, 0xf5, 0x82, 0xf3, 0x75, 0x80, 0x77, 0x70, 0x74, 0x32, 0x5a, 0x02,
+  0x68, 0xba, 0x88, 0x07, 0xcc, 0x44, 0x0b, 0x06, 0x4c, 0xed, 0x4b, 0xa4, 0xf8, 0x8f, 0xd1, 0xf9,
+  0xf0, 0xbd, 0x34, 0x53, 0x53, 0x8a, 0x2b, 0x84, 0x21, 0xd3, 0x2e, 0x53, 0x18, 0x94, 0xc5, 0xed,
+  0x8d, 0x0e, 0xf6, 0x8f, 0xd9, 0xe8, 0x74, 0x38, 0x7c, 0xc3, 0xac, 0x59, 0x66, 0xef, 0x6e, 0x8a,
+  0xe1, 0x62, 0x99, 0x01, 0x04, 0x53, 0x36, 0x03, 0xc2, 0x12, 0xfb, 0x64, 0x32, 0x60, 0xf0, 0x0f,
+  0x46, 0xac, 0xfa, 0xc4, 0x9f, 0x42, 0x4e, 0xcb, 0xb9, 0x07, 0x51, 0xb1, 0xd9, 0x06, 0xde, 0x35,
+  0x97, 0x05, 0x01, 0xb0, 0x28, 0x61, 0x63, 0x66, 0xc2, 0x46, 0xcc, 0xd2, 0xbb, 0x6b, 0x6c, 0x16,
+  0x44, 0x83, 0x5a, 0xb7, 0x86, 0xe5, 0xc5, 0xa0, 0x06, 0x71, 0xfc, 0x0b, 0x71, 0x41, 0x54, 0x36,
+  0x56, 0xa2, 0xa2, 0xfd, 0xcd, 0x02, 0x7b, 0xcf, 0xe2, 0x70, 0x09, 0x77, 0x81, 0x42, 0x32, 0x9d,
+  0x4e, 0x45, 0xee, 0x95, 0x97, 0xcf, 0x11, 0xc5, 0xfb, 0xfd, 0x5f, 0x21, 0x64, 0x1d, 0xbf, 0x1b,
+  0x32, 0x6b, 0x32, 0xfb, 0x6a, 0x92, 0x00, 0x83, 0xce, 0x51, 0x10, 0xdd, 0xe7, 0x08, 0x02, 0x37,
+  0x4b, 0x39, 0xb4, 0x5b, 0x52, 0x10, 0x9d, 0x67, 0x0b, 0x42, 0xa2, 0xd2, 0x7d, 0x9a, 0x1c, 0xc4,
+  0xd9, 0x5f, 0x5f, 0x0c, 0x47, 0x27, 0x07, 0xff, 0xcb, 0xce, 0x0f, 0xdf, 0x0f, 0xbf, 0xaa, 0x41,
+  0x60, 0xdb, 0x99, 0xec, 0xa1, 0xd5, 0x7a, 0x8e, 0x20, 0x70, 0xbb, 0x32, 0x88, 0x96, 0x92, 0x04,
+  0x3c, 0xb5, 0x30, 0xdc, 0xf0, 0xe4, 0x4b, 0xcc, 0x43, 0x62, 0x26, 0x10, 0x7b, 0x82, 0x5c, 0x04,
+  0x2a, 0x5f, 0x5f, 0x2e, 0x3f, 0x9e, 0x1d, 0xbe, 0xfb, 0xe9, 0xfc, 0x78, 0x38, 0x1a, 0x7d, 0x2d,
+  0x99, 0x8c, 0xa9, 0xb2, 0x10, 0x52, 0x79, 0x8e, 0x50, 0xc4, 0x7e, 0x29, 0x16, 0x6d, 0x1e, 0xdd,
+  0xee, 0x97, 0xa2, 0xd3, 0x7e, 0xa2, 0x24, 0xd4, 0xf9, 0xff, 0x05, 0x57, 0x75, 0x78, 0xcc, 0xc0,
+  0x53, 0x1d, 0x0d, 0xbf, 0x96, 0x28, 0x80, 0x85, 0xcf, 0x76, 0x52, 0xb0, 0xb7, 0x22, 0x83, 0x9d,
+  0xd6, 0x17, 0xa1, 0xf1, 0x44, 0x07, 0x45, 0xe7, 0x7e, 0x11, 0xef, 0x9f, 0x1e, 0x27, 0xbe, 0x2e,
+  0xf3, 0xdd, 0x9b, 0xe7, 0x33, 0xdf, 0xbd, 0xd1, 0x01, 0x42, 0xb1, 0xbf, 0xfd, 0x7c, 0xfe, 0x13,
+  0x26, 0x4f, 0xe5, 0x3f, 0x1e, 0xfd, 0xf5, 0x75, 0xff, 0xf4, 0xf0, 0x18, 0xaa, 0xab, 0x4d, 0xa8,
+  0xd4, 0x86, 0xa7, 0x5f, 0x2d, 0x5d, 0x72, 0x67, 0xc9, 0xf3, 0xb3, 0x25, 0xd8, 0xac, 0x64, 0xa0,
+  0x22, 0xc3, 0x97, 0xe1, 0xf1, 0xd4, 0x4c, 0x89, 0x0e, 0xfe, 0x2f, 0x44, 0x82, 0x0f, 0xff, 0xfc,
+  0x27, 0x16, 0x4a, 0x8f, 0xf2, 0xbe, 0xc4, 0xa5, 0xc9, 0x15, 0x9f, 0x7c, 0xc2, 0xda, 0xb4, 0xf0,
+  0xd7, 0x7f, 0xea, 0xe2, 0x4c, 0xb4, 0x31, 0x3a, 0xe6, 0x37, 0xea, 0x8e, 0xfe, 0xdc, 0xd1, 0x6b,
+  0xf5, 0x91, 0x94, 0xcf, 0x40, 0xfd, 0xf3, 0x6b, 0x9f, 0x94, 0x03, 0xb9, 0x45, 0xf5, 0x7d, 0x36,
+  0x1c, 0x0d, 0xcf, 0x3f, 0xbf, 0x5e, 0xc9, 0xdc, 0x05, 0x2f, 0x80, 0x8c, 0xf6, 0x7f, 0xfe, 0x4b,
+  0x6a, 0x1e, 0x51, 0xa9, 0x50, 0xd5, 0xb3, 0x7f, 0x7c, 0x30, 0x3c, 0xfa, 0x9c, 0xb2, 0x67, 0x37,
+  0x9b, 0xa4, 0x41, 0x92, 0xe3, 0x10, 0x80, 0xc9, 0x72, 0xf5, 0x75, 0x7e, 0xc0, 0xbc, 0x78, 0x32,
+  0x9f, 0x41, 0x4d, 0xe3, 0x4c, 0x79, 0x3e, 0x0c, 0x39, 0x3e, 0xfe, 0x78, 0x7b, 0xe8, 0x59, 0x75,
+  0xa3, 0x53, 0x50, 0xb7, 0xfb, 0xc5, 0xc6, 0xfc, 0x06, 0x76, 0x89, 0xed, 0xb8, 0xe7, 0x00, 0x4b,
+  0xa2, 0x9b, 0xdc, 0xaa, 0x77, 0x3c, 0xb1, 0x2c, 0xe4, 0x39, 0x93, 0xf7, 0x46, 0x84, 0x08, 0x1b,
+  0x2c, 0x1e, 0xff, 0xce, 0x27, 0x39, 0x9e, 0x76, 0x71, 0xd9, 0x60, 0xf8, 0xb1, 0x6e, 0x3f, 0x9a,
+  0x86, 0x1c, 0xde, 0x7f, 0x68, 0xa9, 0x2d, 0x60, 0x20, 0x67, 0x68, 0x40, 0x30, 0xd8, 0x6d, 0xf5,
+  0xd9, 0xe6, 0x26, 0xfb, 0x25, 0x08, 0x43, 0x36, 0xe6, 0x6c, 0x9e, 0x78, 0x6e, 0xce, 0x3d, 0xe6,
+  0xa7, 0xf1, 0x8c, 0x65, 0x50, 0xcf, 0xf3, 0x54, 0xee, 0x09, 0xb2, 0xb3, 0xb9, 0xf8, 0xee, 0x37,
+  0x60, 0xbe, 0x1b, 0x66, 0xbc, 0xaf, 0x27, 0x4e, 0xe4, 0x87, 0xb7, 0x01, 0xcb, 0xd3, 0xb9, 0x1e,
+  0x4f, 0x39, 0x10, 0x11, 0x01, 0x2e, 0xfb, 0x79, 0xce, 0x67, 0x09, 0xa1, 0xa4, 0x31, 0xc0, 0xae,
+  0xc6, 0xdb, 0xd4, 0x9d, 0xe1, 0xa6, 0x56, 0x83, 0x5e, 0xdf, 0xa4, 0xee, 0xb5, 0xb9, 0x24, 0xbb,
+  0xe6, 0x3c, 0x39, 0xf4, 0x60, 0xa8, 0xd9, 0x56, 0x63, 0x13, 0x1e, 0x86, 0x9a, 0x34, 0x9c, 0xff,
+  0xd1, 0xcd, 0xb8, 0x58, 0xc1, 0x90, 0x8c, 0x53, 0x9e, 0x36, 0x3d, 0x3e, 0x4d, 0x39, 0x67, 0x39,
+  0x5e, 0x96, 0x61, 0x89, 0x9b, 0x83, 0x11, 0x78, 0x6c, 0x7c, 0xcb, 0x3c, 0x1e, 0xe6, 0x6e, 0x26,
+  0x9a, 0x2e, 0xfe, 0x3c, 0x22, 0x75, 0x95, 0x6d, 0x49, 0xcb, 0x66, 0x77, 0xa2, 0xe3, 0x4c, 0x6c,
+  0xc7, 0xab, 0x1e, 0x8f, 0x09, 0x0b, 0x5b, 0x3e, 0x42, 0x06, 0xb2, 0x15, 0x0e, 0x3b, 0x60, 0xc8,
+  0x01, 0x8d, 0x82, 0x85, 0xbf, 0xe0, 0x88, 0x32, 0xab, 0xd2, 0xcc, 0x4f, 0x34, 0x24, 0xf6, 0x49,
+  0xc1, 0xaa, 0xed, 0xd7, 0x62, 0x93, 0x1c, 0xd5, 0x7b, 0xaf, 0xf4, 0x0e, 0x6c, 0x36, 0x5e, 0x07,
+  0x91, 0x17, 0x5f, 0x3b, 0xae, 0xe7, 0x0d, 0x17, 0x00, 0xee, 0x08, 0x2a, 0x04, 0x1e, 0xf1, 0x14,
+  0xb0, 0x22, 0x4a, 0xc0, 0x73, 0x89, 0x07, 0x42, 0x0d, 0xec, 0xeb, 0x3c, 0x98, 0xf1, 0x78, 0x9e,
+  0x5b, 0x62, 0x54, 0xe4, 0xb8, 0xfd, 0x17, 0x26, 0x0b, 0xb2, 0xdb, 0x68, 0x82, 0xab, 0x34, 0x13,
+  0x7c, 0x0e, 0x3c, 0xb3, 0xea, 0x9b, 0x39, 0x0c, 0x7e, 0xc4, 0xd9, 0xd7, 0x79, 0x36, 0xa8, 0xb3,
+  0x0d, 0xf6, 0xde, 0xcd, 0xaf, 0x1c, 0x3f, 0x8c, 0xe3, 0xd4, 0x7a, 0x03, 0x5a, 0xe2, 0x44, 0xf1,
+  0xb5, 0x65, 0x6f, 0x02, 0xc4, 0x96, 0x6d, 0x4b, 0xbb, 0x70, 0x26, 0xc8, 0x70, 0x0b, 0x60, 0x0d,
+  0xf6, 0xd8, 0xdd, 0xbd, 0xad, 0xd0, 0x2e, 0x0e, 0xa1, 0xc3, 0x15, 0xdb, 0xfb, 0xcc, 0x03, 0xa9,
+  0x5b, 0x15, 0x8c, 0xe2, 0x68, 0x44, 0x9d, 0x4a, 0xcb, 0x53, 0x28, 0x99, 0x3a, 0xa6, 0x95, 0x8f,
+  0xad, 0x57, 0x31, 0x56, 0x52, 0xb0, 0x02, 0x59, 0x31, 0x67, 0x1a, 0x85, 0xe7, 0xb8, 0x62, 0xd0,
+  0xb0, 0x09, 0xcf, 0x49, 0xd9, 0xbf, 0xfe, 0x85, 0xa6, 0x21, 0x0f, 0x2f, 0x34, 0x1f, 0xa6, 0xd4,
+  0xf3, 0x60, 0xc0, 0xda, 0x62, 0x01, 0xfd, 0x03, 0xda, 0xf7, 0x81, 0x8c, 0x87, 0x89, 0x36, 0x2b,
+  0xa3, 0x36, 0xab, 0xa9, 0x55, 0xf4, 0x5d, 0xff, 0x01, 0xbd, 0x32, 0xdb, 0xb3, 0x4a, 0xb5, 0x02,
+  0xdf, 0xd2, 0xc7, 0x2b, 0x66, 0x30, 0x01, 0xca, 0x21, 0x6f, 0x76, 0x2c, 0x48, 0xac, 0xab, 0xaf,
+  0xf2, 0xf5, 0x7e, 0x69, 0x0d, 0xba, 0x8b, 0x03, 0xf9, 0x1d, 0x13, 0x56, 0x61, 0xeb, 0xe3, 0x18,
+  0x82, 0xb9, 0x5e, 0xb5, 0x16, 0x99, 0xa2, 0x73, 0x5b, 0xb7, 0xab, 0x50, 0xb0, 0x65, 0x7b, 0x72,
+  0xca, 0x2e, 0x3f, 0x13, 0x0a, 0xe1, 0x8b, 0x0a, 0x8b, 0xda, 0x6b, 0xd5, 0xc5, 0x17, 0x58, 0x45,
+  0xe8, 0x3d, 0xe3, 0x20, 0xd6, 0x87, 0x28, 0x14, 0x77, 0x16, 0x1e, 0xa6, 0xef, 0x74, 0xff, 0xc3,
+  0x68, 0xf8, 0xe6, 0xcb, 0xa9, 0xa3, 0x86, 0xf4, 0xb3, 0xc9, 0x4b, 0xf9, 0x2c, 0x5e, 0xf0, 0x25,
+  0x0a, 0x0b, 0x5d, 0x01, 0xa9, 0x7a, 0x8e, 0xc7, 0xf6, 0x58, 0xcb, 0x56, 0xfe, 0xda, 0x49, 0xe6,
+  0xd9, 0x95, 0x75, 0xc7, 0xdc, 0x1e, 0xaa, 0x24, 0x58, 0x31, 0xfe, 0xf4, 0x1a, 0x0c, 0x3f, 0xa4,
+  0x3b, 0x2d, 0x76, 0x6f, 0x97, 0x55, 0xed, 0x98, 0x5f, 0x0b, 0x07, 0xc8, 0xfc, 0x20, 0x0a, 0x32,
+  0x70, 0x71, 0x3d, 0x61, 0xb7, 0xec, 0xfa, 0xca, 0xcd, 0xf1, 0x22, 0x22, 0xa8, 0xb2, 0xc7, 0xdc,
+  0xc8, 0x03, 0x23, 0x41, 0x1b, 0x63, 0xf9, 0x15, 0x87, 0xb9, 0x18, 0x94, 0xde, 0x4d, 0x27, 0x05,
+  0x16, 0xd9, 0x35, 0xfb, 0x06, 0x34, 0x79, 0x1e, 0x79, 0x1c, 0x20, 0xc1, 0x96, 0xef, 0xbe, 0x63,
+  0x7a, 0x54, 0xba, 0xe0, 0x42, 0xf1, 0x0a, 0x9f, 0x8c, 0x6b, 0x14, 0x7f, 0xb0, 0x81, 0x39, 0xc2,
+  0x19, 0x6b, 0x99, 0xd4, 0xc2, 0x2c, 0xd0, 0x22, 0x99, 0x6e, 0x64, 0x17, 0x18, 0x84, 0xc1, 0x47,
+  0x57, 0x9c, 0x0a, 0x4f, 0xc6, 0x59, 0x6b, 0xb9, 0x5e, 0xee, 0x88, 0x2f, 0x09, 0x50, 0x47, 0xfd,
+  0xdf, 0x8e, 0xf6, 0x47, 0xe7, 0x3d, 0xf6, 0xed, 0x9d, 0x80, 0x7c, 0x3f, 0x99, 0xb1, 0xbf, 0xab,
+  0x37, 0xf7, 0xfe, 0x3f, 0xff, 0xfe, 0xad, 0x40, 0xf6, 0xbe, 0x12, 0x16, 0xe2, 0x48, 0xfa, 0x1b,
+  0x6b, 0x95, 0x07, 0x52, 0x51, 0x6e, 0x85, 0x03, 0xda, 0xd8, 0x90, 0x2e, 0x66, 0x45, 0x70, 0x7a,
+  0x43, 0xf7, 0x3c, 0xc1, 0xd1, 0xdc, 0xb2, 0x2b, 0x48, 0x5a, 0x60, 0xf3, 0x18, 0x5b, 0xfe, 0x20,
+  0xb9, 0x08, 0x08, 0x90, 0xe2, 0x0b, 0x32, 0xe6, 0x02, 0x1e, 0x10, 0x8d, 0x7d, 0xf4, 0x5e, 0x5f,
+  0xea, 0x3f, 0x56, 0xd9, 0x91, 0xa0, 0xa3, 0x6e, 0x2e, 0xa8, 0x98, 0x80, 0xfc, 0x14, 0x54, 0xef,
+  0x17, 0xac, 0x01, 0xfc, 0x7f, 0x0c, 0x22, 0x37, 0xbd, 0x15, 0x78, 0x31, 0x8b, 0x7e, 0x38, 0x57,
+  0x36, 0x7e, 0xe0, 0x6b, 0x8e, 0x6f, 0x41, 0xc0, 0xf2, 0xba, 0xd8, 0x06, 0xdb, 0x16, 0xef, 0xf4,
+  0xd9, 0x36, 0x83, 0xe0, 0x1e, 0xe4, 0x79, 0xc8, 0xf1, 0x4b, 0x5b, 0xe0, 0x46, 0x26, 0x97, 0x13,
+  0xbc, 0x2d, 0x4b, 0x4e, 0xda, 0x1a, 0xcf, 0xfd, 0x72, 0x0c, 0x5e, 0x00, 0x1e, 0x11, 0x28, 0x39,
+  0xf8, 0x6e, 0xf7, 0xe7, 0x80, 0x5f, 0xd3, 0x0a, 0xed, 0x13, 0x17, 0x48, 0xfc, 0x07, 0x00, 0xbf,
+  0x63, 0x81, 0x09, 0xa1, 0xaa, 0xb6, 0x6d, 0xe0, 0x67, 0x3e, 0x4f, 0x23, 0x16, 0x01, 0xf3, 0x04,
+  0xc3, 0xdf, 0x9e, 0xed, 0xbf, 0x1f, 0x7e, 0xfc, 0x79, 0x78, 0x36, 0x3a, 0x3c, 0x39, 0x36, 0x60,
+  0xfb, 0x00, 0xfb, 0x8e, 0x52, 0xe4, 0x1e, 0x33, 0x20, 0xb5, 0x6d, 0x99, 0x54, 0x18, 0xa3, 0x5b,
+  0x1d, 0x6b, 0xbb, 0x41, 0x02, 0x87, 0xc9, 0x3c, 0x2b, 0xcf, 0xec, 0xe8, 0x99, 0x04, 0xa7, 0x2e,
+  0x2e, 0xd9, 0x7d, 0xdf, 0x38, 0x26, 0x82, 0x63, 0xf4, 0xf2, 0xf6, 0x2b, 0xab, 0x23, 0x97, 0xab,
+  0xef, 0xce, 0xa9, 0x45, 0xe9, 0x13, 0xc5, 0x2c, 0xf8, 0xb1, 0xcb, 0x22, 0xf8, 0xb1, 0xb1, 0x51,
+  0x58, 0x80, 0x00, 0x13, 0xc3, 0x82, 0x76, 0x07, 0xd8, 0x1a, 0xb0, 0xef, 0xd9, 0xb6, 0xb2, 0x39,
+  0xdf, 0x49, 0x4a, 0x4e, 0xc3, 0xa0, 0x23, 0x06, 0x84, 0xbc, 0x5e, 0xe9, 0xe8, 0x18, 0xb6, 0xb7,
+  0x35, 0xb6, 0x7e, 0xe8, 0x4e, 0xb3, 0xf2, 0x16, 0x98, 0xdf, 0xb2, 0xb5, 0x97, 0xb9, 0x97, 0xca,
+  0x4d, 0xfc, 0xf4, 0xcb, 0x5a, 0x70, 0x0e, 0x6c, 0x63, 0x1d, 0x90, 0x3f, 0xea, 0x28, 0xb1, 0x0b,
+  0x39, 0x9f, 0x84, 0xee, 0x84, 0x67, 0xe4, 0x64, 0x28, 0xf1, 0x6a, 0x10, 0x7b, 0xd9, 0x16, 0xb3,
+  0x28, 0xed, 0xb2, 0x65, 0x22, 0x96, 0xb1, 0x20, 0x37, 0x35, 0xc0, 0xf0, 0x1c, 0xa5, 0xe4, 0xa3,
+  0x30, 0x9f, 0x5d, 0xd6, 0x62, 0xaf, 0x59, 0x7d, 0x93, 0x46, 0xea, 0xac, 0xa7, 0x1e, 0x5f, 0x67,
+  0x41, 0x34, 0xe1, 0x94, 0x96, 0xe8, 0xc5, 0xe0, 0x09, 0xae, 0x78, 0x64, 0xa5, 0x98, 0x7b, 0xa4,
+  0x8e, 0x9b, 0xa6, 0xee, 0xed, 0x8f, 0x73, 0xdf, 0x87, 0xec, 0xc8, 0x96, 0x53, 0xa0, 0x44, 0x94,
+  0x98, 0x94, 0x18, 0x8c, 0xea, 0x50, 0x51, 0x45, 0xc5, 0x65, 0x50, 0xb5, 0x6f, 0x7c, 0xa5, 0x59,
+  0xc6, 0xa0, 0xef, 0x10, 0x79, 0x98, 0x03, 0x74, 0x6c, 0x23, 0x2b, 0x2d, 0x4b, 0x07, 0x44, 0x3c,
+  0x74, 0x81, 0x9a, 0x04, 0xcf, 0xa4, 0x45, 0x17, 0x89, 0xe3, 0x5e, 0xe2, 0x71, 0xfa, 0x04, 0xd3,
+  0x51, 0xf8, 0x0e, 0xbd, 0xa9, 0xa9, 0x22, 0x93, 0xa7, 0xbd, 0x8e, 0xb8, 0xd0, 0x24, 0xa0, 0x25,
+  0x0e, 0x09, 0x91, 0x7d, 0xc7, 0x5a, 0x37, 0xad, 0xb6, 0xed, 0xcc, 0xdc, 0x44, 0x4c, 0x08, 0x6d,
+  0x48, 0x64, 0x08, 0x49, 0x4a, 0x21, 0x44, 0x49, 0xd7, 0x5e, 0x97, 0xa5, 0x09, 0x09, 0x9f, 0x82,
+  0x52, 0x41, 0x12, 0x93, 0x72, 0x77, 0xd6, 0x03, 0x4f, 0xc8, 0xa5, 0xc5, 0x27, 0x60, 0xdb, 0x22,
+  0xe4, 0x60, 0xbb, 0xb5, 0xc1, 0x6a, 0x6e, 0xc3, 0x6b, 0xa4, 0x0d, 0x99, 0x0f, 0x35, 0xa0, 0x6e,
+  0xe2, 0x0d, 0xf4, 0xac, 0xf8, 0x8f, 0xd7, 0xa0, 0x95, 0x35, 0x53, 0xd6, 0xd2, 0x53, 0x8e, 0x08,
+  0x70, 0x25, 0xe3, 0xe6, 0x99, 0x34, 0x77, 0x4a, 0x6a, 0x47, 0xf1, 0x3c, 0x9d, 0x40, 0xfc, 0xdc,
+  0xe4, 0xf8, 0x96, 0x29, 0x5f, 0xc6, 0x33, 0x27, 0x8e, 0xf0, 0x8b, 0x2d, 0xac, 0x95, 0xa8, 0xa3,
+  0x2c, 0x96, 0x93, 0x40, 0x8a, 0xab, 0x46, 0xc6, 0xa9, 0xcc, 0x92, 0x00, 0xcc, 0x78, 0x96, 0xb9,
+  0xe4, 0x48, 0xf9, 0xb2, 0x2a, 0xa0, 0xd7, 0xe1, 0x0e, 0x84, 0x2b, 0xd7, 0xc9, 0x12, 0xf0, 0x5b,
+  0x56, 0xbd, 0x51, 0x17, 0xcc, 0x3d, 0x9e, 0xcf, 0xc6, 0x3c, 0xd5, 0x62, 0xd3, 0x29, 0xea, 0x9d,
+  0xdb, 0x5b, 0x5c, 0xb4, 0x2e, 0xd1, 0xe2, 0x16, 0x17, 0xed, 0x4b, 0xe4, 0xfa, 0xe2, 0xa2, 0x83,
+  0x3f, 0x05, 0x5f, 0xe0, 0x6d, 0xeb, 0x12, 0xaf, 0x46, 0x78, 0x1c, 0x1e, 0xb7, 0x2f, 0xd1, 0x1d,
+  0x7e, 0xc4, 0x3d, 0x5d, 0xf1, 0x88, 0xdb, 0x5e, 0x51, 0x35, 0x03, 0x0f, 0xff, 0x73, 0xa9, 0x2d,
+  0xd0, 0xc0, 0x98, 0xa7, 0x69, 0x0c, 0x3a, 0x5d, 0x04, 0xa5, 0xfe, 0x8a, 0x88, 0x95, 0xc4, 0x61,
+  0x28, 0x51, 0xaa, 0xe6, 0xf1, 0x22, 0x2e, 0xd4, 0x45, 0x8a, 0x6e, 0x98, 0x08, 0x71, 0xef, 0x9b,
+  0xd4, 0x89, 0x3f, 0xd9, 0x60, 0xb8, 0x69, 0x7c, 0x8d, 0x97, 0x84, 0xa4, 0xd1, 0xa7, 0xce, 0xef,
+  0x59, 0x1c, 0x59, 0xe8, 0x12, 0x8c, 0x6d, 0x8a, 0x6a, 0x39, 0x56, 0xd2, 0x22, 0xcd, 0x18, 0x1d,
+  0x39, 0x15, 0xaf, 0x40, 0xa5, 0xce, 0x78, 0x0e, 0x91, 0x03, 0x0b, 0x0a, 0x92, 0x0b, 0xa3, 0xca,
+  0x4b, 0x8a, 0xad, 0xb0, 0xaa, 0x15, 0xe9, 0x3c, 0x18, 0xd8, 0x56, 0x49, 0x96, 0x52, 0x83, 0x0d,
+  0x16, 0xc0, 0x46, 0x59, 0x14, 0x19, 0xca, 0x63, 0x57, 0xd5, 0x0d, 0x37, 0x50, 0x86, 0x09, 0x35,
+  0xd1, 0x21, 0x7e, 0xac, 0x5e, 0x40, 0xb1, 0x5f, 0x30, 0x4d, 0x15, 0x46, 0xca, 0x06, 0x7e, 0xe2,
+  0x6e, 0x9a, 0x8f, 0x39, 0xa4, 0x52, 0xe0, 0x46, 0x20, 0x89, 0xcb, 0x18, 0xe8, 0x22, 0x90, 0xd0,
+  0xc9, 0xf0, 0x82, 0x10, 0x8e, 0x77, 0x33, 0x16, 0xfb, 0x2c, 0x0b, 0x42, 0x0e, 0x7e, 0x88, 0xb9,
+  0x18, 0xb6, 0x3d, 0x08, 0x80, 0x20, 0xd3, 0xe8, 0x93, 0x28, 0xbd, 0xf4, 0x31, 0x86, 0xb2, 0x16,
+  0xa5, 0x08, 0x6b, 0x1a, 0x35, 0xca, 0x1e, 0xc3, 0x0f, 0x19, 0x76, 0x89, 0x7b, 0xec, 0x9e, 0x90,
+  0x32, 0xb1, 0x3a, 0x83, 0x18, 0x0a, 0x56, 0x08, 0xa7, 0xcb, 0x6f, 0xd4, 0x2c, 0x05, 0x78, 0xf8,
+  0x3b, 0x23, 0x1e, 0x4f, 0x70, 0x0e, 0xc2, 0x37, 0x20, 0x25, 0xec, 0x95, 0x10, 0x77, 0x43, 0x53,
+  0x49, 0x68, 0xc2, 0xca, 0xb3, 0xb2, 0xf1, 0x79, 0x18, 0xf3, 0x75, 0x05, 0xfe, 0x9a, 0xc1, 0x02,
+  0x89, 0x1c, 0x0e, 0xd8, 0x6c, 0x93, 0xd0, 0x60, 0x3d, 0xb3, 0xb4, 0x92, 0xc5, 0x7a, 0x9e, 0x89,
+  0x21, 0x95, 0xc4, 0x2a, 0x8f, 0x17, 0x23, 0xc1, 0xb1, 0x93, 0xb3, 0x26, 0x04, 0x37, 0xa7, 0xdd,
+  0x85, 0xc8, 0xe5, 0xe5, 0x52, 0x78, 0xaa, 0xe2, 0x13, 0x21, 0xe6, 0x8f, 0x39, 0xde, 0x50, 0x88,
+  0x82, 0x99, 0x8b, 0x18, 0x0a, 0x0f, 0x4c, 0x68, 0x6a, 0x11, 0x3f, 0xbc, 0xc6, 0x24, 0x4f, 0x40,
+  0x56, 0xb4, 0xe5, 0x37, 0xe8, 0x31, 0x41, 0xbe, 0xb7, 0x54, 0xe8, 0xd5, 0xf1, 0x06, 0x65, 0xbd,
+  0xaf, 0xc7, 0xcf, 0x00, 0x61, 0xba, 0x8c, 0x2a, 0xfa, 0x27, 0xa2, 0xca, 0xb6, 0xcd, 0xf8, 0x4d,
+  0x5d, 0x00, 0x51, 0x9c, 0x6f, 0xe2, 0x05, 0x3c, 0x39, 0x7a, 0xab, 0x6b, 0x72, 0xe0, 0x52, 0xbb,
+  0xa5, 0xc6, 0xb1, 0x7e, 0x34, 0x67, 0x3a, 0xad, 0x72, 0xc6, 0xfe, 0x2e, 0x0d, 0x3c, 0x8d, 0x18,
+  0x78, 0xd7, 0xf8, 0x13, 0x2f, 0x50, 0xdb, 0xda, 0xda, 0x92, 0xa8, 0xa1, 0xf0, 0x7f, 0x91, 0x0d,
+  0x81, 0xb6, 0xc4, 0x36, 0xa6, 0xac, 0xac, 0x46, 0xf7, 0x16, 0xf5, 0x1d, 0xab, 0x9a, 0x98, 0xc4,
+  0xcc, 0x6d, 0x1f, 0x2f, 0x89, 0xe1, 0x0a, 0x71, 0x0d, 0xc3, 0x98, 0xc1, 0xc0, 0x22, 0x93, 0xd6,
+  0xda, 0x2c, 0xf0, 0xbc, 0x10, 0xb6, 0x95, 0xb3, 0x8f, 0x01, 0x1c, 0x12, 0xec, 0x0e, 0xb6, 0xab,
+  0xa9, 0x07, 0x00, 0x18, 0xf3, 0x69, 0x10, 0x9d, 0x42, 0xcd, 0x8f, 0xca, 0x88, 0x03, 0x50, 0x38,
+  0x58, 0xf1, 0x4d, 0x03, 0x58, 0xd0, 0x20, 0x72, 0xbf, 0xb7, 0x82, 0xcd, 0x6d, 0xc8, 0x27, 0xa8,
+  0x2f, 0x70, 0x7a, 0xd8, 0x00, 0xb7, 0xdb, 0x37, 0xc8, 0x2b, 0x3c, 0x80, 0xd4, 0x33, 0xa8, 0x8d,
+  0x8e, 0xe8, 0x1e, 0xe5, 0x40, 0x6c, 0xa1, 0x7b, 0x51, 0x16, 0x01, 0x01, 0x05, 0x51, 0x05, 0x78,
+  0xb1, 0x6b, 0x49, 0x82, 0xaf, 0x5e, 0xbd, 0x32, 0x24, 0x78, 0x8e, 0xad, 0xb0, 0x02, 0xe8, 0x06,
+  0xd0, 0x3f, 0xab, 0x01, 0x76, 0x84, 0x21, 0x48, 0xa0, 0x40, 0x11, 0x5e, 0xba, 0xa5, 0xd4, 0x46,
+  0x91, 0xef, 0xf1, 0xe9, 0x60, 0x0b, 0x44, 0x08, 0x3f, 0x77, 0x07, 0xed, 0xae, 0x78, 0xda, 0x80,
+  0xa1, 0x6a, 0x12, 0x96, 0xba, 0xd4, 0x88, 0x82, 0x59, 0xc0, 0x54, 0xd2, 0x8b, 0x86, 0xb1, 0xd3,
+  0xea, 0x3f, 0xc4, 0x31, 0xac, 0x03, 0xcf, 0x63, 0xc9, 0x34, 0xbb, 0x90, 0x30, 0x8d, 0x01, 0xc6,
+  0xa4, 0x34, 0x12, 0xe0, 0x24, 0xce, 0x2c, 0x38, 0xc6, 0x26, 0xec, 0xcb, 0x53, 0x90, 0xeb, 0xd0,
+  0xd4, 0x3a, 0xf6, 0xae, 0x61, 0x54, 0x65, 0x5a, 0xf0, 0x0b, 0xe8, 0xab, 0xfd, 0xe7, 0xdf, 0xc4,
+  0x27, 0x38, 0xc5, 0xc2, 0x63, 0x36, 0xda, 0x5d, 0x7b, 0x0d, 0x16, 0x4b, 0xf3, 0x05, 0x2a, 0x92,
+  0x9d, 0x4a, 0xbf, 0xf1, 0x3e, 0x17, 0x3b, 0x02, 0xda, 0x5e, 0x2c, 0x71, 0xcd, 0x2a, 0x1a, 0x2e,
+  0x15, 0xe6, 0x29, 0x7b, 0x5b, 0x61, 0x12, 0x2d, 0xbf, 0xb5, 0xc2, 0x24, 0x3a, 0xfd, 0x25, 0x46,
+  0x6b, 0x08, 0x7f, 0x39, 0xb3, 0x2b, 0xb8, 0x59, 0x95, 0x1a, 0x7c, 0x04, 0x1e, 0x04, 0x02, 0xf3,
+  0x5b, 0x6c, 0x9d, 0x8a, 0x8c, 0x15, 0xef, 0x8e, 0x06, 0xa1, 0x6d, 0x70, 0x60, 0x2a, 0x58, 0x80,
+  0x40, 0x26, 0x18, 0x36, 0xf8, 0x99, 0x0b, 0x55, 0x50, 0xf8, 0x0e, 0xaf, 0xff, 0x81, 0xb1, 0x6a,
+  0x73, 0x6a, 0x29, 0xbd, 0x15, 0x96, 0x25, 0x4f, 0xc2, 0xdd, 0xd8, 0x2c, 0x39, 0xc0, 0x9b, 0x99,
+  0xa3, 0x3c, 0x4e, 0xc0, 0x61, 0xb1, 0xba, 0xbc, 0x46, 0xcf, 0x76, 0x5a, 0xb4, 0xaf, 0xe5, 0x6c,
+  0xd9, 0xf5, 0xb5, 0x1b, 0xda, 0xc6, 0x86, 0x2d, 0xb5, 0xa1, 0xad, 0x37, 0x54, 0x55, 0x07, 0x01,
+  0x14, 0x33, 0x0f, 0xe8, 0xb3, 0xe6, 0x70, 0xd5, 0x29, 0x34, 0x48, 0xea, 0x4d, 0x72, 0xfb, 0xe2,
+  0x79, 0x03, 0x9e, 0x5b, 0x5d, 0xbb, 0x30, 0x5c, 0xd9, 0xef, 0x23, 0x26, 0x9e, 0xc8, 0x24, 0xd7,
+  0xf2, 0xa1, 0x78, 0xf4, 0x20, 0x92, 0xc9, 0x20, 0x25, 0x3b, 0x8a, 0x45, 0x0e, 0xac, 0x43, 0x8c,
+  0xc8, 0x82, 0x75, 0x84, 0xc1, 0x64, 0xef, 0x81, 0x20, 0x54, 0x36, 0xe3, 0x71, 0x4a, 0xfa, 0x18,
+  0x3b, 0xee, 0x1a, 0x4d, 0xd4, 0x9a, 0xfb, 0x31, 0x41, 0xef, 0x0f, 0x2b, 0x53, 0x98, 0xd7, 0xae,
+  0x49, 0xba, 0x29, 0xa3, 0x12, 0xa0, 0x85, 0xbb, 0x03, 0xa1, 0x41, 0xdf, 0x7d, 0x27, 0x36, 0x52,
+  0x02, 0x7a, 0xa7, 0x1b, 0x11, 0xf2, 0x6c, 0x04, 0x48, 0x8a, 0x48, 0x6b, 0x0c, 0x45, 0x1c, 0xa7,
+  0xb6, 0x8a, 0x22, 0x63, 0x8c, 0x2e, 0xa4, 0x92, 0xe6, 0x22, 0x54, 0xc9, 0x71, 0x91, 0x7c, 0x2e,
+  0x8b, 0xed, 0x37, 0x7d, 0xfd, 0x1f, 0x12, 0x09, 0xf1, 0xdf, 0xb7, 0x77, 0xc0, 0x9d, 0x7b, 0xfb,
+  0xb7, 0xf2, 0xa6, 0x95, 0x3e, 0x7d, 0x0c, 0xe2, 0x1b, 0x83, 0xf8, 0xb6, 0xd1, 0xe0, 0xdb, 0x4d,
+  0xd8, 0x67, 0x7f, 0xff, 0x8a, 0x54, 0xa5, 0xf3, 0xbd, 0x64, 0x52, 0x45, 0x7a, 0x0a, 0xa4, 0x7e,
+  0xc0, 0x00, 0x17, 0x42, 0x06, 0xc9, 0xa1, 0xdc, 0xd2, 0x29, 0xdd, 0x83, 0x78, 0x42, 0x4e, 0x21,
+  0xff, 0x21, 0x4c, 0x81, 0x54, 0x50, 0xe4, 0xcf, 0xc3, 0xb7, 0xdd, 0x32, 0x10, 0xde, 0x79, 0x02,
+  0xc2, 0xf7, 0x46, 0xf6, 0x58, 0xb4, 0xe2, 0x74, 0x6b, 0xa7, 0x1c, 0xfe, 0xca, 0x1e, 0xd5, 0x2f,
+  0x92, 0x07, 0x11, 0x8e, 0xeb, 0x78, 0x65, 0x9b, 0xae, 0x16, 0x17, 0x31, 0xb9, 0xbe, 0x1c, 0x93,
+  0xeb, 0x22, 0x26, 0xd7, 0xfb, 0xab, 0x9c, 0x71, 0xad, 0xd7, 0x63, 0x6f, 0x0e, 0x47, 0x07, 0x27,
+  0xc7, 0xc7, 0xc3, 0x83, 0xf3, 0xe1, 0x1b, 0xd6, 0xeb, 0x99, 0x01, 0xac, 0xdb, 0xb2, 0xcd, 0x16,
+  0x95, 0xc8, 0x01, 0x31, 0x25, 0x86, 0x0d, 0xe7, 0x67, 0x27, 0x47, 0x23, 0x7c, 0x31, 0x13, 0x20,
+  0xf3, 0x66, 0x6d, 0xb5, 0x99, 0xaf, 0xbb, 0x9d, 0x46, 0x89, 0x4c, 0x1f, 0x93, 0x6c, 0x7b, 0x55,
+  0x3d, 0x61, 0x5c, 0x1c, 0xad, 0x42, 0x82, 0x99, 0x8f, 0x2e, 0x4e, 0x3d, 0x1d, 0x5a, 0xf9, 0x7e,
+  0x68, 0x05, 0xa0, 0xe4, 0xd0, 0x03, 0xc0, 0x0a, 0xca, 0xe9, 0x9a, 0xaf, 0xa0, 0x1a, 0x46, 0x8e,
+  0xf0, 0x57, 0x78, 0x72, 0x70, 0xb9, 0x58, 0xa7, 0x86, 0xb7, 0x54, 0x53, 0xa4, 0x1e, 0xa4, 0xe2,
+  0x3e, 0xfe, 0xee, 0x55, 0x18, 0x4f, 0x0f, 0xe8, 0x37, 0x08, 0x20, 0x15, 0xe6, 0xe2, 0x34, 0xf0,
+  0x30, 0xd6, 0xaf, 0xcd, 0xa3, 0x78, 0xda, 0x14, 0x33, 0xb6, 0xfa, 0x1c, 0xa5, 0x97, 0x8a, 0xcf,
+  0x51, 0xf1, 0x14, 0x23, 0x99, 0xfa, 0xd2, 0x04, 0xaf, 0x58, 0x7d, 0xe0, 0x24, 0x35, 0x97, 0x4a,
+  0x9d, 0x42, 0x7d, 0x0b, 0x59, 0x52, 0xb5, 0xb6, 0x3d, 0x67, 0x5e, 0xa6, 0x7c, 0xb8, 0x17, 0x0e,
+  0x3a, 0x69, 0x20, 0x04, 0x54, 0x83, 0x37, 0x59, 0xdf, 0x0d, 0x2d, 0x6e, 0xac, 0x02, 0x5c, 0x48,
+  0xf8, 0xe7, 0x94, 0xed, 0xbd, 0x45, 0x72, 0xc5, 0x9d, 0x55, 0x99, 0xf2, 0x21, 0x9f, 0x04, 0xa6,
+  0x32, 0x8d, 0x2f, 0xa8, 0x32, 0x8b, 0x15, 0xb5, 0x0c, 0x6c, 0x49, 0x15, 0x1f, 0x4b, 0xba, 0xa1,
+  0x21, 0x55, 0x24, 0x09, 0xb8, 0x7d, 0x44, 0x02, 0x55, 0x73, 0x66, 0x43, 0x93, 0x61, 0x0a, 0xf7,
+  0xce, 0x68, 0xae, 0x94, 0xab, 0xcf, 0x92, 0x0b, 0xa6, 0xa6, 0xe8, 0x80, 0x6d, 0xa4, 0x8e, 0x68,
+  0x2c, 0xd2, 0x17, 0x50, 0xab, 0x6e, 0x8a, 0xaf, 0x6e, 0xe3, 0x77, 0x1a, 0x9d, 0x82, 0xe9, 0xda,
+  0xb5, 0xd4, 0xfa, 0x29, 0x75, 0x7e, 0xac, 0x3b, 0x04, 0x0b, 0xee, 0x63, 0xee, 0x9b, 0xfd, 0x10,
+  0x5a, 0x52, 0x9a, 0xab, 0x20, 0x4a, 0xc8, 0xec, 0x16, 0x7a, 0x02, 0x94, 0x97, 0x95, 0xa6, 0x5f,
+  0x56, 0x1a, 0x5d, 0x48, 0x1b, 0x5c, 0x67, 0xf7, 0x66, 0x1b, 0x18, 0x96, 0xe3, 0x67, 0xb0, 0x1c,
+  0xea, 0x4c, 0xee, 0xe9, 0x46, 0x7a, 0x01, 0x11, 0x4f, 0x2c, 0x33, 0x04, 0xb9, 0x91, 0x52, 0x05,
+  0x48, 0x00, 0x2b, 0x7d, 0xaa, 0xdc, 0xd6, 0x18, 0x88, 0xb6, 0x60, 0x6e, 0x3f, 0xfa, 0xfd, 0x62,
+  0xb5, 0xee, 0x68, 0x30, 0xbf, 0xc7, 0x10, 0x77, 0xea, 0xff, 0x17, 0x09, 0x36, 0xd7, 0x9a, 0x4d,
+  0x36, 0x7c, 0x7f, 0x2a, 0xae, 0x50, 0xb3, 0x66, 0xb3, 0xb6, 0xba, 0x9b, 0xf4, 0xd9, 0x9a, 0x3a,
+  0xc4, 0xf6, 0x06, 0xd4, 0x2c, 0xd5, 0x36, 0xd4, 0x8e, 0xe8, 0x22, 0x03, 0xad, 0x67, 0xc2, 0xac,
+  0x7b, 0xa2, 0x81, 0x30, 0xdf, 0xea, 0x34, 0x98, 0x4b, 0xd9, 0xe4, 0x7c, 0x47, 0x36, 0x33, 0xe1,
+  0x89, 0x59, 0xad, 0x9b, 0x9d, 0x16, 0xf6, 0x6f, 0x92, 0x78, 0x72, 0x85, 0x2d, 0x50, 0xb0, 0x2e,
+  0x36, 0x6f, 0xbf, 0x2a, 0x7f, 0xee, 0x2d, 0xb1, 0xef, 0xa9, 0x1d, 0x67, 0xb1, 0x20, 0x2c, 0xa4,
+  0x5b, 0x2a, 0x22, 0x62, 0x21, 0x7f, 0xec, 0xa1, 0xee, 0x60, 0x2a, 0x00, 0xfb, 0x1c, 0x44, 0xfd,
+  0x88, 0x47, 0x53, 0xfc, 0xa0, 0x0b, 0x13, 0x03, 0xb6, 0x53, 0xad, 0x28, 0x72, 0xb3, 0x3b, 0xbc,
+  0xd5, 0xb1, 0x62, 0xdd, 0x9e, 0x75, 0xcd, 0x19, 0xd1, 0x9b, 0xc5, 0x2a, 0xcb, 0x5f, 0x1e, 0xee,
+  0x22, 0x99, 0x95, 0x2e, 0x33, 0x8e, 0xbf, 0x2a, 0x75, 0x9a, 0xf5, 0x89, 0x88, 0xbc, 0xe5, 0x53,
+  0xcf, 0x10, 0x12, 0x1e, 0xa8, 0xf4, 0x25, 0xb9, 0xdc, 0xc2, 0xf0, 0x4b, 0xbd, 0x06, 0x27, 0x8f,
+  0xd1, 0x29, 0x8c, 0xf2, 0x14, 0x7c, 0x07, 0xd8, 0x4e, 0x16, 0x82, 0xae, 0x52, 0xb2, 0x69, 0x33,
+  0xe0, 0xbf, 0xfe, 0xe2, 0x53, 0xa8, 0xd9, 0x6f, 0x17, 0xdf, 0xde, 0xe5, 0xd9, 0xfd, 0x25, 0x3b,
+  0x84, 0x98, 0xf4, 0x01, 0x3b, 0xed, 0xf4, 0xc9, 0x45, 0x7d, 0x6d, 0xa1, 0x0f, 0x2d, 0xab, 0xda,
+  0xca, 0x61, 0x45, 0xc5, 0x56, 0x86, 0x8d, 0xe2, 0x3a, 0xbb, 0xfa, 0x0c, 0xe3, 0x5b, 0x74, 0x35,
+  0x23, 0x9d, 0x59, 0xb5, 0x03, 0xf1, 0xc0, 0x7e, 0x09, 0x12, 0x4e, 0x52, 0x7b, 0x5d, 0xb3, 0x0b,
+  0x2e, 0xeb, 0xe8, 0x82, 0x30, 0x3e, 0x0a, 0xb7, 0x5b, 0x7c, 0xb0, 0x32, 0x4d, 0xf5, 0x79, 0x56,
+  0x52, 0xbb, 0x38, 0x38, 0x1a, 0xee, 0x9f, 0x0d, 0xdf, 0x5c, 0xd6, 0xd6, 0x7f, 0x47, 0x2a, 0x5f,
+  0xef, 0x2f, 0xa9, 0x5b, 0x4e, 0xde, 0xed, 0x73, 0x0e, 0x35, 0x75, 0x71, 0x1c, 0xc6, 0x63, 0xa9,
+  0xaf, 0x3f, 0xc2, 0xa3, 0x75, 0x01, 0xe0, 0x20, 0x52, 0xdd, 0x89, 0x8f, 0x1a, 0x75, 0x8c, 0x9e,
+  0x9b, 0x93, 0x6c, 0x51, 0xbf, 0x2f, 0x69, 0xf0, 0x3c, 0x0d, 0xa9, 0xa5, 0x41, 0xdd, 0xb2, 0x0f,
+  0x67, 0x47, 0xb2, 0x26, 0x11, 0x39, 0x38, 0xbc, 0x5b, 0x08, 0xb6, 0xb4, 0xc3, 0x35, 0x71, 0x14,
+  0xab, 0x25, 0x9a, 0x10, 0xb4, 0x80, 0xa1, 0xcc, 0x75, 0xae, 0x52, 0x8e, 0xaa, 0x09, 0xb0, 0xf1,
+  0x4d, 0x51, 0x8c, 0x1c, 0xa2, 0x8b, 0x12, 0xc4, 0x7a, 0x07, 0x70, 0xa9, 0xe1, 0x34, 0x5d, 0xb8,
+  0xb1, 0x2a, 0x96, 0x2e, 0x53, 0x1a, 0xfc, 0xcd, 0x9b, 0x4a, 0x42, 0x63, 0xfe, 0x7e, 0xce, 0xd3,
+  0xe2, 0xab, 0xba, 0xb8, 0xf3, 0x70, 0x84, 0x35, 0x03, 0x96, 0xde, 0x21, 0x22, 0xd4, 0x60, 0x4f,
+  0xf5, 0x3e, 0xe5, 0xc8, 0xc4, 0x0c, 0x05, 0x10, 0x29, 0x7f, 0xc6, 0x5b, 0x42, 0xe6, 0xa5, 0xfa,
+  0x89, 0x93, 0x25, 0x5e, 0xd1, 0xd0, 0x37, 0x56, 0xc8, 0xdb, 0xde, 0x13, 0xc7, 0xcb, 0xf2, 0x95,
+  0x0b, 0xe4, 0xc5, 0xe3, 0x89, 0x13, 0x4e, 0x3e, 0xad, 0x5c, 0xa0, 0x2f, 0xc4, 0x4e, 0x9c, 0x71,
+  0xba, 0x1a, 0x86, 0xb8, 0xb0, 0x39, 0x71, 0xe0, 0xe7, 0xea, 0x79, 0xba, 0x50, 0x08, 0xf3, 0xee,
+  0xcd, 0xca, 0x79, 0x79, 0xe1, 0x0d, 0xa8, 0x98, 0x25, 0x8f, 0x87, 0x0c, 0x71, 0x89, 0x0c, 0xf9,
+  0x8b, 0x77, 0xcb, 0x38, 0xca, 0xd9, 0x02, 0xdc, 0xfe, 0x64, 0xf4, 0x0d, 0x6e, 0x45, 0x7b, 0x56,
+  0xcb, 0x12, 0x6f, 0xd8, 0x05, 0x5e, 0x83, 0xc9, 0x0f, 0x42, 0xa5, 0xf6, 0x7f, 0xf8, 0x80, 0x29,
+  0x04, 0x8a, 0xb7, 0xe8, 0x6b, 0x17, 0xea, 0x5b, 0x0d, 0xe4, 0x2b, 0x16, 0x0f, 0x85, 0x61, 0xd8,
+  0xe0, 0xf2, 0x08, 0xaa, 0x58, 0xb7, 0x50, 0xfd, 0x25, 0xa0, 0xd8, 0x32, 0x17, 0x23, 0x87, 0x64,
+  0xb7, 0x0a, 0x1e, 0xcb, 0x53, 0xc0, 0x9c, 0x06, 0x5b, 0xa8, 0x94, 0x40, 0x41, 0x46, 0xdf, 0x2a,
+  0x46, 0xe6, 0x89, 0xc6, 0xe4, 0xbe, 0xd4, 0x74, 0x94, 0x13, 0xcf, 0xa0, 0x67, 0x2d, 0x8f, 0xf1,
+  0x62, 0x61, 0x7d, 0x23, 0xf0, 0xd4, 0x37, 0x88, 0x66, 0xdd, 0xbe, 0x68, 0x5f, 0xda, 0x4e, 0x10,
+  0x45, 0x3c, 0x3d, 0x17, 0x69, 0x91, 0xc2, 0x70, 0x15, 0xa7, 0xa5, 0x74, 0x91, 0xd9, 0x8b, 0xe7,
+  0x20, 0x06, 0x4e, 0x96, 0x87, 0x98, 0xe1, 0x94, 0xd8, 0xa0, 0x59, 0xb0, 0xd2, 0xd3, 0x95, 0x2e,
+  0xf3, 0xad, 0x70, 0xd6, 0x67, 0x38, 0x4f, 0xff, 0x4f, 0x16, 0x79, 0xc7, 0x31, 0x5b, 0xe9, 0xad,
+  0x09, 0x8c, 0x36, 0x49, 0x1d, 0xbf, 0xd6, 0xde, 0xcf, 0x5b, 0xef, 0x7a, 0xcd, 0x7b, 0x81, 0x25,
+  0x1e, 0xfc, 0x81, 0x5e, 0x5f, 0x02, 0xae, 0x67, 0x90, 0xa4, 0x3e, 0xa8, 0xeb, 0xc2, 0xc8, 0xa5,
+  0x07, 0x6e, 0xa8, 0x6d, 0xde, 0x63, 0xdb, 0xc8, 0xf2, 0xab, 0xbb, 0xc2, 0xc7, 0x76, 0x91, 0x3b,
+  0xa8, 0xee, 0x1a, 0xa7, 0x8f, 0x6d, 0x93, 0x4e, 0xa2, 0xba, 0x71, 0x16, 0x3d, 0xb6, 0x11, 0x5d,
+  0xc7, 0xd2, 0xae, 0x9b, 0x47, 0x77, 0x81, 0x43, 0xa9, 0xee, 0xca, 0x66, 0x8f, 0x32, 0x12, 0xdd,
+  0xcc, 0x12, 0x6d, 0xb0, 0xcb, 0x7a, 0xba, 0xaf, 0x79, 0xcd, 0xda, 0xf8, 0x19, 0x42, 0xb4, 0x86,
+  0x2e, 0x65, 0xf2, 0xf0, 0x5d, 0xdd, 0xac, 0xe7, 0xf5, 0x47, 0x2f, 0x10, 0xbf, 0xd4, 0xa3, 0xd7,
+  0xf5, 0x8d, 0x3f, 0x54, 0x50, 0x7b, 0x50, 0x91, 0xca, 0x86, 0x6d, 0xac, 0x2d, 0xec, 0xfb, 0x01,
+  0xdb, 0x79, 0xf4, 0x02, 0x10, 0xb6, 0x1a, 0x3c, 0x0a, 0x76, 0xa5, 0x5a, 0x50, 0x64, 0x39, 0xba,
+  0xfe, 0x52, 0x65, 0x99, 0xe9, 0x43, 0x2f, 0xea, 0x32, 0xd6, 0xd4, 0x45, 0x44, 0xa9, 0x8b, 0xb8,
+  0x51, 0x57, 0xd1, 0xa1, 0x4e, 0x31, 0xa0, 0x4e, 0x9e, 0xbe, 0x4e, 0x8c, 0xbe, 0xd4, 0x5d, 0xb0,
+  0x4f, 0x45, 0xf8, 0x7a, 0x90, 0xd1, 0xf5, 0x8d, 0x4f, 0xb6, 0x13, 0x47, 0xe2, 0xfa, 0xf0, 0x40,
+  0xb3, 0x01, 0x8d, 0x87, 0x2c, 0x5f, 0x2f, 0x92, 0xf6, 0x2f, 0x3e, 0x4b, 0xed, 0x6e, 0xaa, 0xcb,
+  0xae, 0xbb, 0x9b, 0xe2, 0x37, 0x96, 0x77, 0x37, 0xc5, 0xff, 0x29, 0xed, 0xff, 0x01, 0x75, 0x9c,
+  0x28, 0xc4, 0x3b, 0x4d, 0x00, 0x00,
+};
+
+// INDEX_HTML (web.h): 19423 bytes -> 5850 bytes gzipped
+#define V3_INDEX_ETAG "\"7805653b9f9d93ad\""
+const size_t V3_INDEX_GZ_LEN = 5850;
+const uint8_t V3_INDEX_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x3c, 0xe9, 0x7a, 0xdb, 0x46,
+  0x92, 0xff, 0xf5, 0x14, 0x1d, 0x3a, 0x1b, 0x82, 0x36, 0x49, 0x91, 0x94, 0xe8, 0x55, 0x74, 0x79,
+  0x69, 0x89, 0x76, 0x34, 0x23, 0x4b, 0xfa, 0x48, 0xda, 0x89, 0x3f, 0xaf, 0x3f, 0xa7, 0x49, 0x34,
+  0x49, 0xd8, 0x20, 0xc0, 0x05, 0x40, 0x51, 0x1a, 0x8f, 0xde, 0x69, 0x9f, 0x61, 0x9f, 0x6c, 0xeb,
+  0x68, 0x00, 0x8d, 0x43, 0xa7, 0x93, 0x99, 0x49, 0x04, 0x55, 0x77, 0x57, 0x57, 0xd7, 0x5d, 0xd5,
+  0xad, 0xd9, 0xd8, 0xff, 0xe9, 0xf8, 0xfc, 0x68, 0xf4, 0xf1, 0xa2, 0x2f, 0xe6, 0xd1, 0xc2, 0x3d,
+  0xdc, 0xd8, 0xc7, 0x1f, 0xc2, 0x95, 0xde, 0xec, 0xa0, 0xa2, 0xbc, 0x0a, 0x02, 0x94, 0xb4, 0x0f,
+  0x37, 0x84, 0xd8, 0x5f, 0xa8, 0x48, 0x8a, 0xc9, 0x5c, 0x06, 0xa1, 0x8a, 0x0e, 0x2a, 0xef, 0x47,
+  0x6f, 0x1a, 0x3b, 0x95, 0x74, 0xc0, 0x93, 0x0b, 0x75, 0x50, 0xb9, 0x74, 0xd4, 0x7a, 0xe9, 0x07,
+  0x51, 0x45, 0x4c, 0x7c, 0x2f, 0x52, 0x1e, 0x4c, 0x5c, 0x3b, 0x76, 0x34, 0x3f, 0xb0, 0xd5, 0xa5,
+  0x33, 0x51, 0x0d, 0xfa, 0xa5, 0x2e, 0x1c, 0xcf, 0x89, 0x1c, 0xe9, 0x36, 0xc2, 0x89, 0x74, 0xd5,
+  0x41, 0xbb, 0xd9, 0xaa, 0x8b, 0x85, 0xbc, 0x72, 0x16, 0xab, 0x85, 0x09, 0x5a, 0x85, 0x2a, 0xa0,
+  0xdf, 0xe5, 0x18, 0x40, 0x9e, 0xcf, 0xbb, 0x45, 0x4e, 0xe4, 0xaa, 0xc3, 0x41, 0xef, 0xb8, 0x37,
+  0x10, 0xa3, 0xf7, 0x83, 0x41, 0x7f, 0xb4, 0xbf, 0xc9, 0x30, 0x1c, 0x0d, 0xa3, 0x6b, 0xfe, 0x12,
+  0x62, 0xf3, 0xb9, 0x38, 0xc0, 0xff, 0x88, 0xd7, 0xbd, 0x61, 0x5f, 0x0c, 0x47, 0x1f, 0x4f, 0xfb,
+  0x43, 0x0d, 0x79, 0xbe, 0x49, 0x33, 0x76, 0x03, 0xdf, 0x8f, 0xc4, 0x77, 0xfa, 0x16, 0xa2, 0xd1,
+  0x18, 0xcf, 0x76, 0xc5, 0xb3, 0x56, 0xab, 0xb5, 0x97, 0x40, 0xa6, 0x08, 0x99, 0x4e, 0xa7, 0x29,
+  0xc4, 0x76, 0x16, 0x00, 0xda, 0xda, 0xda, 0x4a, 0x41, 0xb3, 0x40, 0x29, 0x0f, 0x57, 0x4e, 0x8d,
+  0x95, 0x81, 0xb2, 0x71, 0xa9, 0x89, 0xcc, 0x0f, 0x80, 0xad, 0x0a, 0xa1, 0x3b, 0x06, 0x74, 0xe9,
+  0x78, 0xdf, 0x68, 0xa6, 0xde, 0xe4, 0x86, 0xfe, 0x4d, 0xff, 0x7a, 0x2e, 0xbe, 0x0b, 0x3d, 0x6f,
+  0xec, 0x5f, 0x35, 0x42, 0xe7, 0x5f, 0x8e, 0x07, 0x04, 0x8d, 0xfd, 0xc0, 0x06, 0xce, 0x00, 0x68,
+  0x2f, 0x1e, 0x5e, 0xc8, 0x60, 0xe6, 0x00, 0x0d, 0xad, 0x04, 0xb2, 0x94, 0xb6, 0x4d, 0xb3, 0xd3,
+  0xad, 0xd6, 0x6a, 0xfc, 0xcd, 0x89, 0x1a, 0x91, 0x5c, 0x36, 0xe6, 0xce, 0x6c, 0xee, 0xc2, 0x3f,
+  0x51, 0x63, 0xe2, 0xbb, 0x7e, 0xb0, 0x2b, 0x22, 0xa0, 0x2d, 0x5c, 0xca, 0x00, 0x44, 0x56, 0x20,
+  0x63, 0xec, 0xdb, 0xd7, 0x06, 0x25, 0x72, 0xf2, 0x6d, 0x16, 0xf8, 0x2b, 0x0f, 0xce, 0x77, 0x29,
+  0x03, 0x0b, 0xd9, 0x56, 0x4b, 0xb6, 0xd5, 0xe8, 0x78, 0x60, 0x6a, 0x0c, 0x4c, 0x41, 0x1f, 0x1a,
+  0x53, 0xb9, 0x70, 0xdc, 0xeb, 0x5d, 0x51, 0x3d, 0xf2, 0x57, 0x81, 0xa3, 0x02, 0x71, 0xa6, 0xd6,
+  0x55, 0x90, 0xbd, 0xef, 0xf9, 0xb0, 0xf9, 0x44, 0xa5, 0xe7, 0x71, 0xbc, 0xc6, 0x5c, 0x21, 0x81,
+  0xbb, 0xa2, 0xdd, 0x6a, 0x5d, 0xce, 0xe3, 0x43, 0xd8, 0x4e, 0xb8, 0x74, 0x25, 0xa0, 0x98, 0xba,
+  0xea, 0x2a, 0x06, 0xe2, 0x37, 0x08, 0x26, 0x50, 0x93, 0xc8, 0xf1, 0x81, 0x0b, 0x40, 0xc4, 0x6a,
+  0xe1, 0xc5, 0xa3, 0xfe, 0xa5, 0x0a, 0xa6, 0xae, 0xbf, 0x6e, 0x5c, 0xed, 0x8a, 0xb9, 0x63, 0xdb,
+  0xca, 0x8b, 0x4f, 0x98, 0x55, 0x93, 0xdf, 0xfa, 0xbd, 0xe3, 0xfe, 0x20, 0xab, 0x21, 0xcf, 0x50,
+  0xfb, 0x81, 0xce, 0xef, 0x79, 0xae, 0xb6, 0x3b, 0xcb, 0x2b, 0xd1, 0xee, 0x2e, 0xaf, 0xee, 0x24,
+  0xec, 0xeb, 0x2a, 0x8c, 0x9c, 0xe9, 0x75, 0x43, 0x1b, 0xc3, 0xae, 0xa0, 0x53, 0x36, 0xc6, 0x2a,
+  0x5a, 0x2b, 0x95, 0x10, 0x28, 0x41, 0x12, 0x5e, 0xc3, 0x89, 0xd4, 0x22, 0x04, 0xda, 0x61, 0x9e,
+  0x0a, 0x32, 0x27, 0x5b, 0x07, 0x72, 0xb9, 0x2b, 0xf0, 0xdf, 0x31, 0x78, 0x86, 0x80, 0x76, 0x2b,
+  0xdd, 0x3d, 0x51, 0x89, 0x28, 0xf2, 0x41, 0x3f, 0xdb, 0x40, 0x5c, 0xe8, 0xbb, 0x8e, 0xad, 0x05,
+  0x01, 0x4a, 0x5b, 0x2b, 0x88, 0xf5, 0x19, 0x59, 0x4d, 0x72, 0x34, 0x12, 0x10, 0xa8, 0x18, 0x28,
+  0x68, 0x7b, 0x3b, 0xc5, 0x4c, 0xe0, 0xb5, 0x16, 0xc5, 0xd8, 0x77, 0xed, 0x78, 0xc0, 0x55, 0x51,
+  0x84, 0xf6, 0x09, 0x27, 0x62, 0x8e, 0xdc, 0xc3, 0x8b, 0x3b, 0x4e, 0x49, 0xc7, 0xd9, 0x89, 0xd7,
+  0x9b, 0x24, 0x2e, 0x7c, 0x1b, 0xd8, 0x25, 0xed, 0x59, 0x29, 0x9d, 0xbf, 0xa6, 0x5b, 0x26, 0x82,
+  0x41, 0xb9, 0xbc, 0xcc, 0x33, 0xc6, 0xe0, 0x48, 0x8e, 0x63, 0x81, 0xb4, 0x9d, 0x55, 0x48, 0xcb,
+  0xe2, 0x91, 0x48, 0x5d, 0x81, 0x91, 0xa0, 0x3d, 0x4c, 0xfd, 0x00, 0x98, 0xb9, 0x5a, 0x2e, 0x55,
+  0x30, 0x91, 0xa1, 0xba, 0x8b, 0xbc, 0x66, 0x08, 0x27, 0x0a, 0xd0, 0x4c, 0x34, 0xe2, 0x8c, 0x21,
+  0x90, 0x87, 0x00, 0x5b, 0x28, 0x05, 0xde, 0x14, 0x71, 0x45, 0x4a, 0xba, 0xd1, 0xbc, 0x80, 0xec,
+  0xd9, 0xcb, 0x97, 0x2f, 0x13, 0x24, 0xfc, 0x4b, 0x71, 0xb1, 0x9c, 0x01, 0xe2, 0x30, 0x74, 0x2e,
+  0xd5, 0x2d, 0xc4, 0x80, 0x67, 0xca, 0x93, 0xc2, 0xa0, 0x22, 0x2e, 0x70, 0x08, 0xd1, 0x6d, 0x67,
+  0x42, 0xbf, 0x95, 0xc7, 0xa3, 0x61, 0x45, 0x44, 0xfe, 0x74, 0xea, 0x3a, 0xde, 0x13, 0x29, 0x62,
+  0x6c, 0x93, 0x28, 0x70, 0x1b, 0xe3, 0xc8, 0x0b, 0x13, 0x4d, 0x28, 0x55, 0xb3, 0xbc, 0x2e, 0xe5,
+  0x42, 0xc1, 0xfb, 0xd1, 0xe8, 0xfc, 0x2c, 0x17, 0x06, 0x9a, 0x80, 0x35, 0x41, 0x5a, 0xee, 0xde,
+  0x6e, 0xf3, 0x6e, 0xb7, 0x69, 0x59, 0x71, 0x4a, 0xa2, 0xa0, 0x3b, 0xe8, 0x38, 0x3a, 0x39, 0x03,
+  0xd3, 0x76, 0xd7, 0x7e, 0x80, 0xdd, 0x65, 0x1c, 0xa9, 0xe3, 0xcd, 0x55, 0xe0, 0x44, 0x0f, 0x54,
+  0x5d, 0x38, 0xc0, 0x2a, 0x08, 0xf1, 0x04, 0x4b, 0xdf, 0x31, 0x0d, 0x90, 0x96, 0x38, 0xec, 0x3c,
+  0xa5, 0xeb, 0x8a, 0x56, 0xb3, 0xdd, 0x0d, 0x0b, 0xea, 0x8e, 0x7c, 0xda, 0x95, 0xe0, 0x63, 0x59,
+  0xb5, 0x0a, 0x8c, 0x22, 0x77, 0x9f, 0x61, 0x11, 0x45, 0x86, 0x9b, 0x64, 0x71, 0xf3, 0x8e, 0xc5,
+  0x39, 0x13, 0xa1, 0x30, 0x7c, 0xa7, 0x2d, 0x19, 0x68, 0x6d, 0x8c, 0xab, 0xc1, 0xe3, 0x95, 0x2b,
+  0xab, 0x1b, 0x9c, 0x52, 0x0c, 0xfb, 0x47, 0xa3, 0x93, 0xf3, 0xb3, 0x5c, 0x18, 0x00, 0x37, 0x21,
+  0x03, 0x72, 0xe3, 0x12, 0xd4, 0x38, 0x8d, 0x07, 0xa8, 0x79, 0x20, 0xb7, 0xc7, 0x05, 0x81, 0xac,
+  0xf3, 0xbb, 0xc3, 0x2f, 0xa6, 0xd1, 0xc6, 0x70, 0xf5, 0x66, 0x68, 0xec, 0xec, 0xb4, 0xca, 0xbc,
+  0xa6, 0xa6, 0x56, 0x7a, 0x97, 0x32, 0xb5, 0x16, 0x4a, 0xbd, 0x28, 0x9a, 0xfe, 0x47, 0x82, 0x4a,
+  0x5e, 0x35, 0x34, 0xb8, 0xdb, 0x32, 0xb6, 0x48, 0xd0, 0xbf, 0x6c, 0x95, 0x38, 0xf5, 0xb1, 0xeb,
+  0x4f, 0xbe, 0x95, 0x9b, 0xd7, 0xbb, 0xf3, 0xe3, 0x7e, 0xb9, 0x8d, 0xc5, 0xce, 0x20, 0x28, 0x5a,
+  0xef, 0x2c, 0x48, 0xbd, 0x32, 0x7e, 0x37, 0x80, 0x15, 0x30, 0x12, 0xa9, 0x06, 0xc7, 0x71, 0x60,
+  0x4b, 0xa0, 0x96, 0x4a, 0x46, 0xd6, 0x76, 0x5d, 0xb4, 0xa7, 0x41, 0xad, 0xdc, 0xd4, 0xef, 0x0a,
+  0xce, 0x5a, 0x2f, 0x22, 0x7f, 0xf9, 0xc0, 0xd8, 0xd8, 0x64, 0x72, 0x0d, 0xbf, 0x90, 0x91, 0x85,
+  0xe8, 0x96, 0xdb, 0x6f, 0x2b, 0x17, 0x45, 0x48, 0xb6, 0x59, 0xa9, 0x96, 0x6d, 0xf2, 0xc3, 0xc1,
+  0xc3, 0xc0, 0xf4, 0xd8, 0xd0, 0x91, 0x2e, 0xfd, 0xd1, 0xc0, 0x91, 0x62, 0xfa, 0xa1, 0xb0, 0x61,
+  0x72, 0xc5, 0x85, 0x8c, 0x4e, 0xd9, 0x39, 0x7f, 0xf1, 0xac, 0xd3, 0xe9, 0x14, 0xad, 0xf7, 0xcd,
+  0xf9, 0xf9, 0xa8, 0x90, 0xbd, 0x4d, 0x21, 0xbf, 0x2f, 0xcd, 0xde, 0x5a, 0x39, 0x05, 0xb9, 0x45,
+  0x88, 0x31, 0xbf, 0xba, 0xdd, 0xee, 0x7d, 0x72, 0x7d, 0xb8, 0x92, 0x15, 0x4c, 0xa6, 0x77, 0x9a,
+  0x8b, 0x47, 0xc0, 0x01, 0xe9, 0x16, 0x0d, 0xc5, 0xf3, 0xbd, 0xc4, 0x91, 0x2f, 0xfd, 0xd8, 0x5f,
+  0x4f, 0x9d, 0x2b, 0x95, 0xd8, 0x8f, 0xe3, 0x41, 0x71, 0x66, 0xe4, 0xfc, 0x26, 0xdf, 0x82, 0xd9,
+  0x58, 0x5a, 0xad, 0x3a, 0xfd, 0xb7, 0xf9, 0x6b, 0x37, 0x31, 0xa3, 0x7f, 0x35, 0x1c, 0xcf, 0x26,
+  0x37, 0x96, 0x16, 0x2b, 0x7f, 0x85, 0xcf, 0xea, 0x96, 0xb8, 0x26, 0x3e, 0x5a, 0x1a, 0x07, 0xb2,
+  0x0e, 0xb3, 0x38, 0x13, 0x8b, 0x9c, 0x07, 0x7a, 0xb0, 0x6d, 0xd3, 0x83, 0x21, 0x3c, 0xf6, 0x62,
+  0x3b, 0x46, 0xf9, 0x90, 0xd4, 0x02, 0xb0, 0xa5, 0x5c, 0x45, 0x7e, 0x3e, 0x80, 0x77, 0x6e, 0x0f,
+  0xe0, 0x77, 0x26, 0x06, 0x69, 0xfa, 0xd9, 0xba, 0xf5, 0xd4, 0x62, 0xde, 0xb9, 0x2f, 0xd9, 0xe6,
+  0x32, 0x2e, 0x4d, 0xe3, 0xbb, 0x05, 0xe7, 0x96, 0x8e, 0xfd, 0x60, 0xf6, 0x9f, 0x28, 0xe0, 0xb0,
+  0x3f, 0x1a, 0x9d, 0x9c, 0xbd, 0xcd, 0xe7, 0x44, 0xa0, 0x47, 0x11, 0xec, 0x77, 0x77, 0xb2, 0xf5,
+  0xc3, 0xf5, 0x4d, 0xd6, 0x22, 0x5b, 0xf7, 0x1e, 0xe8, 0x59, 0xbb, 0xdd, 0x2e, 0xb2, 0x37, 0xa6,
+  0xd5, 0x95, 0x63, 0x05, 0x76, 0x53, 0x48, 0xa9, 0x4a, 0x27, 0x37, 0x91, 0xe8, 0xc0, 0x77, 0xef,
+  0xc9, 0x27, 0xef, 0x2b, 0x5b, 0x4a, 0xb5, 0x5c, 0xda, 0x5f, 0x33, 0xc1, 0x43, 0xab, 0x68, 0x67,
+  0xa7, 0x24, 0xc6, 0x1a, 0xb0, 0xbf, 0x28, 0xf7, 0x7c, 0xb6, 0xbd, 0xbd, 0x5d, 0xe6, 0xd8, 0x8c,
+  0xb2, 0xa8, 0x34, 0x0f, 0x34, 0x4e, 0xe0, 0x78, 0xcb, 0x55, 0xf4, 0x29, 0xba, 0x5e, 0xaa, 0x83,
+  0x0a, 0x75, 0x2d, 0x2a, 0x9f, 0xf3, 0x87, 0xd9, 0x31, 0x14, 0x50, 0x4e, 0x90, 0x33, 0x8d, 0x72,
+  0x12, 0x4d, 0xc6, 0x5c, 0x1a, 0x7e, 0x4d, 0xe3, 0xd9, 0xea, 0x96, 0x07, 0xcd, 0x00, 0xf9, 0x73,
+  0x67, 0x92, 0x5c, 0xa6, 0xcd, 0xa7, 0xe7, 0x79, 0x4d, 0x7e, 0xe6, 0xfa, 0xb3, 0x06, 0x22, 0xbe,
+  0xcb, 0x8f, 0x24, 0xd2, 0x30, 0x9d, 0x48, 0x26, 0xe8, 0x24, 0x8a, 0x97, 0x46, 0x05, 0xdb, 0xb6,
+  0xef, 0x10, 0x82, 0xd1, 0x22, 0xca, 0xa4, 0xec, 0x69, 0xb3, 0xe3, 0xee, 0xd8, 0x63, 0x16, 0x0c,
+  0x31, 0x0c, 0xe2, 0x33, 0xcd, 0x4b, 0x23, 0x41, 0xd1, 0x63, 0x4a, 0x6a, 0x82, 0x3c, 0xaa, 0x4a,
+  0x4a, 0x1c, 0x0f, 0xc7, 0x2e, 0x43, 0x20, 0x05, 0x03, 0xa7, 0x86, 0x84, 0xf2, 0xec, 0x74, 0xf7,
+  0xfd, 0x4d, 0xdd, 0x73, 0xdb, 0xdf, 0xe4, 0x56, 0xe1, 0x3e, 0xf6, 0x8b, 0x0e, 0x37, 0x36, 0xf6,
+  0x7f, 0x6a, 0x34, 0xca, 0x5a, 0x2b, 0x8d, 0x06, 0xcc, 0xb1, 0x9d, 0x4b, 0xe1, 0xd8, 0x07, 0x15,
+  0xee, 0xaf, 0x70, 0x67, 0x2f, 0x86, 0x51, 0x5f, 0xa2, 0xc2, 0x4d, 0x3c, 0x4a, 0xca, 0xe9, 0x6b,
+  0x1f, 0x98, 0xe6, 0xd1, 0x78, 0x5a, 0x57, 0x56, 0xc4, 0xc4, 0x95, 0x61, 0x78, 0x50, 0xd1, 0xf5,
+  0x65, 0xe5, 0xf0, 0xfc, 0xcd, 0x9b, 0xd3, 0x93, 0xb3, 0x3e, 0x10, 0x05, 0xb3, 0x09, 0xeb, 0x26,
+  0xa0, 0xcd, 0xa0, 0x4f, 0x0a, 0x49, 0xbd, 0xc5, 0xfe, 0x78, 0x05, 0x6e, 0xc6, 0x8b, 0x51, 0xc1,
+  0x48, 0x85, 0xe6, 0xc1, 0x07, 0x30, 0x64, 0x36, 0x03, 0x5a, 0x84, 0xef, 0x4d, 0x5c, 0x67, 0xf2,
+  0x0d, 0x68, 0x23, 0xc0, 0x10, 0x72, 0x6b, 0xab, 0x56, 0x39, 0x1c, 0x8e, 0x7a, 0x83, 0xd1, 0xfe,
+  0x26, 0x23, 0xb8, 0x1d, 0x5b, 0xb2, 0xda, 0x5f, 0x2a, 0xef, 0x1d, 0x4a, 0xc9, 0xaa, 0x82, 0x56,
+  0x86, 0x55, 0x40, 0x81, 0x0a, 0xfb, 0x34, 0x0c, 0x20, 0x93, 0xa9, 0x33, 0x43, 0x1c, 0x47, 0xe7,
+  0x67, 0x6f, 0x4e, 0xde, 0x9a, 0x58, 0xf4, 0xa9, 0xf5, 0x0f, 0x53, 0x14, 0x5c, 0xe5, 0x94, 0x48,
+  0x22, 0x57, 0xe2, 0xb0, 0x48, 0x74, 0x0d, 0x61, 0x8c, 0x13, 0xa0, 0x72, 0xb8, 0xbf, 0xc9, 0x5f,
+  0xa5, 0x7b, 0x94, 0x94, 0x01, 0x99, 0xad, 0xe2, 0x5a, 0x80, 0xf7, 0x28, 0x1c, 0x57, 0x24, 0xc9,
+  0x37, 0xe7, 0xc5, 0xc6, 0xf1, 0xc1, 0x79, 0xc3, 0xe9, 0x95, 0xd5, 0x42, 0xe6, 0xf7, 0xcf, 0x46,
+  0x83, 0x8f, 0x99, 0x53, 0xdf, 0x85, 0x8a, 0x13, 0xe3, 0x12, 0x5c, 0x6d, 0x12, 0x64, 0xbf, 0x77,
+  0x3a, 0xfa, 0xed, 0xa1, 0xc8, 0xd2, 0x54, 0xb9, 0x04, 0x5f, 0x07, 0xf0, 0xf5, 0xde, 0xbe, 0x1d,
+  0x9c, 0x3f, 0x14, 0x1b, 0xa5, 0xcb, 0x25, 0x88, 0xb6, 0x00, 0xd1, 0x05, 0x28, 0x98, 0x71, 0xc6,
+  0x12, 0x66, 0x67, 0x12, 0xdf, 0x0c, 0x9b, 0x39, 0xfb, 0x65, 0x26, 0x27, 0xc6, 0x03, 0xfb, 0x47,
+  0x0d, 0x5b, 0x45, 0xdc, 0x2b, 0xad, 0x1c, 0x0e, 0xc0, 0x34, 0x3f, 0xc6, 0xe6, 0x52, 0x82, 0x9e,
+  0x1c, 0xaa, 0x99, 0xa4, 0xe6, 0x25, 0x09, 0x2e, 0x07, 0x75, 0x39, 0x31, 0x45, 0x02, 0xa5, 0x06,
+  0x6d, 0x42, 0x31, 0x9b, 0x8b, 0x8d, 0x6e, 0xde, 0x39, 0x3c, 0x01, 0xf9, 0xbd, 0x1f, 0x62, 0xb1,
+  0xcd, 0x46, 0x00, 0x20, 0x1e, 0x43, 0x6f, 0x2d, 0x03, 0x25, 0x99, 0x60, 0xed, 0xbe, 0x2b, 0xe0,
+  0xfd, 0xa4, 0xed, 0x7b, 0xee, 0xf5, 0xe1, 0xa9, 0x2f, 0xd1, 0x35, 0x36, 0x9b, 0xcd, 0xfd, 0xcd,
+  0x78, 0xae, 0x5e, 0x5a, 0xd8, 0x52, 0xbb, 0x43, 0xbd, 0xed, 0x3d, 0xd6, 0xa5, 0xae, 0xf0, 0xf2,
+  0xe2, 0x14, 0x8e, 0x83, 0xd6, 0xdd, 0xff, 0xe3, 0xe2, 0x3c, 0x6f, 0xde, 0xa5, 0x92, 0xe4, 0xfe,
+  0x83, 0x81, 0x67, 0xed, 0x2c, 0x55, 0x8c, 0xe5, 0xf7, 0x93, 0x8b, 0xfe, 0xfd, 0x38, 0x8c, 0xc5,
+  0x13, 0xd7, 0x0f, 0x55, 0xce, 0x4b, 0x1c, 0x9d, 0x9e, 0x0f, 0x73, 0x58, 0x52, 0xc7, 0x76, 0xab,
+  0xad, 0xb3, 0x5f, 0xb8, 0x4f, 0x7a, 0xec, 0x47, 0x9e, 0x20, 0xbf, 0x38, 0x73, 0x4c, 0x25, 0x57,
+  0x90, 0x81, 0x4e, 0xb6, 0x52, 0xee, 0x53, 0x8a, 0x76, 0xf8, 0xae, 0xf7, 0x07, 0x38, 0xa2, 0xb3,
+  0xb7, 0x7d, 0x61, 0x4d, 0x16, 0xb5, 0xfd, 0x4d, 0x86, 0xc6, 0x73, 0x8c, 0xf5, 0x71, 0x8e, 0x96,
+  0x20, 0x28, 0xf0, 0x4e, 0xa7, 0x5a, 0x06, 0xff, 0x00, 0x02, 0x51, 0xcb, 0xaa, 0x42, 0xe0, 0x8b,
+  0xaa, 0xf5, 0x46, 0x17, 0xd8, 0xd7, 0xc8, 0x0b, 0x00, 0xd0, 0x50, 0x8a, 0x23, 0xcc, 0x14, 0x87,
+  0xa3, 0xc3, 0x74, 0xd6, 0xc0, 0x95, 0x15, 0x6c, 0xb4, 0x1c, 0x54, 0xda, 0xad, 0x0a, 0x16, 0x13,
+  0x07, 0x15, 0xc8, 0x0c, 0x70, 0x0f, 0x5a, 0x75, 0x50, 0x59, 0x2d, 0x6d, 0x19, 0xa9, 0x0f, 0x28,
+  0x22, 0xda, 0xa6, 0xf6, 0x74, 0x02, 0x91, 0xbe, 0x17, 0x25, 0xf4, 0x91, 0xc5, 0x6a, 0x1c, 0x90,
+  0x36, 0x31, 0x75, 0xf0, 0xc1, 0xd4, 0x1d, 0x76, 0x5b, 0x69, 0x8c, 0xcb, 0xa8, 0x43, 0xe6, 0xf3,
+  0xa1, 0x02, 0x39, 0x3d, 0x3f, 0xfa, 0xa7, 0x18, 0x9d, 0xbc, 0x03, 0x81, 0x2c, 0xc2, 0xbf, 0x4b,
+  0x20, 0xd8, 0x37, 0x02, 0x81, 0x40, 0xde, 0xf5, 0x78, 0x91, 0xe0, 0x5a, 0x2d, 0x92, 0x6e, 0x2b,
+  0x96, 0x09, 0x7c, 0xc1, 0x27, 0x78, 0xf6, 0x25, 0x0a, 0xea, 0x16, 0xf9, 0xd0, 0xae, 0xb5, 0xa7,
+  0xd3, 0xcb, 0xe4, 0x3e, 0x4a, 0x42, 0x44, 0xec, 0x21, 0x68, 0xcc, 0x5f, 0x2a, 0xa3, 0x77, 0x27,
+  0x67, 0x02, 0x6c, 0xe6, 0xb4, 0xff, 0x37, 0x89, 0x07, 0x98, 0xfb, 0x34, 0x73, 0x81, 0x85, 0x5a,
+  0x34, 0xb1, 0x60, 0x76, 0x6e, 0x91, 0x05, 0x6e, 0x51, 0x7b, 0x32, 0x6d, 0x8f, 0xb6, 0x14, 0x24,
+  0xec, 0xb0, 0xdd, 0xfd, 0x4b, 0x85, 0x00, 0x9e, 0xeb, 0x6f, 0x15, 0x82, 0xbc, 0x7a, 0xa2, 0x10,
+  0xe4, 0x55, 0xe2, 0xb2, 0x62, 0x31, 0xb4, 0x6f, 0x95, 0x03, 0xec, 0x52, 0x7b, 0x32, 0x79, 0x8f,
+  0x97, 0x03, 0xd0, 0x76, 0xd8, 0x7e, 0xf9, 0x97, 0x0a, 0xe2, 0x82, 0x7a, 0x16, 0x9b, 0x02, 0x32,
+  0xb7, 0x8b, 0xbf, 0x49, 0x16, 0xa1, 0x5c, 0x2c, 0xd1, 0x5f, 0x3d, 0x5e, 0x18, 0xb8, 0x32, 0x96,
+  0x46, 0xec, 0xab, 0xca, 0x25, 0x41, 0x7b, 0xd4, 0x9e, 0x4e, 0x5d, 0xfb, 0xb1, 0xb2, 0x20, 0xd2,
+  0x0e, 0xb7, 0x9e, 0x24, 0x8a, 0x27, 0x64, 0x54, 0x90, 0x26, 0xab, 0x68, 0xc8, 0x22, 0xa4, 0x74,
+  0x68, 0xd0, 0x1f, 0xf6, 0x47, 0x8f, 0xca, 0x87, 0x42, 0x79, 0xa9, 0x4c, 0x0c, 0xc3, 0xde, 0x87,
+  0xa7, 0x27, 0x54, 0x46, 0xd1, 0xf4, 0xa4, 0x94, 0xea, 0x1f, 0xbd, 0x0f, 0xbd, 0xe1, 0xd1, 0xe0,
+  0xe4, 0x62, 0x64, 0x26, 0x54, 0xe1, 0x24, 0x70, 0x96, 0xd1, 0xe1, 0xc6, 0xe6, 0x26, 0x43, 0x75,
+  0x67, 0x6d, 0xd4, 0x1b, 0xf5, 0x0d, 0xc0, 0x06, 0x6c, 0x1e, 0x46, 0x42, 0xd7, 0x54, 0x07, 0xc2,
+  0xf6, 0x27, 0xab, 0x05, 0x54, 0x38, 0xcd, 0x99, 0x8a, 0xfa, 0xae, 0xc2, 0xcf, 0xd7, 0xd7, 0x27,
+  0xb6, 0x55, 0x35, 0x4b, 0xad, 0x6a, 0x6d, 0x2f, 0x5e, 0x17, 0x5d, 0xc1, 0x22, 0x86, 0xe2, 0x92,
+  0x23, 0xac, 0xc9, 0xaf, 0x40, 0x13, 0x3a, 0x36, 0x4e, 0x72, 0x55, 0x24, 0xf4, 0xf3, 0x1a, 0xee,
+  0x66, 0x30, 0x28, 0x84, 0x05, 0x3d, 0x0f, 0x6a, 0x56, 0x58, 0xfb, 0x6b, 0x8b, 0x61, 0xa0, 0x90,
+  0x03, 0x54, 0x58, 0x00, 0x75, 0x35, 0x68, 0xb2, 0x0a, 0xf0, 0xed, 0x07, 0xd6, 0x1d, 0x00, 0xd5,
+  0x40, 0x27, 0x1c, 0xac, 0x3c, 0x0f, 0x9b, 0x65, 0x07, 0x62, 0x2a, 0x5d, 0xbc, 0x46, 0x64, 0xf0,
+  0xb9, 0xbe, 0xce, 0x3d, 0x10, 0x51, 0xb0, 0xd2, 0x50, 0x7f, 0xfc, 0x15, 0x6a, 0x0a, 0x3c, 0xd7,
+  0xa7, 0xcf, 0x0c, 0xc1, 0x52, 0xe3, 0x4d, 0x20, 0x17, 0x06, 0x46, 0x04, 0x1d, 0x07, 0x72, 0x9d,
+  0x42, 0xc2, 0xb5, 0x52, 0xcb, 0x13, 0x1b, 0x00, 0x8d, 0xb6, 0x26, 0x45, 0xb9, 0xae, 0x46, 0xa3,
+  0xb5, 0x19, 0xd8, 0x7a, 0x4c, 0xef, 0x87, 0xaa, 0xa1, 0x58, 0xaa, 0x00, 0xca, 0x17, 0xbc, 0xfe,
+  0x10, 0x11, 0xbe, 0x0b, 0xaa, 0x43, 0xf9, 0x14, 0x4d, 0xe6, 0xca, 0x16, 0xe3, 0x6b, 0x61, 0x2b,
+  0x37, 0x92, 0x61, 0x8a, 0xf7, 0xb5, 0x0c, 0x15, 0x63, 0x66, 0x2c, 0x43, 0x04, 0x8a, 0x93, 0x63,
+  0xe1, 0x4f, 0x45, 0x34, 0x57, 0x44, 0x8e, 0x98, 0x12, 0x89, 0x72, 0xb9, 0x74, 0x1d, 0x65, 0xd7,
+  0x61, 0x32, 0xac, 0xc0, 0x06, 0xcb, 0x86, 0xe6, 0x3b, 0xd6, 0x69, 0x67, 0x30, 0x85, 0x68, 0xaa,
+  0x72, 0x49, 0x5a, 0xad, 0x8b, 0xaa, 0xae, 0x28, 0xf1, 0x33, 0xad, 0x07, 0xf1, 0x37, 0xaa, 0xe7,
+  0xaa, 0x9f, 0xf7, 0x8c, 0xf5, 0x47, 0xd8, 0x32, 0x62, 0x04, 0xf8, 0x4c, 0x08, 0x67, 0xe1, 0x25,
+  0x0c, 0xfd, 0x9c, 0xb6, 0x5a, 0xfa, 0xe7, 0x14, 0x17, 0xe5, 0x94, 0xe8, 0xe4, 0xec, 0x64, 0x64,
+  0xea, 0xd0, 0x74, 0xe5, 0x91, 0xfd, 0xd1, 0x1b, 0x2a, 0xab, 0x46, 0x6d, 0x1e, 0x6e, 0x0b, 0x1d,
+  0x91, 0x66, 0x58, 0xd4, 0x75, 0x5b, 0x3b, 0x9e, 0xed, 0xaf, 0x9b, 0xd2, 0xb6, 0xfb, 0x97, 0x40,
+  0xf0, 0x29, 0xa4, 0x8c, 0x0a, 0x8a, 0x7a, 0x50, 0x2d, 0x9a, 0x0a, 0xfb, 0x99, 0x6b, 0x68, 0x49,
+  0xa0, 0xfe, 0x67, 0xa5, 0xc2, 0xa8, 0xe7, 0x39, 0x0b, 0x89, 0x1b, 0x90, 0xe4, 0x2c, 0x62, 0x0e,
+  0x8d, 0x6f, 0x30, 0x07, 0xaf, 0xbd, 0x89, 0x88, 0x1c, 0x60, 0xd8, 0xda, 0x89, 0xe6, 0xa2, 0x3f,
+  0xbc, 0xd8, 0xea, 0xc0, 0xc8, 0x54, 0x81, 0x0c, 0xac, 0xea, 0x26, 0x8e, 0x7c, 0x09, 0x61, 0xce,
+  0xab, 0x28, 0x3c, 0xa8, 0x8a, 0x17, 0xe2, 0x9d, 0x8c, 0xe6, 0xcd, 0xa9, 0xeb, 0xfb, 0x81, 0x75,
+  0x0c, 0x3e, 0xaf, 0xe9, 0xf9, 0x6b, 0x20, 0x7a, 0x13, 0x9b, 0x6f, 0xad, 0x5a, 0xad, 0x39, 0x41,
+  0xd9, 0x59, 0x00, 0x39, 0x38, 0x14, 0xdf, 0x6f, 0x8c, 0x7d, 0x4e, 0xf1, 0x7e, 0x20, 0x8c, 0xa0,
+  0xb0, 0x5b, 0xd4, 0x85, 0x1f, 0x88, 0xa5, 0xef, 0xba, 0xa8, 0x88, 0x70, 0xf0, 0x71, 0xe0, 0xaf,
+  0x43, 0x05, 0xdc, 0x44, 0x0a, 0x7c, 0x70, 0xc1, 0x74, 0xc4, 0xa1, 0xbf, 0x0a, 0x26, 0x0a, 0x16,
+  0x3b, 0x53, 0x61, 0xe9, 0xe3, 0x1b, 0x03, 0x35, 0xdd, 0x0f, 0x03, 0x91, 0x78, 0xa0, 0xa6, 0x43,
+  0xc2, 0xcc, 0xbc, 0xba, 0x11, 0x0a, 0x54, 0x5b, 0x8f, 0x83, 0xb7, 0x3a, 0xc1, 0x8e, 0x28, 0xb8,
+  0x4a, 0x0b, 0xf7, 0x1c, 0x46, 0x32, 0x5a, 0x85, 0x75, 0xa4, 0x97, 0x27, 0x27, 0x14, 0xfe, 0xa6,
+  0x40, 0xcc, 0x63, 0x25, 0x23, 0x21, 0x83, 0x00, 0xa8, 0x0d, 0x85, 0xba, 0x54, 0xc1, 0xb5, 0xe8,
+  0x84, 0x7b, 0xa2, 0x1b, 0xa2, 0x86, 0x85, 0x8e, 0xab, 0xbc, 0x89, 0x12, 0x0b, 0x25, 0xbd, 0x90,
+  0xf5, 0xcd, 0xf1, 0xbe, 0x81, 0xf9, 0x80, 0xe5, 0xaf, 0xbd, 0x8d, 0xec, 0x66, 0x9a, 0x07, 0xdc,
+  0x7d, 0x85, 0x23, 0x18, 0xdc, 0x6a, 0x18, 0x96, 0x74, 0x88, 0x37, 0xb5, 0xad, 0x9a, 0x98, 0xf9,
+  0xda, 0x06, 0xf5, 0x19, 0xea, 0xcc, 0xd1, 0xbd, 0x8d, 0x9b, 0x8d, 0x54, 0x45, 0xb2, 0x7a, 0x41,
+  0xc8, 0xb5, 0x2b, 0x49, 0x2e, 0xb2, 0xef, 0xf7, 0x42, 0xf1, 0xd4, 0xaa, 0x56, 0x2c, 0xf0, 0x30,
+  0xb0, 0x8a, 0xe4, 0x0a, 0x01, 0xce, 0x4a, 0xc6, 0x9b, 0xe0, 0x6d, 0x61, 0xed, 0xef, 0x34, 0xa1,
+  0x21, 0x3a, 0xad, 0x3a, 0x92, 0x4a, 0x8b, 0xd8, 0x1f, 0xc1, 0xaa, 0xce, 0x4b, 0x6a, 0xf1, 0x6b,
+  0x1f, 0x16, 0xe3, 0xa2, 0x9f, 0x06, 0x3c, 0x99, 0x1e, 0xfb, 0xb1, 0x9b, 0x8d, 0x82, 0x67, 0x1d,
+  0xf4, 0x7b, 0xef, 0x4c, 0xb3, 0x80, 0xf1, 0x73, 0x70, 0x48, 0x6c, 0xcb, 0xe0, 0x23, 0xd8, 0xfe,
+  0xa9, 0x36, 0xd8, 0x15, 0x15, 0x59, 0xb7, 0xeb, 0x41, 0x3d, 0x60, 0x67, 0x56, 0x47, 0x83, 0xac,
+  0xbb, 0xce, 0x17, 0x89, 0xff, 0xb2, 0xeb, 0x34, 0xb3, 0x92, 0x72, 0x2d, 0xa7, 0x22, 0x06, 0xdb,
+  0xc8, 0x05, 0x78, 0x6a, 0x6d, 0x6a, 0x1c, 0x28, 0xbd, 0xc2, 0xdf, 0x42, 0xe6, 0x8f, 0x0a, 0x9b,
+  0xbe, 0x07, 0xbe, 0x22, 0x94, 0xe4, 0x5e, 0x55, 0x2a, 0x54, 0x46, 0x71, 0x89, 0xc0, 0x26, 0x84,
+  0x7f, 0xd9, 0x0c, 0xc1, 0xe1, 0x80, 0xf7, 0xae, 0x57, 0x6b, 0xcd, 0x85, 0x5c, 0x5a, 0x67, 0xab,
+  0xc5, 0x58, 0xc5, 0x97, 0xdb, 0xe8, 0x8d, 0xae, 0x59, 0xf7, 0xac, 0xef, 0x42, 0xee, 0x8a, 0xcb,
+  0x4f, 0xad, 0xcf, 0x75, 0x81, 0xf7, 0x02, 0x9f, 0xda, 0xf0, 0x81, 0x5d, 0xf6, 0x4f, 0x1d, 0xfc,
+  0xe0, 0x33, 0xe1, 0xaf, 0x5b, 0x9f, 0xeb, 0xe4, 0x6b, 0xf0, 0x7b, 0x1b, 0xbe, 0xf1, 0x84, 0xf8,
+  0xdd, 0xe5, 0x6f, 0x5a, 0xfb, 0x12, 0xbe, 0xc3, 0x35, 0x7e, 0xfd, 0xe7, 0x67, 0xc1, 0xf6, 0x76,
+  0x93, 0x90, 0xad, 0x82, 0xc0, 0x47, 0x8d, 0x48, 0x74, 0x6b, 0x8f, 0x14, 0xdd, 0x38, 0x2c, 0x68,
+  0x94, 0xe6, 0x4e, 0x88, 0xee, 0xd6, 0x89, 0x42, 0xe5, 0x4e, 0x33, 0x2a, 0x97, 0xda, 0x8c, 0xe6,
+  0x5c, 0xec, 0x19, 0x42, 0x02, 0x56, 0x6b, 0xdc, 0xaa, 0x06, 0x63, 0xf0, 0xac, 0x00, 0x99, 0x13,
+  0x34, 0xfd, 0x6f, 0xe2, 0x15, 0xfc, 0xf8, 0x1a, 0xfa, 0x1e, 0xac, 0xd9, 0x15, 0x17, 0x81, 0xbf,
+  0x70, 0x42, 0xd5, 0x0c, 0x14, 0x06, 0x14, 0xab, 0x66, 0x2e, 0x31, 0xf8, 0xa2, 0xc1, 0xec, 0x41,
+  0x12, 0x92, 0x73, 0x16, 0x60, 0xf2, 0x11, 0x99, 0xce, 0x34, 0x99, 0x01, 0x4c, 0xc7, 0x35, 0x91,
+  0x89, 0x56, 0xa9, 0xf1, 0xe1, 0x88, 0x19, 0x42, 0x49, 0x72, 0x12, 0xa1, 0x46, 0x10, 0x25, 0x60,
+  0x20, 0xfe, 0xfd, 0x6f, 0x0a, 0xa7, 0x22, 0x17, 0x4c, 0x69, 0x14, 0x05, 0x83, 0x13, 0x68, 0xdc,
+  0x8c, 0xab, 0xbc, 0x36, 0xfe, 0x15, 0x74, 0xbb, 0x9d, 0x3a, 0xc1, 0x9e, 0x6d, 0x0b, 0x6e, 0xd5,
+  0x41, 0x78, 0xe3, 0xf8, 0xaa, 0x1d, 0x1c, 0xad, 0xb2, 0xc1, 0x1b, 0xb4, 0x62, 0xc7, 0xa6, 0xc3,
+  0x6f, 0x73, 0xb9, 0x0a, 0xe7, 0xac, 0x32, 0x4c, 0x2a, 0xe9, 0x0a, 0x4f, 0x47, 0x35, 0x98, 0xe2,
+  0x2d, 0x43, 0xb3, 0x15, 0xcb, 0x3e, 0xf5, 0xeb, 0x64, 0x2e, 0x53, 0x08, 0x2a, 0xe1, 0x1c, 0x5f,
+  0xae, 0x92, 0xd8, 0xc8, 0x67, 0x71, 0xb0, 0x45, 0xff, 0x05, 0xae, 0x6e, 0x32, 0xc7, 0x23, 0xdb,
+  0x42, 0x7a, 0x36, 0xe8, 0x82, 0x8d, 0x91, 0x1c, 0xe7, 0xc8, 0x60, 0x62, 0x12, 0x16, 0xae, 0xc5,
+  0x4f, 0x70, 0x92, 0x95, 0x67, 0x2b, 0xc0, 0x08, 0xd3, 0x7f, 0xf9, 0x45, 0x98, 0x03, 0x3a, 0xe6,
+  0xc7, 0xa4, 0xa7, 0x29, 0x80, 0x9e, 0xc4, 0x36, 0xe0, 0xfa, 0xd2, 0x26, 0xb2, 0xac, 0x1c, 0xad,
+  0xef, 0x29, 0x7d, 0xe6, 0xe0, 0x9d, 0x74, 0x32, 0xcd, 0xfd, 0x51, 0xf3, 0x93, 0x3d, 0x51, 0xf5,
+  0xe3, 0x9d, 0x6e, 0xf5, 0x75, 0xd9, 0xae, 0x28, 0x58, 0x24, 0x66, 0x56, 0x47, 0x7c, 0xe9, 0x01,
+  0x74, 0xe9, 0x2c, 0xf3, 0xcf, 0xd3, 0xde, 0x70, 0xb4, 0x2b, 0x7e, 0xfe, 0x9e, 0x20, 0xbe, 0x99,
+  0x2c, 0xc4, 0x7f, 0x19, 0x00, 0x79, 0xf3, 0x7f, 0xff, 0xfb, 0xa7, 0x41, 0x2d, 0x67, 0xfa, 0xef,
+  0x4f, 0xac, 0x5a, 0x89, 0x17, 0x7b, 0x7d, 0x72, 0xd6, 0x1b, 0x7c, 0x14, 0x6f, 0x06, 0xbd, 0x77,
+  0xf1, 0xcb, 0xe4, 0xc4, 0x99, 0x0d, 0x95, 0x76, 0x66, 0x4d, 0xbc, 0xa9, 0xea, 0x34, 0xc6, 0xd7,
+  0x70, 0x62, 0xbe, 0x2c, 0xa9, 0x23, 0xcb, 0x3d, 0xb1, 0xcd, 0x30, 0xba, 0xc1, 0x0b, 0x85, 0x85,
+  0xcf, 0xb6, 0xc0, 0x9f, 0x44, 0xae, 0xc2, 0xeb, 0x19, 0x47, 0x7a, 0x35, 0xc3, 0x28, 0xf1, 0xcd,
+  0x36, 0xc7, 0xf3, 0xf1, 0x6a, 0x6a, 0x7a, 0xb4, 0x4b, 0xed, 0xd0, 0x40, 0xe1, 0xe5, 0x07, 0x47,
+  0xad, 0x69, 0x7c, 0x4f, 0xf3, 0xf2, 0x12, 0xd9, 0xf4, 0x1e, 0xd0, 0xef, 0x58, 0xa0, 0x66, 0x28,
+  0xb8, 0x76, 0x0d, 0xa4, 0x1e, 0xad, 0x02, 0x4f, 0x78, 0x2b, 0xd7, 0x65, 0xf7, 0x40, 0xe4, 0x7f,
+  0xf9, 0xd0, 0x1f, 0x60, 0x27, 0x37, 0x41, 0x3c, 0xd5, 0x96, 0xc4, 0x7c, 0xc7, 0x22, 0x09, 0x9c,
+  0x4e, 0x8a, 0xaf, 0x5d, 0xab, 0xa7, 0xa2, 0x37, 0x46, 0xb6, 0x3a, 0xf8, 0xc8, 0x07, 0x93, 0x4a,
+  0x3d, 0x21, 0x0a, 0xb3, 0xa3, 0x3b, 0x99, 0x51, 0x3e, 0xfc, 0x2e, 0xa4, 0x8a, 0xb1, 0x23, 0x8b,
+  0xe3, 0xdb, 0x8a, 0xe4, 0x96, 0xac, 0x6c, 0xbf, 0xb4, 0x3a, 0x7a, 0x25, 0xce, 0x9a, 0x82, 0x9f,
+  0xb3, 0x28, 0x95, 0xa5, 0x44, 0x14, 0x7e, 0xec, 0xf3, 0x1a, 0xf8, 0x7c, 0xf1, 0xa2, 0x96, 0xf1,
+  0xd8, 0x3e, 0x4c, 0x69, 0x77, 0x20, 0x95, 0x71, 0xc4, 0x73, 0xa1, 0xef, 0x55, 0x59, 0x32, 0xbc,
+  0xbb, 0x61, 0x71, 0xc6, 0x01, 0xfd, 0x1a, 0x7b, 0x6b, 0x83, 0x00, 0x1f, 0x70, 0xb4, 0x63, 0xf2,
+  0xc5, 0xd4, 0x95, 0xb3, 0x30, 0xbb, 0x04, 0xc6, 0xb7, 0x6a, 0x86, 0x65, 0x6a, 0x56, 0xd3, 0x66,
+  0xb1, 0xfa, 0x30, 0xb7, 0x87, 0xbf, 0xf7, 0xfb, 0x17, 0xc2, 0xea, 0xa0, 0x38, 0x96, 0xae, 0x9c,
+  0x28, 0x4e, 0x2f, 0x74, 0x42, 0xcc, 0x73, 0x8e, 0xfb, 0xa7, 0xa3, 0x9e, 0xb0, 0x00, 0x23, 0x27,
+  0xc8, 0x21, 0xb8, 0xeb, 0x54, 0x25, 0x0c, 0xe3, 0x32, 0xdc, 0x74, 0x9a, 0x34, 0xef, 0x8b, 0x16,
+  0x78, 0x65, 0x70, 0xdb, 0x08, 0xa9, 0x82, 0x57, 0xd6, 0x9f, 0xaf, 0x42, 0x07, 0x52, 0x1a, 0x4a,
+  0xed, 0x92, 0xc9, 0x25, 0x3e, 0x1d, 0x52, 0x22, 0x79, 0xfd, 0x7a, 0x35, 0x9d, 0x42, 0xce, 0x99,
+  0x71, 0xe0, 0xa0, 0x5f, 0x69, 0x48, 0xcc, 0x2b, 0x4b, 0x4e, 0x4f, 0x93, 0x47, 0x2d, 0xa0, 0x8b,
+  0x3f, 0x71, 0x22, 0xaa, 0x79, 0x62, 0x8e, 0xb0, 0x2c, 0x50, 0xc3, 0xc8, 0x7d, 0x02, 0x4f, 0x8c,
+  0x02, 0x22, 0xbe, 0x62, 0x35, 0xe5, 0x05, 0xc2, 0xef, 0x4b, 0x38, 0xec, 0x12, 0x09, 0xa1, 0xb9,
+  0x9f, 0x96, 0x4d, 0xf9, 0x19, 0xf7, 0x4f, 0xb6, 0x34, 0xab, 0x07, 0x5e, 0x4c, 0x90, 0xe4, 0x19,
+  0x49, 0x52, 0xeb, 0xd0, 0xfa, 0xa4, 0xec, 0x6e, 0x4e, 0x1d, 0x17, 0xf2, 0x39, 0x46, 0xbd, 0x6c,
+  0x92, 0x8c, 0xc5, 0x2f, 0xa2, 0x75, 0xd5, 0x02, 0xcb, 0x41, 0x63, 0xb9, 0x18, 0x7d, 0xf9, 0xed,
+  0x64, 0x94, 0xce, 0xc7, 0xc0, 0x4f, 0x93, 0x59, 0x81, 0x96, 0xda, 0x5f, 0x2f, 0xf3, 0xce, 0x3a,
+  0xbe, 0x4a, 0xcf, 0x04, 0x3d, 0x23, 0x6d, 0x36, 0x63, 0x9e, 0x91, 0x1a, 0x16, 0xa2, 0x1d, 0x97,
+  0x6b, 0xa2, 0x58, 0x1d, 0x25, 0x25, 0x16, 0xc4, 0xb5, 0x6b, 0x31, 0x87, 0x92, 0x1b, 0x58, 0x3d,
+  0xc6, 0x0b, 0x24, 0xd0, 0x62, 0x88, 0xdd, 0x41, 0x44, 0x6f, 0x67, 0x38, 0xeb, 0x97, 0x62, 0x0a,
+  0xe6, 0xcf, 0x8c, 0x29, 0x3a, 0xb9, 0x84, 0x90, 0x14, 0x6e, 0x78, 0x1c, 0x7e, 0xcc, 0x7d, 0x47,
+  0xda, 0x99, 0xde, 0xee, 0x72, 0x46, 0xc5, 0xcb, 0xf8, 0xde, 0xf5, 0x75, 0xe4, 0xdd, 0xb5, 0x34,
+  0xbd, 0xb1, 0xad, 0xc6, 0xa5, 0x04, 0x6a, 0x48, 0xc2, 0x80, 0xd8, 0xb0, 0xf9, 0x4d, 0x32, 0xf5,
+  0x0a, 0xce, 0x58, 0xf3, 0xaa, 0xfa, 0x02, 0xb9, 0xba, 0x67, 0x4c, 0xc8, 0xc6, 0x80, 0xaa, 0xbe,
+  0x5a, 0xae, 0x16, 0x6a, 0x86, 0x22, 0xba, 0xa4, 0x64, 0xfc, 0x64, 0xa4, 0x02, 0x9f, 0x6f, 0xc7,
+  0x5d, 0x3e, 0xbf, 0x19, 0xf9, 0xef, 0xf1, 0x01, 0xef, 0x11, 0xc8, 0x29, 0x13, 0x03, 0x13, 0x66,
+  0xe4, 0xd0, 0xa4, 0x79, 0x05, 0x98, 0xee, 0x70, 0x74, 0x7e, 0x41, 0x86, 0x4b, 0x97, 0xd4, 0x44,
+  0x75, 0xba, 0x8e, 0x88, 0xc5, 0xaa, 0xb0, 0xc9, 0x30, 0xab, 0xca, 0x4f, 0xb2, 0xa0, 0x30, 0x4c,
+  0x90, 0x18, 0xd5, 0x98, 0x8e, 0xb8, 0x94, 0xc4, 0x70, 0xc3, 0x04, 0x75, 0x3e, 0x91, 0x03, 0x14,
+  0x8e, 0xc1, 0xf5, 0x90, 0x5e, 0xeb, 0xf9, 0x41, 0xcf, 0x75, 0xad, 0x6a, 0xf2, 0x88, 0x0f, 0x42,
+  0x69, 0x6c, 0x6f, 0x16, 0xfc, 0x0a, 0xe8, 0x8d, 0x3a, 0x67, 0x5c, 0x4a, 0x49, 0xfc, 0xec, 0x0f,
+  0x69, 0x21, 0x93, 0x36, 0x78, 0xc2, 0x5c, 0x28, 0x0b, 0xa6, 0x7c, 0xaf, 0x7d, 0x3c, 0xe8, 0xfd,
+  0x7e, 0x72, 0xf6, 0x36, 0x17, 0x4c, 0x07, 0x10, 0x11, 0xb1, 0x60, 0x84, 0x04, 0x46, 0xbf, 0x86,
+  0x10, 0x01, 0x9c, 0x67, 0x2f, 0xb1, 0xe3, 0xa9, 0xc4, 0x83, 0x5d, 0x83, 0x50, 0xe5, 0x32, 0x84,
+  0x7c, 0x05, 0xcb, 0xd8, 0xba, 0xf0, 0xfc, 0x08, 0x81, 0xec, 0x9d, 0x28, 0x3c, 0xa4, 0xba, 0x4d,
+  0x40, 0x2b, 0x0a, 0x4d, 0xd5, 0xb6, 0x51, 0x06, 0x49, 0x87, 0xe3, 0x95, 0x80, 0x61, 0x5d, 0xbb,
+  0x21, 0x20, 0xae, 0x7a, 0x85, 0x7e, 0x9e, 0x67, 0xb4, 0x42, 0x22, 0x7a, 0x6b, 0x1d, 0x67, 0x70,
+  0x31, 0xbf, 0xe0, 0x77, 0x64, 0x15, 0xfc, 0x68, 0xa2, 0x2b, 0x10, 0x0d, 0x08, 0x55, 0xcd, 0x0e,
+  0x04, 0x21, 0x3b, 0x22, 0x36, 0x60, 0xf6, 0x65, 0x3d, 0xa0, 0x74, 0x37, 0x4d, 0x92, 0xd7, 0x30,
+  0xcd, 0xd1, 0x15, 0xba, 0x2b, 0xc8, 0xd6, 0xaf, 0x29, 0xb3, 0xad, 0xe2, 0x93, 0x6b, 0x52, 0x93,
+  0x78, 0x64, 0x80, 0xe9, 0x37, 0x94, 0x71, 0xf0, 0xbf, 0x4c, 0x63, 0x29, 0x56, 0x0c, 0x1d, 0x6b,
+  0xaf, 0xe2, 0x12, 0x0e, 0x0e, 0xd8, 0x31, 0x62, 0xf0, 0x75, 0x52, 0xc1, 0x01, 0x17, 0xba, 0xe9,
+  0x00, 0xff, 0xc9, 0x85, 0x39, 0xd8, 0xee, 0x9a, 0xa1, 0xdb, 0xa5, 0x22, 0x24, 0xed, 0x9a, 0x64,
+  0x6c, 0x02, 0x73, 0x68, 0x6e, 0xa1, 0xa4, 0xda, 0x49, 0x5c, 0xc4, 0x97, 0xc3, 0x98, 0x87, 0x86,
+  0xfa, 0x00, 0x61, 0x14, 0xf8, 0xdf, 0x54, 0x7a, 0xb8, 0x4e, 0xa7, 0x93, 0x1c, 0x0e, 0x2d, 0xfd,
+  0x77, 0x5d, 0x7c, 0xb6, 0x0b, 0xf9, 0x40, 0x9b, 0xf2, 0x81, 0x03, 0x88, 0xf5, 0x99, 0x64, 0x00,
+  0xd6, 0x8d, 0xd5, 0xcc, 0xf1, 0x2e, 0xa0, 0xf2, 0xb5, 0xb4, 0x3f, 0x46, 0x20, 0xec, 0x69, 0x4d,
+  0xae, 0xea, 0x70, 0xde, 0x7a, 0x7c, 0xb4, 0xe7, 0xe0, 0x73, 0x80, 0x19, 0xdb, 0x10, 0xe6, 0xa9,
+  0x4e, 0xbe, 0x38, 0x01, 0x26, 0x1a, 0x4b, 0x98, 0xb6, 0x7c, 0x5a, 0x4b, 0xc7, 0x90, 0x54, 0x67,
+  0x20, 0x81, 0xa1, 0x49, 0x17, 0x24, 0xe1, 0x40, 0xd9, 0x16, 0xa4, 0x2a, 0xf8, 0x05, 0xc4, 0xb5,
+  0xbb, 0xfa, 0xfb, 0x05, 0x82, 0xb3, 0x19, 0x0b, 0x50, 0x81, 0x6e, 0x1d, 0x47, 0x9f, 0xc7, 0x04,
+  0xa0, 0xf2, 0xc5, 0x7f, 0x75, 0x76, 0xeb, 0x51, 0x16, 0xe0, 0xe2, 0x47, 0xbe, 0x3e, 0x8d, 0x01,
+  0x47, 0x72, 0x08, 0x0e, 0x51, 0x3f, 0x39, 0x22, 0x21, 0x9e, 0xf8, 0xa1, 0x05, 0x90, 0x1a, 0x2e,
+  0x28, 0x0c, 0x42, 0xaa, 0x40, 0x83, 0x0f, 0x3b, 0x39, 0x56, 0x59, 0x74, 0xf0, 0x44, 0x15, 0x10,
+  0x32, 0xe0, 0xb3, 0xa4, 0x25, 0x58, 0xc9, 0x89, 0x8a, 0xe2, 0x26, 0x25, 0x2a, 0x93, 0x76, 0x27,
+  0x06, 0xe6, 0xce, 0x5f, 0x7e, 0xfa, 0xfb, 0xcf, 0xae, 0x49, 0xbc, 0xfd, 0xfc, 0xf1, 0x84, 0x5a,
+  0x96, 0x50, 0xab, 0x96, 0x53, 0x5f, 0x6e, 0x57, 0xcc, 0x5c, 0x7f, 0x5d, 0x62, 0x9a, 0x6c, 0x13,
+  0x2f, 0x44, 0xb5, 0x93, 0x1a, 0xe8, 0x83, 0x0f, 0x50, 0xd4, 0xcf, 0x7a, 0xc2, 0xd9, 0x06, 0xfe,
+  0xa5, 0x47, 0xfa, 0xeb, 0x0b, 0xf8, 0xb5, 0xd5, 0xa9, 0x99, 0x3e, 0xa0, 0x40, 0x68, 0xae, 0x1e,
+  0x0d, 0x37, 0xcc, 0x6c, 0x28, 0x71, 0x61, 0x9c, 0x06, 0xe5, 0x3d, 0xd8, 0xa1, 0xb6, 0x82, 0xdb,
+  0x9d, 0x5d, 0x26, 0xf1, 0x1e, 0x7f, 0xd5, 0xd2, 0x47, 0x04, 0xf2, 0x16, 0x5d, 0x66, 0xcf, 0x0b,
+  0xf1, 0x03, 0x26, 0x22, 0x16, 0xa8, 0xc3, 0x37, 0x93, 0xda, 0xbc, 0x06, 0x8b, 0xf8, 0xcc, 0x7b,
+  0xc6, 0xdb, 0x46, 0x2c, 0x13, 0x71, 0x01, 0x90, 0x43, 0x55, 0x22, 0x7e, 0x83, 0x49, 0xf1, 0xc4,
+  0x5a, 0x2e, 0x37, 0xa5, 0x9e, 0x3b, 0x0a, 0x9f, 0xa6, 0x19, 0xa2, 0x67, 0xf2, 0x8c, 0xe7, 0x99,
+  0x38, 0x1b, 0x7d, 0x1e, 0x69, 0x82, 0x39, 0x1b, 0xf5, 0x20, 0x37, 0x3b, 0x5e, 0x94, 0x13, 0xf4,
+  0x9f, 0xf4, 0x46, 0xbb, 0xd3, 0xed, 0x62, 0xef, 0x8c, 0xff, 0xf9, 0xf9, 0x7b, 0xcc, 0xbe, 0x9b,
+  0xda, 0x9f, 0x7b, 0xc6, 0xba, 0x82, 0x05, 0xa7, 0xe2, 0x06, 0x69, 0x83, 0xb0, 0xb7, 0x81, 0x0c,
+  0xab, 0x0d, 0x32, 0x8e, 0x11, 0x20, 0x37, 0xb6, 0xc9, 0x9d, 0xc7, 0x8c, 0x7c, 0x2e, 0x3a, 0x99,
+  0xc5, 0xa9, 0xc4, 0xd9, 0x3c, 0x6f, 0xf2, 0xd2, 0x8f, 0xff, 0x8e, 0x4b, 0x77, 0xb8, 0x6e, 0x4b,
+  0xb0, 0x8a, 0xb1, 0x65, 0xaa, 0x63, 0x8b, 0x1e, 0xf3, 0x39, 0xa5, 0xc2, 0xbf, 0x6b, 0xa2, 0x77,
+  0xa9, 0xe9, 0xab, 0x48, 0x63, 0x16, 0x26, 0x37, 0x3d, 0x7c, 0x0c, 0x8a, 0x53, 0xf9, 0xe9, 0xad,
+  0x89, 0x03, 0xf0, 0x8f, 0xe8, 0xfe, 0xe3, 0xf8, 0x64, 0x78, 0x74, 0x7e, 0x76, 0xd6, 0x3f, 0x1a,
+  0xf5, 0x8f, 0x21, 0x69, 0x60, 0x65, 0x87, 0x73, 0x6f, 0xc7, 0x2d, 0xdb, 0x42, 0xb2, 0x00, 0xd3,
+  0x47, 0x83, 0xf3, 0xd3, 0x61, 0x69, 0x63, 0xdd, 0x7c, 0xe2, 0x97, 0x69, 0x61, 0xa5, 0xa9, 0xa5,
+  0x19, 0x52, 0xe3, 0xd7, 0x5a, 0x18, 0xb0, 0xb2, 0xf3, 0x11, 0xf2, 0x6a, 0x41, 0xb5, 0xd2, 0x82,
+  0x73, 0x97, 0x02, 0x21, 0xf4, 0x34, 0xa7, 0x9c, 0x8c, 0xf4, 0xa5, 0x9f, 0x47, 0x95, 0xcf, 0xf7,
+  0x0d, 0x71, 0x67, 0xd2, 0x2c, 0xdd, 0x06, 0xee, 0x44, 0x93, 0x8d, 0xac, 0x4a, 0xda, 0x76, 0x92,
+  0xdc, 0x99, 0x49, 0xb1, 0x47, 0x99, 0x2a, 0x90, 0xa0, 0xdf, 0x18, 0x19, 0xad, 0x67, 0x00, 0x1c,
+  0xd1, 0xfb, 0x60, 0x1a, 0x87, 0xe0, 0x72, 0x7b, 0xdb, 0x44, 0xbf, 0xcd, 0x82, 0x2c, 0xef, 0x52,
+  0xba, 0x2b, 0x12, 0x75, 0xfa, 0x38, 0x4b, 0x0b, 0x2b, 0x92, 0x8e, 0xcb, 0x8f, 0xa1, 0xe2, 0xbe,
+  0xce, 0x6c, 0x04, 0xf9, 0x15, 0x06, 0x79, 0xb3, 0x01, 0x1e, 0x4f, 0xab, 0xe3, 0x23, 0xdc, 0x4c,
+  0xb3, 0x3d, 0x4b, 0x6e, 0x7c, 0x83, 0xa7, 0x09, 0x8e, 0x99, 0x0d, 0xa4, 0x7d, 0x89, 0x87, 0x32,
+  0xa5, 0x28, 0xf7, 0x15, 0x35, 0x6c, 0x62, 0x16, 0x9f, 0xb4, 0xfb, 0x72, 0x95, 0xbc, 0xc4, 0x11,
+  0x93, 0xa6, 0x1d, 0x46, 0x69, 0x0d, 0x98, 0x0c, 0xf3, 0x43, 0x10, 0x18, 0x76, 0x27, 0xdf, 0x4a,
+  0x86, 0xe9, 0x71, 0x02, 0x8c, 0xc2, 0xcf, 0xb2, 0x51, 0xbc, 0x32, 0xc7, 0x51, 0x79, 0x55, 0x32,
+  0xca, 0xb7, 0xb8, 0x30, 0x1c, 0x2e, 0x96, 0x49, 0x91, 0x97, 0x68, 0x6d, 0xda, 0x93, 0x4e, 0xaf,
+  0x30, 0x7f, 0x48, 0x1b, 0x02, 0x85, 0x41, 0x22, 0xab, 0x10, 0xa5, 0xda, 0x30, 0x71, 0x95, 0x0c,
+  0x12, 0xd9, 0xc4, 0x22, 0x2b, 0x53, 0xe1, 0xf4, 0xc5, 0x75, 0x92, 0x6f, 0xd3, 0xe5, 0x0d, 0xca,
+  0x73, 0x57, 0xe0, 0x7b, 0x3d, 0xea, 0x1a, 0x07, 0x36, 0xe4, 0xdf, 0x53, 0xfc, 0x6b, 0x9c, 0x54,
+  0xbd, 0x64, 0xa0, 0x58, 0x7e, 0x10, 0x4e, 0xac, 0x3f, 0x1a, 0x20, 0xfd, 0x06, 0x8f, 0xd4, 0xf8,
+  0xb2, 0x30, 0xd5, 0xc3, 0xe4, 0xfe, 0xd0, 0x9f, 0x9d, 0x62, 0x6e, 0x64, 0xde, 0x32, 0xa6, 0xea,
+  0x44, 0x4d, 0x29, 0x83, 0x6b, 0xa9, 0xe6, 0x65, 0xec, 0x12, 0x55, 0x05, 0x8f, 0x69, 0xf4, 0x32,
+  0x92, 0xad, 0x0a, 0xbd, 0x8c, 0x6c, 0x34, 0xf0, 0xf0, 0x1d, 0xf9, 0x81, 0x78, 0x11, 0x34, 0xb9,
+  0x17, 0x47, 0x17, 0xb1, 0x56, 0xd5, 0xa4, 0x1d, 0x98, 0x17, 0xf7, 0x79, 0xf9, 0xc9, 0x36, 0x35,
+  0x71, 0x72, 0x2d, 0x91, 0x4c, 0x33, 0x04, 0x6a, 0x7f, 0xc4, 0x5b, 0x17, 0xf8, 0x7b, 0xa1, 0xd6,
+  0xa7, 0x99, 0xb9, 0x29, 0x26, 0x61, 0x24, 0x3e, 0x24, 0x6b, 0xdf, 0x38, 0x85, 0xf8, 0x2e, 0xd2,
+  0xff, 0xa4, 0xb5, 0x3d, 0x4c, 0xc0, 0x4b, 0x21, 0x2c, 0xe7, 0x95, 0x9d, 0x74, 0x21, 0x72, 0x7c,
+  0x36, 0xc0, 0x26, 0xaf, 0x63, 0xb0, 0x3e, 0x50, 0xde, 0xaa, 0xe3, 0xa7, 0xe8, 0x59, 0x74, 0x48,
+  0x58, 0x36, 0x42, 0x46, 0xcc, 0xc1, 0x80, 0x4a, 0x32, 0x42, 0x90, 0x6f, 0xf5, 0xe0, 0x8c, 0x5a,
+  0xb2, 0x3b, 0xb7, 0xd7, 0x08, 0x96, 0xfc, 0x25, 0xe2, 0x23, 0xdc, 0x51, 0x82, 0xe6, 0xab, 0x0f,
+  0x51, 0xb8, 0xfa, 0xdf, 0x1e, 0x8b, 0xa7, 0xda, 0x68, 0x88, 0xfe, 0xbb, 0x8b, 0xd1, 0x47, 0xd1,
+  0x68, 0x54, 0x1f, 0xd1, 0x5b, 0x31, 0x1f, 0x88, 0x1a, 0x95, 0x9f, 0x3e, 0xd4, 0x83, 0x09, 0x4b,
+  0xcb, 0x9d, 0xb1, 0xeb, 0x8f, 0x75, 0x0f, 0xf6, 0x35, 0x7c, 0x5a, 0x9f, 0x70, 0xda, 0xe7, 0x3a,
+  0xc8, 0x8f, 0x7b, 0xa6, 0x55, 0xfc, 0x7d, 0x73, 0x12, 0x5e, 0x56, 0xb5, 0x5f, 0xe0, 0x65, 0xd2,
+  0xdc, 0x6d, 0x12, 0x28, 0xa8, 0x66, 0xf5, 0x86, 0x60, 0xdb, 0x6c, 0xd6, 0xb2, 0x39, 0x0f, 0x14,
+  0xe8, 0x97, 0x78, 0x3f, 0x38, 0xd5, 0x53, 0xce, 0x29, 0xe9, 0x82, 0xdf, 0x2d, 0xdc, 0x56, 0xcf,
+  0xc2, 0xbb, 0x48, 0xec, 0x06, 0xa2, 0xef, 0xa6, 0x2b, 0x3f, 0xb2, 0x8d, 0x26, 0x6e, 0xc9, 0x13,
+  0xe8, 0x15, 0x45, 0xda, 0xc0, 0x7e, 0xed, 0x78, 0x32, 0xb8, 0x26, 0x55, 0xb2, 0xe8, 0xe6, 0x0b,
+  0xbe, 0x9a, 0xf3, 0xda, 0xae, 0xd8, 0xe1, 0x86, 0xb4, 0x36, 0x76, 0x9c, 0x2a, 0xf8, 0xa6, 0x78,
+  0xb5, 0xd5, 0xa9, 0xeb, 0xc2, 0x66, 0xb5, 0xa3, 0x3b, 0x9f, 0xf0, 0x85, 0x81, 0x66, 0x2d, 0x3c,
+  0x67, 0x3c, 0x76, 0xb9, 0xb5, 0x00, 0xa9, 0xc9, 0xd5, 0x4e, 0x4b, 0xa8, 0xa5, 0x3f, 0x99, 0x63,
+  0xfb, 0x14, 0x53, 0xa8, 0x55, 0xfb, 0xa5, 0x79, 0x9f, 0x99, 0x51, 0x9a, 0x87, 0xf4, 0xb1, 0x79,
+  0xd8, 0xcd, 0xe8, 0x71, 0x52, 0x55, 0xf9, 0xdc, 0xfd, 0xc5, 0xc6, 0xeb, 0x0e, 0x66, 0x80, 0xb0,
+  0xa8, 0x89, 0x67, 0x38, 0x55, 0xde, 0x2c, 0x9a, 0xd3, 0xc0, 0x81, 0xd8, 0xc9, 0x16, 0x57, 0x99,
+  0xb6, 0xf2, 0x56, 0xc7, 0xf2, 0x8d, 0xb6, 0x72, 0x22, 0x1d, 0x7d, 0x59, 0x94, 0x6b, 0xee, 0x6e,
+  0x67, 0x26, 0x31, 0x1b, 0x0a, 0x93, 0xba, 0xb5, 0x92, 0xc4, 0x36, 0xdf, 0x46, 0x7e, 0x59, 0xb2,
+  0x29, 0xbb, 0x70, 0x61, 0xa5, 0xbd, 0x24, 0xa3, 0xfd, 0xf8, 0x86, 0x0b, 0x67, 0xc0, 0x10, 0xac,
+  0x42, 0x7d, 0xc3, 0x91, 0x6f, 0x2e, 0x25, 0x27, 0x44, 0xaa, 0xac, 0x74, 0xf1, 0x0e, 0x64, 0x00,
+  0xaf, 0x62, 0xee, 0x2a, 0x0b, 0xd3, 0x5a, 0xba, 0x6b, 0x06, 0x0c, 0xe8, 0x78, 0x87, 0x51, 0x00,
+  0xe1, 0x1e, 0x5c, 0x5a, 0x08, 0x7a, 0xa2, 0xb0, 0x5f, 0xb0, 0x83, 0xb7, 0x78, 0xda, 0xec, 0xdd,
+  0xd4, 0x86, 0xff, 0xfc, 0xf4, 0xf3, 0xf7, 0x28, 0xbc, 0xf9, 0x0c, 0x29, 0x2d, 0xd2, 0x7a, 0x43,
+  0x17, 0x29, 0x70, 0xbe, 0xf8, 0x0e, 0x85, 0xb8, 0x86, 0xf7, 0x27, 0xf9, 0x06, 0xb8, 0x9b, 0x33,
+  0xe0, 0xac, 0x49, 0xa6, 0x6f, 0xad, 0xb9, 0xdb, 0x09, 0x1e, 0x84, 0xf2, 0x80, 0x60, 0x01, 0x99,
+  0xa1, 0x02, 0x31, 0x2b, 0xfa, 0x93, 0x76, 0x72, 0xf8, 0xd5, 0x5a, 0x3e, 0x6d, 0xa0, 0x38, 0xf7,
+  0x85, 0x83, 0x5e, 0x92, 0x9e, 0xe4, 0xdd, 0xde, 0xa3, 0xf2, 0x9f, 0x4f, 0x47, 0xa7, 0xfd, 0xde,
+  0xa0, 0x7f, 0xfc, 0xb9, 0x7a, 0x7b, 0xf2, 0x89, 0xaf, 0xb2, 0xcb, 0x72, 0xbe, 0x24, 0x2f, 0x40,
+  0x06, 0xd5, 0x05, 0xe1, 0xbc, 0x27, 0xd6, 0xe3, 0x73, 0xb3, 0x34, 0xd2, 0xc7, 0x54, 0x24, 0x5e,
+  0xe6, 0xd6, 0x75, 0x97, 0x99, 0x0c, 0x21, 0xdb, 0x47, 0xd4, 0xab, 0x8b, 0xbd, 0xdc, 0x0f, 0x99,
+  0xfc, 0x43, 0x9b, 0x9e, 0x74, 0xef, 0x72, 0x7d, 0x25, 0xf4, 0xfd, 0x08, 0x5d, 0xb9, 0xeb, 0x5d,
+  0x7e, 0x0b, 0xc7, 0xdc, 0xa2, 0xc7, 0x3f, 0x99, 0xeb, 0xfa, 0x87, 0x13, 0x46, 0x0d, 0x39, 0x15,
+  0x1f, 0x86, 0xee, 0x21, 0x20, 0xf9, 0xb1, 0x94, 0xdb, 0xd4, 0x32, 0x78, 0xc1, 0xe8, 0x71, 0x1e,
+  0xcf, 0xe1, 0x07, 0x10, 0xf2, 0xca, 0x32, 0x27, 0x63, 0x06, 0x58, 0x4f, 0xdf, 0x46, 0x64, 0x86,
+  0x20, 0xfd, 0x23, 0x89, 0x72, 0x7c, 0x8f, 0x31, 0xc7, 0xa7, 0x12, 0x79, 0x0e, 0xe7, 0x8a, 0x8c,
+  0xcc, 0x1b, 0x38, 0xe3, 0x8c, 0xb0, 0x85, 0x5c, 0xc4, 0xcf, 0x12, 0xc0, 0xb3, 0x0f, 0x41, 0x9d,
+  0x27, 0xf3, 0x0b, 0x82, 0x5a, 0xfa, 0xd2, 0x73, 0xf7, 0x6e, 0x26, 0xf0, 0x03, 0x76, 0x26, 0x87,
+  0xaf, 0xd5, 0xdc, 0x7b, 0x56, 0xf0, 0x93, 0x6a, 0x73, 0xc5, 0xc2, 0xbb, 0x67, 0x09, 0xbd, 0xfc,
+  0xcd, 0xac, 0xb8, 0xba, 0x6f, 0x05, 0xbe, 0x51, 0x35, 0x57, 0x84, 0x8b, 0x7b, 0x56, 0xf0, 0x5b,
+  0x4a, 0x5e, 0x92, 0x14, 0xaf, 0xc9, 0xfb, 0x03, 0xe0, 0xa0, 0x2e, 0x10, 0x5e, 0xa1, 0xd8, 0x99,
+  0x71, 0x1c, 0x23, 0x4a, 0xde, 0x07, 0x16, 0x1e, 0xd2, 0x98, 0xaf, 0x18, 0x8b, 0x8e, 0x66, 0x80,
+  0x13, 0xa0, 0x72, 0x04, 0x2d, 0x99, 0xca, 0x95, 0x1b, 0x95, 0xb9, 0x1a, 0x42, 0xf2, 0x25, 0xdd,
+  0x80, 0x3c, 0x6e, 0xe9, 0xd6, 0xa5, 0x6e, 0x83, 0xda, 0xf8, 0xa6, 0xd7, 0xe0, 0x07, 0x60, 0x7b,
+  0x1b, 0xfb, 0x9b, 0xf1, 0xf3, 0x43, 0xf8, 0xe4, 0xbf, 0xbd, 0xdb, 0xdf, 0xe4, 0xff, 0x37, 0xaf,
+  0xff, 0x07, 0xf9, 0x65, 0x81, 0x2f, 0xdf, 0x4b, 0x00, 0x00,
+};
+
+#endif // WEB_GZ_H
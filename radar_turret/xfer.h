@@ -0,0 +1,155 @@
+/*
+ * ============================================================================
+ * RADAR TURRET BACKGROUND TRANSFERS
+ * ============================================================================
+ *
+ * Long responses (the log download) used to be written out in full from
+ * inside their handler, so one 50KB transfer held up every other client
+ * and, without THREADED_MODE, the sweep too. A transfer now takes over
+ * the request's socket (like /events does) and is sent one chunk per
+ * web loop pass by xferPump(), interleaved with handleClient():
+ *
+ *   handler:   xferStart(srv, type, fill, &state, sizeof(state), headers)
+ *   web side:  xferPump()          after handleClient()
+ *
+ * fill(state, buf, cap, len) produces the next piece of the body (len
+ * may be 0 while it works through data it skips) and returns false once
+ * the body is complete. The body goes out with chunked encoding.
+ *
+ * Up to XFER_MAX transfers run side by side; a client that stops
+ * reading for XFER_TIMEOUT_MS is dropped.
+ *
+ * ============================================================================
+ */
+
+#ifndef XFER_H
+#define XFER_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WebServer.h>
+
+#define XFER_MAX          3
+#define XFER_CHUNK        512     // Body bytes per pass and transfer
+#define XFER_STATE_MAX    64      // Room for the fill function's cursor
+#define XFER_TIMEOUT_MS   10000
+#define XFER_HDR          6       // "1ff\r\n" fits, chunk starts here
+
+typedef bool (*XferFill)(void *state, uint8_t *buf, size_t cap, size_t &len);
+
+struct Xfer {
+  bool used;
+  bool more;                  // fill() has more to give
+  WiFiClient client;
+  XferFill fill;
+  uint32_t state[XFER_STATE_MAX / 4];
+  uint8_t buf[XFER_HDR + XFER_CHUNK + 2 + 5];   // hdr, data, CRLF, last chunk
+  uint16_t pos, end;          // Not yet written: buf[pos, end)
+  unsigned long tProgress;
+};
+
+Xfer xfers[XFER_MAX];
+
+/*
+ * xferStart(srv, type, fill, state, len, headers)
+ * -----------------------------------------------
+ * Sends the response header and hands the socket to a transfer slot.
+ * state (len bytes) is copied and passed to every fill() call. headers
+ * are extra "Name: value\r\n" lines. Replies 503 when every slot is
+ * busy. Web side only.
+ */
+bool xferStart(WebServer &srv, const char *type, XferFill fill,
+               const void *state, size_t len, const char *headers = nullptr) {
+  int slot = -1;
+  for (int i = 0; i < XFER_MAX; i++) {
+    if (!xfers[i].used) { slot = i; break; }
+  }
+  if (slot < 0 || len > sizeof(xfers[0].state)) {
+    srv.send_P(503, "text/plain", "BUSY");
+    return false;
+  }
+
+  Xfer &x = xfers[slot];
+  x.client = srv.client();
+  x.client.print("HTTP/1.1 200 OK\r\n"
+                 "Content-Type: ");
+  x.client.print(type);
+  x.client.print("\r\n");
+  if (headers) x.client.print(headers);
+  x.client.print("Transfer-Encoding: chunked\r\n"
+                 "Cache-Control: no-cache\r\n"
+                 "Connection: close\r\n\r\n");
+
+  // Our copy keeps the socket open; the server moves on (telemetry.h)
+  srv.client().stop();
+
+  x.fill = fill;
+  memcpy(x.state, state, len);
+  x.pos = x.end = 0;
+  x.more = true;
+  x.used = true;
+  x.tProgress = millis();
+  return true;
+}
+
+// Frames the next piece of the body as a chunk, plus the last chunk
+// once fill() is done
+static void xferRefill(Xfer &x) {
+  size_t len = 0;
+  x.more = x.fill(x.state, x.buf + XFER_HDR, XFER_CHUNK, len);
+
+  x.pos = x.end = XFER_HDR;
+  if (len > 0) {
+    char hdr[XFER_HDR + 1];
+    int n = snprintf(hdr, sizeof(hdr), "%x\r\n", (unsigned)len);
+    x.pos = XFER_HDR - n;
+    memcpy(x.buf + x.pos, hdr, n);
+    x.end = XFER_HDR + len;
+    x.buf[x.end++] = '\r';
+    x.buf[x.end++] = '\n';
+  }
+  if (!x.more) {
+    memcpy(x.buf + x.end, "0\r\n\r\n", 5);
+    x.end += 5;
+  }
+}
+
+/*
+ * xferPump()
+ * ----------
+ * Moves every transfer on by at most one chunk. Web side only.
+ */
+void xferPump() {
+  unsigned long now = millis();
+
+  for (int i = 0; i < XFER_MAX; i++) {
+    Xfer &x = xfers[i];
+    if (!x.used) continue;
+
+    if (x.pos == x.end) {
+      if (!x.more) {
+        x.client.stop();
+        x.used = false;
+        continue;
+      }
+      xferRefill(x);
+    }
+
+    if (x.pos < x.end) {
+      size_t n = x.client.write(x.buf + x.pos, x.end - x.pos);
+      if (n > 0) {
+        x.pos += n;
+        x.tProgress = now;
+      }
+    } else {
+      x.tProgress = now;    // fill() skipped data, still progress
+    }
+
+    if (!x.client.connected() || now - x.tProgress > XFER_TIMEOUT_MS) {
+      x.client.stop();
+      x.used = false;
+    }
+  }
+}
+
+#endif // XFER_H
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+"""
+Pre-compresses the dashboards for the firmware.
+
+Extracts the raw-literal HTML pages from the sketch sources, gzips them
+and writes radar_turret/web_gz.h with a PROGMEM byte array, its length
+and a strong ETag per page. Run it after every change to the HTML:
+
+    python3 tools/gzip_web.py
+"""
+
+import gzip
+import hashlib
+import os
+import re
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "radar_turret")
+
+# (source file, C symbol of the raw page, output prefix)
+PAGES = [
+    ("radar_turret.ino", "index_html", "V2_INDEX"),
+    ("web.h",            "INDEX_HTML", "V3_INDEX"),
+]
+
+
+def extract(path, symbol):
+    src = open(path, encoding="utf-8").read()
+    m = re.search(r"const char " + symbol + r"\[\] PROGMEM = R\"rawliteral\((.*?)\)rawliteral\"", src, re.S)
+    if not m:
+        raise SystemExit("page %s not found in %s" % (symbol, path))
+    return m.group(1).encode("utf-8")
+
+
+def c_array(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    out = [
+        "/*",
+        " * ============================================================================",
+        " * RADAR TURRET COMPRESSED DASHBOARDS",
+        " * ============================================================================",
+        " *",
+        " * GENERATED by tools/gzip_web.py - do not edit, re-run the script instead.",
+        " *",
+        " * ============================================================================",
+        " */",
+        "",
+        "#ifndef WEB_GZ_H",
+        "#define WEB_GZ_H",
+        "",
+    ]
+    for fname, symbol, prefix in PAGES:
+        raw = extract(os.path.join(ROOT, fname), symbol)
+        gz = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = hashlib.sha1(raw).hexdigest()[:16]
+        out += [
+            "// %s (%s): %d bytes -> %d bytes gzipped" % (symbol, fname, len(raw), len(gz)),
+            "#define %s_ETAG \"\\\"%s\\\"\"" % (prefix, etag),
+            "const size_t %s_GZ_LEN = %d;" % (prefix, len(gz)),
+            "const uint8_t %s_GZ[] PROGMEM = {" % prefix,
+            c_array(gz),
+            "};",
+            "",
+        ]
+    out += ["#endif // WEB_GZ_H", ""]
+    open(os.path.join(ROOT, "web_gz.h"), "w").write("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,39 @@
+/*
+ * Host stand-in for Adafruit_NeoPixel: keeps the pixels and charges the
+ * simulated clock for every show().
+ */
+
+#ifndef ADAFRUIT_NEOPIXEL_H
+#define ADAFRUIT_NEOPIXEL_H
+
+#include <Arduino.h>
+
+#define NEO_GRB     0x52
+#define NEO_KHZ800  0x0000
+
+class Adafruit_NeoPixel {
+public:
+  Adafruit_NeoPixel(uint16_t n, int16_t, int = NEO_GRB + NEO_KHZ800) : count(min(n, (uint16_t)64)) {}
+  void begin() {}
+  void setBrightness(uint8_t b) { bright = b; }
+  uint8_t getBrightness() const { return bright; }
+  void setPixelColor(uint16_t i, uint32_t c) { if (i < count) pixels[i] = c; }
+  void setPixelColor(uint16_t i, uint8_t r, uint8_t g, uint8_t b) { setPixelColor(i, Color(r, g, b)); }
+  uint32_t getPixelColor(uint16_t i) const { return i < count ? pixels[i] : 0; }
+  void clear() { memset(pixels, 0, sizeof(pixels)); }
+  uint16_t numPixels() const { return count; }
+  bool canShow() const { return true; }
+  static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) { return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b; }
+
+  void show() {
+    simShows++;
+    simAdvance(SIM_SHOW_LATCH_US + count * SIM_SHOW_US_PER_PIXEL);
+  }
+
+private:
+  uint16_t count;
+  uint8_t bright = 255;
+  uint32_t pixels[64] = {};
+};
+
+#endif // ADAFRUIT_NEOPIXEL_H
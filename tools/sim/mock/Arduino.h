@@ -0,0 +1,182 @@
+/*
+ * Host stand-in for the Arduino-ESP32 core: just enough of it for the
+ * radar headers, backed by the simulated clock and pins (sim_hw.h).
+ */
+
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <math.h>
+#include <time.h>
+#include <sys/time.h>
+#include <string>
+#include <algorithm>
+#include "sim_hw.h"
+
+#define PROGMEM
+#define IRAM_ATTR
+#define PSTR(s) (s)
+#define F(s) (s)
+#define FPSTR(s) (s)
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+
+#define HIGH          1
+#define LOW           0
+#define INPUT         0x01
+#define OUTPUT        0x03
+#define INPUT_PULLUP  0x05
+#define RISING        0x01
+#define FALLING       0x02
+#define CHANGE        0x03
+
+#define PI            3.1415926535897932384626433832795
+#define DEG_TO_RAD    0.017453292519943295769236907684886
+#define RAD_TO_DEG    57.295779513082320876798154814105
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+using std::min;
+using std::max;
+
+template <class T, class L, class H>
+T constrain(T x, L lo, H hi) { return x < lo ? lo : (x > hi ? hi : x); }
+
+bool setCpuFrequencyMhz(uint32_t mhz);
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+inline int digitalPinToInterrupt(int pin) { return pin; }
+void attachInterrupt(int pin, void (*isr)(), int mode);
+void detachInterrupt(int pin);
+
+long random(long hi);
+long random(long lo, long hi);
+void randomSeed(unsigned long seed);
+
+uint32_t ledcSetup(uint8_t ch, uint32_t freq, uint8_t bits);
+void ledcAttachPin(uint8_t pin, uint8_t ch);
+uint32_t ledcWriteTone(uint8_t ch, uint32_t freq);
+void ledcWrite(uint8_t ch, uint32_t duty);
+
+// ============================================================================
+// STRING / PRINT
+// ============================================================================
+
+class String {
+public:
+  std::string s;
+  String() {}
+  String(const char *c) : s(c ? c : "") {}
+  String(const std::string &o) : s(o) {}
+  String(char c) : s(1, c) {}
+  String(int v) : s(std::to_string(v)) {}
+  String(unsigned v) : s(std::to_string(v)) {}
+  String(long v) : s(std::to_string(v)) {}
+  String(unsigned long v) : s(std::to_string(v)) {}
+  String(float v) : s(std::to_string(v)) {}
+  String(double v) : s(std::to_string(v)) {}
+
+  String &operator+=(const String &o) { s += o.s; return *this; }
+  String &operator+=(const char *o) { s += o; return *this; }
+  String &operator+=(char c) { s += c; return *this; }
+  friend String operator+(String a, const String &b) { a.s += b.s; return a; }
+  friend String operator+(const char *a, const String &b) { String r(a); r.s += b.s; return r; }
+  bool operator==(const char *o) const { return s == o; }
+  bool operator==(const String &o) const { return s == o.s; }
+  bool operator!=(const char *o) const { return s != o; }
+
+  const char *c_str() const { return s.c_str(); }
+  unsigned length() const { return s.size(); }
+  long toInt() const { return atol(s.c_str()); }
+  float toFloat() const { return atof(s.c_str()); }
+  bool startsWith(const char *p) const { return s.compare(0, strlen(p), p) == 0; }
+  int indexOf(const char *p) const {
+    size_t i = s.find(p);
+    return i == std::string::npos ? -1 : (int)i;
+  }
+};
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *b, size_t n) {
+    for (size_t i = 0; i < n; i++) write(b[i]);
+    return n;
+  }
+  size_t write(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+
+  size_t print(const char *s) { return write(s); }
+  size_t print(const String &s) { return write(s.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v) { return printf("%d", v); }
+  size_t print(unsigned v) { return printf("%u", v); }
+  size_t print(long v) { return printf("%ld", v); }
+  size_t print(unsigned long v) { return printf("%lu", v); }
+  size_t print(double v) { return printf("%.2f", v); }
+  template <class T> size_t println(T v) { return print(v) + println(); }
+  size_t println() { return write("\r\n"); }
+
+  size_t printf(const char *fmt, ...) __attribute__((format(printf, 2, 3))) {
+    char buf[256];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    if (n <= 0) return 0;
+    return write((const uint8_t *)buf, min((size_t)n, sizeof(buf) - 1));
+  }
+};
+
+class Stream : public Print {
+public:
+  virtual int available() { return 0; }
+  virtual int read() { return -1; }
+};
+
+class HardwareSerial : public Stream {
+public:
+  void begin(unsigned long) {}
+  size_t write(uint8_t c) {
+    if (simSerialEcho) putchar(c);
+    return 1;
+  }
+  using Print::write;
+};
+extern HardwareSerial Serial;
+
+class IPAddress {
+public:
+  String toString() const { return "192.168.4.1"; }
+  operator String() const { return toString(); }
+};
+
+// ============================================================================
+// ESP
+// ============================================================================
+
+struct EspClass {
+  uint32_t getCycleCount() { return (uint32_t)(simNowUs * 240); }
+  uint32_t getCpuFreqMHz();
+  uint32_t getFreeHeap() { return 200000; }
+  uint32_t getMinFreeHeap() { return 180000; }
+  void restart() {}
+};
+extern EspClass ESP;
+
+#endif // ARDUINO_H
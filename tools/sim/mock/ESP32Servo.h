@@ -0,0 +1,55 @@
+/*
+ * Host stand-in for ESP32Servo: the horn slews towards the last write at
+ * SIM_SERVO_US_PER_DEG instead of jumping there.
+ */
+
+#ifndef ESP32SERVO_H
+#define ESP32SERVO_H
+
+#include <Arduino.h>
+
+class ESP32PWM {
+public:
+  static void allocateTimer(int) {}
+};
+
+class Servo {
+public:
+  void setPeriodHertz(int) {}
+  int attach(int pin, int = 500, int = 2400) { attachedPin = pin; return 1; }
+  void detach() { attachedPin = -1; }
+  bool attached() const { return attachedPin >= 0; }
+
+  void write(int angle) {
+    from = simAngle();
+    angle = constrain(angle, 0, 180);
+    step = abs(angle - to);
+    to = angle;
+    startUs = simNowUs;
+    writes++;
+  }
+  int read() const { return to; }
+
+  // Where the horn physically is now
+  float simAngle() const {
+    float moved = (float)(simNowUs - startUs) / SIM_SERVO_US_PER_DEG;
+    float left = fabsf(to - from);
+    if (moved >= left) return to;
+    return from + (to > from ? moved : -moved);
+  }
+
+  // Degrees commanded by the last write, and when it came
+  int simStep() const { return step; }
+  uint64_t simWriteUs() const { return startUs; }
+
+  uint32_t writes = 0;
+
+private:
+  int attachedPin = -1;
+  float from = 90;
+  int to = 90;
+  int step = 0;
+  uint64_t startUs = 0;
+};
+
+#endif // ESP32SERVO_H
@@ -0,0 +1,120 @@
+/*
+ * Host stand-in for the Arduino FS layer: files are byte vectors in a
+ * map owned by the FS, so SPIFFS contents survive for the whole run.
+ */
+
+#ifndef FS_H
+#define FS_H
+
+#include <Arduino.h>
+#include <map>
+#include <memory>
+#include <vector>
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+#define FILE_APPEND "a"
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+typedef std::vector<uint8_t> SimFileData;
+
+class File : public Stream {
+public:
+  File() {}
+  File(std::shared_ptr<SimFileData> d, const std::string &n, bool w, size_t p)
+    : data(d), path(n), writable(w), pos(p) {}
+
+  explicit operator bool() const { return data != nullptr; }
+
+  size_t write(uint8_t c) { return write(&c, 1); }
+  size_t write(const uint8_t *b, size_t n) {
+    if (!data || !writable) return 0;
+    if (pos + n > data->size()) data->resize(pos + n);
+    memcpy(data->data() + pos, b, n);
+    pos += n;
+    return n;
+  }
+  using Print::write;
+
+  int available() { return data ? (int)(data->size() - pos) : 0; }
+  int read() {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+  }
+  size_t read(uint8_t *b, size_t n) {
+    if (!data || pos >= data->size()) return 0;
+    n = min(n, data->size() - pos);
+    memcpy(b, data->data() + pos, n);
+    pos += n;
+    return n;
+  }
+
+  bool seek(uint32_t off, SeekMode mode = SeekSet) {
+    if (!data) return false;
+    size_t base = mode == SeekSet ? 0 : mode == SeekCur ? pos : data->size();
+    if (base + off > data->size()) return false;
+    pos = base + off;
+    return true;
+  }
+  size_t position() const { return pos; }
+  size_t size() const { return data ? data->size() : 0; }
+  const char *name() const { return path.c_str(); }
+  void flush() {}
+  void close() { data.reset(); }
+
+private:
+  std::shared_ptr<SimFileData> data;
+  std::string path;
+  bool writable = false;
+  size_t pos = 0;
+};
+
+namespace fs {
+
+class FS {
+public:
+  File open(const char *path, const char *mode = FILE_READ, bool = false) {
+    std::shared_ptr<SimFileData> &d = files[path];
+    if (mode[0] == 'r') {
+      if (!d) {
+        files.erase(path);
+        return File();
+      }
+      return File(d, path, mode[1] == '+', 0);
+    }
+    if (!d || mode[0] == 'w') d = std::make_shared<SimFileData>();
+    return File(d, path, true, mode[0] == 'a' ? d->size() : 0);
+  }
+  File open(const String &path, const char *mode = FILE_READ) { return open(path.c_str(), mode); }
+
+  bool exists(const char *path) { return files.count(path) != 0; }
+  bool exists(const String &path) { return exists(path.c_str()); }
+  bool remove(const char *path) { return files.erase(path) != 0; }
+  bool remove(const String &path) { return remove(path.c_str()); }
+  bool rename(const char *from, const char *to) {
+    if (!exists(from)) return false;
+    files[to] = files[from];
+    files.erase(from);
+    return true;
+  }
+
+  size_t totalBytes() { return 1408 * 1024; }
+  size_t usedBytes() {
+    size_t n = 0;
+    for (auto &f : files) n += f.second->size();
+    return n;
+  }
+  bool format() {
+    files.clear();
+    return true;
+  }
+
+  std::map<std::string, std::shared_ptr<SimFileData>> files;
+};
+
+} // namespace fs
+
+using fs::FS;
+
+#endif // FS_H
@@ -0,0 +1,65 @@
+/*
+ * Host stand-in for Preferences: one in-memory key/value map per process,
+ * keyed by namespace and name, so values outlive the Preferences object.
+ */
+
+#ifndef PREFERENCES_H
+#define PREFERENCES_H
+
+#include <Arduino.h>
+#include <map>
+#include <vector>
+
+std::map<std::string, std::vector<uint8_t>> &simNvs();
+
+class Preferences {
+public:
+  bool begin(const char *name, bool = false) { ns = name; return true; }
+  void end() {}
+  bool clear() {
+    auto &m = simNvs();
+    for (auto i = m.begin(); i != m.end();) {
+      if (i->first.compare(0, ns.size() + 1, ns + "/") == 0) i = m.erase(i);
+      else ++i;
+    }
+    return true;
+  }
+  bool remove(const char *key) { return simNvs().erase(k(key)) != 0; }
+  bool isKey(const char *key) { return simNvs().count(k(key)) != 0; }
+
+  size_t putBytes(const char *key, const void *v, size_t n) {
+    const uint8_t *p = (const uint8_t *)v;
+    simNvs()[k(key)].assign(p, p + n);
+    return n;
+  }
+  size_t getBytes(const char *key, void *v, size_t n) {
+    auto i = simNvs().find(k(key));
+    if (i == simNvs().end()) return 0;
+    n = min(n, i->second.size());
+    memcpy(v, i->second.data(), n);
+    return n;
+  }
+  size_t getBytesLength(const char *key) {
+    auto i = simNvs().find(k(key));
+    return i == simNvs().end() ? 0 : i->second.size();
+  }
+
+  size_t putInt(const char *key, int32_t v)    { return putBytes(key, &v, sizeof(v)); }
+  size_t putUInt(const char *key, uint32_t v)  { return putBytes(key, &v, sizeof(v)); }
+  size_t putUChar(const char *key, uint8_t v)  { return putBytes(key, &v, sizeof(v)); }
+  size_t putBool(const char *key, bool v)      { return putUChar(key, v ? 1 : 0); }
+  int32_t getInt(const char *key, int32_t d = 0)    { return get(key, d); }
+  uint32_t getUInt(const char *key, uint32_t d = 0) { return get(key, d); }
+  uint8_t getUChar(const char *key, uint8_t d = 0)  { return get(key, d); }
+  bool getBool(const char *key, bool d = false)     { return getUChar(key, d ? 1 : 0) != 0; }
+
+private:
+  std::string ns;
+  std::string k(const char *key) const { return ns + "/" + key; }
+  template <class T> T get(const char *key, T d) {
+    T v;
+    return getBytesLength(key) == sizeof(T) && getBytes(key, &v, sizeof(v)) == sizeof(v) ? v : d;
+  }
+};
+
+#endif // PREFERENCES_H
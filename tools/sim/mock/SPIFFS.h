@@ -0,0 +1,18 @@
+/*
+ * Host stand-in for SPIFFS (see FS.h).
+ */
+
+#ifndef SPIFFS_H
+#define SPIFFS_H
+
+#include <FS.h>
+
+class SPIFFSFS : public fs::FS {
+public:
+  bool begin(bool = false, const char * = "/spiffs", uint8_t = 10, const char * = nullptr) { return true; }
+  void end() {}
+};
+
+extern SPIFFSFS SPIFFS;
+
+#endif // SPIFFS_H
@@ -0,0 +1,58 @@
+/*
+ * Host stand-in for the synchronous WebServer: routes are registered and
+ * never called, so the web side's pumps run with nothing to do.
+ */
+
+#ifndef WEBSERVER_H
+#define WEBSERVER_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <FS.h>
+#include <functional>
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST };
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+
+class WebServer {
+public:
+  typedef std::function<void(void)> THandlerFunction;
+
+  WebServer(int) {}
+  void begin() {}
+  void handleClient() {}
+  void on(const char *, THandlerFunction) { routes++; }
+  void on(const char *, HTTPMethod, THandlerFunction) { routes++; }
+  void onNotFound(THandlerFunction) {}
+
+  void send(int, const char * = "", const char * = "") {}
+  void send(int, const char *, const String &) {}
+  void send_P(int, const char *, const char *) {}
+  void send_P(int, const char *, const char *, size_t) {}
+  void sendHeader(const String &, const String &, bool = false) {}
+  void setContentLength(size_t) {}
+  void sendContent(const String &) {}
+  void sendContent(const char *, size_t) {}
+  void sendContent_P(const char *) {}
+  void sendContent_P(const char *, size_t) {}
+  template <class T> size_t streamFile(T &, const String &, int = 200) { return 0; }
+
+  int args() { return 0; }
+  String arg(int) { return String(); }
+  String arg(const char *) { return String(); }
+  String argName(int) { return String(); }
+  bool hasArg(const char *) { return false; }
+  String header(const char *) { return String(); }
+  bool hasHeader(const char *) { return false; }
+  void collectHeaders(const char **, size_t) {}
+  String uri() { return String(); }
+  WiFiClient &client() { return cl; }
+
+  int routes = 0;
+
+private:
+  WiFiClient cl;
+};
+
+#endif // WEBSERVER_H
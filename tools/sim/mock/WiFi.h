@@ -0,0 +1,42 @@
+/*
+ * Host stand-in for WiFi: the AP always comes up and no client ever
+ * connects. simRadioOn (sim_hw.h) follows softAP() and WIFI_OFF.
+ */
+
+#ifndef WIFI_H
+#define WIFI_H
+
+#include <Arduino.h>
+
+#define WIFI_OFF    0
+#define WIFI_STA    1
+#define WIFI_AP     2
+#define WIFI_AP_STA 3
+
+class WiFiClient : public Stream {
+public:
+  size_t write(uint8_t) { return 1; }
+  size_t write(const uint8_t *, size_t n) { return n; }
+  using Print::write;
+  bool connected() { return false; }
+  void stop() {}
+  void setNoDelay(bool) {}
+  int fd() const { return -1; }
+  explicit operator bool() const { return false; }
+};
+
+extern bool simRadioOn;
+
+struct WiFiClass {
+  bool mode(int m) { if (m == WIFI_OFF) simRadioOn = false; return true; }
+  bool softAP(const char *, const char * = nullptr, int = 1, int = 0, int = 4) { simRadioOn = true; return true; }
+  bool softAPdisconnect(bool = false) { return true; }
+  uint8_t softAPgetStationNum() { return 0; }
+  IPAddress softAPIP() { return IPAddress(); }
+  IPAddress localIP() { return IPAddress(); }
+  void setSleep(bool) {}
+};
+
+extern WiFiClass WiFi;
+
+#endif // WIFI_H
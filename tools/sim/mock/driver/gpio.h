@@ -0,0 +1,15 @@
+/*
+ * Host stand-in for the GPIO driver: only the light-sleep wakeup part.
+ */
+
+#ifndef DRIVER_GPIO_H
+#define DRIVER_GPIO_H
+
+#include "../esp_err.h"
+
+typedef int gpio_num_t;
+typedef enum { GPIO_INTR_LOW_LEVEL = 4, GPIO_INTR_HIGH_LEVEL = 5 } gpio_int_type_t;
+
+esp_err_t gpio_wakeup_enable(gpio_num_t pin, gpio_int_type_t type);
+
+#endif // DRIVER_GPIO_H
@@ -0,0 +1,13 @@
+/*
+ * Host stand-in for esp_err.h.
+ */
+
+#ifndef ESP_ERR_H
+#define ESP_ERR_H
+
+typedef int esp_err_t;
+
+#define ESP_OK    0
+#define ESP_FAIL  -1
+
+#endif // ESP_ERR_H
@@ -0,0 +1,35 @@
+/*
+ * Host stand-in for ESP-NOW: sends go to simEspNowSent (sim_hw.h) and
+ * simEspNowDeliver() plays a frame from another turret into the
+ * registered receive callback.
+ */
+
+#ifndef ESP_NOW_H
+#define ESP_NOW_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+#define ESP_NOW_ETH_ALEN  6
+#define ESP_NOW_KEY_LEN   16
+
+typedef enum { WIFI_IF_STA, WIFI_IF_AP } wifi_interface_t;
+
+typedef struct {
+  uint8_t peer_addr[ESP_NOW_ETH_ALEN];
+  uint8_t lmk[ESP_NOW_KEY_LEN];
+  uint8_t channel;
+  wifi_interface_t ifidx;
+  bool encrypt;
+  void *priv;
+} esp_now_peer_info_t;
+
+typedef void (*esp_now_recv_cb_t)(const uint8_t *mac, const uint8_t *data, int len);
+
+esp_err_t esp_now_init();
+esp_err_t esp_now_register_recv_cb(esp_now_recv_cb_t cb);
+esp_err_t esp_now_add_peer(const esp_now_peer_info_t *peer);
+esp_err_t esp_now_send(const uint8_t *mac, const uint8_t *data, size_t len);
+
+#endif // ESP_NOW_H
@@ -0,0 +1,17 @@
+/*
+ * Host stand-in for light sleep: the clock jumps to the timer wakeup,
+ * firing whatever falls due on the way (nothing should), and a held
+ * button (simButtonLow, sim_hw.h) wakes it at once.
+ */
+
+#ifndef ESP_SLEEP_H
+#define ESP_SLEEP_H
+
+#include <stdint.h>
+#include "esp_err.h"
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t us);
+esp_err_t esp_sleep_enable_gpio_wakeup();
+esp_err_t esp_light_sleep_start();
+
+#endif // ESP_SLEEP_H
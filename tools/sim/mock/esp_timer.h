@@ -0,0 +1,28 @@
+/*
+ * Host stand-in for esp_timer: one-shot timers are events on the
+ * simulated clock (sim_hw.h).
+ */
+
+#ifndef ESP_TIMER_H
+#define ESP_TIMER_H
+
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef struct esp_timer *esp_timer_handle_t;
+typedef enum { ESP_TIMER_TASK } esp_timer_dispatch_t;
+
+typedef struct {
+  void (*callback)(void *arg);
+  void *arg;
+  esp_timer_dispatch_t dispatch_method;
+  const char *name;
+  bool skip_unhandled_events;
+} esp_timer_create_args_t;
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *out);
+esp_err_t esp_timer_start_once(esp_timer_handle_t t, uint64_t us);
+esp_err_t esp_timer_stop(esp_timer_handle_t t);
+int64_t esp_timer_get_time();
+
+#endif // ESP_TIMER_H
@@ -0,0 +1,30 @@
+/*
+ * Host stand-in for FreeRTOS: the simulator is single threaded, so
+ * critical sections and locks do nothing and tasks are never started.
+ */
+
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+#include <stdint.h>
+
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE              1
+#define pdFALSE             0
+#define pdPASS              1
+#define portMAX_DELAY       0xffffffffu
+#define portTICK_PERIOD_MS  1
+#define pdMS_TO_TICKS(ms)   ((TickType_t)(ms))
+
+typedef struct { int unused; } portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED {0}
+#define portENTER_CRITICAL(m)
+#define portEXIT_CRITICAL(m)
+#define portENTER_CRITICAL_ISR(m)
+#define portEXIT_CRITICAL_ISR(m)
+#define portYIELD_FROM_ISR()
+
+#endif // FREERTOS_H
@@ -0,0 +1,11 @@
+/*
+ * Host stand-in for lwIP sockets: the host's own BSD sockets.
+ */
+
+#ifndef LWIP_SOCKETS_H
+#define LWIP_SOCKETS_H
+
+#include <sys/socket.h>
+#include <errno.h>
+
+#endif // LWIP_SOCKETS_H
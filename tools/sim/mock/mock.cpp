@@ -0,0 +1,324 @@
+/*
+ * ============================================================================
+ * RADAR TURRET SIMULATED HARDWARE
+ * ============================================================================
+ *
+ * The clock, event queue and pins behind the mock headers. See sim_hw.h.
+ *
+ * ============================================================================
+ */
+
+#include <Arduino.h>
+#include <SPIFFS.h>
+#include <Preferences.h>
+#include <WiFi.h>
+#include <esp_timer.h>
+#include <esp_now.h>
+#include <esp_sleep.h>
+#include <driver/gpio.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <vector>
+
+HardwareSerial Serial;
+EspClass ESP;
+SPIFFSFS SPIFFS;
+WiFiClass WiFi;
+
+uint64_t simNowUs = 0;
+uint32_t simPings = 0;
+uint32_t simShows = 0;
+uint32_t simToneHz = 0;
+bool simSerialEcho = false;
+int (*simEcho)() = nullptr;
+void (*simEspNowSent)(const uint8_t *data, size_t len) = nullptr;
+static esp_now_recv_cb_t simEspNowRecv = nullptr;
+bool simRadioOn = false;
+bool simButtonLow = false;
+uint64_t simSleptUs = 0;
+uint32_t simCpuMhz = 240;
+static uint64_t simWakeUs = 0;
+static int simWakePin = -1;
+
+std::map<std::string, std::vector<uint8_t>> &simNvs() {
+  static std::map<std::string, std::vector<uint8_t>> nvs;
+  return nvs;
+}
+
+// ============================================================================
+// CLOCK
+// ============================================================================
+
+struct SimEvent {
+  uint64_t at;
+  uint32_t seq;       // Same-time events run in the order scheduled
+  int id;
+  SimEventFn fn;
+  void *arg;
+};
+
+static std::vector<SimEvent> simEvents;
+static uint32_t simSeq = 0;
+static int simNextId = 1;
+static bool simFiring = false;
+
+int simSchedule(uint64_t atUs, SimEventFn fn, void *arg) {
+  SimEvent e = { max(atUs, simNowUs), simSeq++, simNextId++, fn, arg };
+  simEvents.push_back(e);
+  return e.id;
+}
+
+void simCancel(int id) {
+  for (size_t i = 0; i < simEvents.size(); i++) {
+    if (simEvents[i].id == id) {
+      simEvents.erase(simEvents.begin() + i);
+      return;
+    }
+  }
+}
+
+// Runs events up to the target time in order, then lands on it. An event
+// that advances the clock itself does not fire others from inside.
+void simAdvance(uint64_t us) {
+  uint64_t target = simNowUs + us;
+  if (simFiring) {
+    simNowUs = target;
+    return;
+  }
+
+  for (;;) {
+    size_t best = simEvents.size();
+    for (size_t i = 0; i < simEvents.size(); i++) {
+      const SimEvent &e = simEvents[i];
+      if (e.at > target) continue;
+      if (best == simEvents.size() || e.at < simEvents[best].at ||
+          (e.at == simEvents[best].at && e.seq < simEvents[best].seq)) best = i;
+    }
+    if (best == simEvents.size()) break;
+
+    SimEvent e = simEvents[best];
+    simEvents.erase(simEvents.begin() + best);
+    simNowUs = max(simNowUs, e.at);
+    simFiring = true;
+    e.fn(e.arg);
+    simFiring = false;
+  }
+  simNowUs = max(simNowUs, target);
+}
+
+unsigned long millis() { return (unsigned long)(simNowUs / 1000); }
+unsigned long micros() { return (unsigned long)simNowUs; }
+void delay(unsigned long ms) { simAdvance(ms * 1000ULL); }
+void delayMicroseconds(unsigned int us) { simAdvance(us); }
+void yield() {}
+
+// ============================================================================
+// PINS / SONAR
+// ============================================================================
+
+#define SIM_PINS 64
+
+static uint8_t simLevel[SIM_PINS];
+static void (*simIsr[SIM_PINS])();
+static uint8_t simTrig = 0xff;
+static uint8_t simEchoPin = 0xff;
+static int simEchoFall = 0;         // Pending falling edge, 0 = none
+
+void simSonar(uint8_t trig, uint8_t echo) {
+  simTrig = trig;
+  simEchoPin = echo;
+}
+
+static void simEchoEdge(void *arg) {
+  simLevel[simEchoPin] = arg ? HIGH : LOW;
+  if (!arg) simEchoFall = 0;
+  if (simIsr[simEchoPin]) simIsr[simEchoPin]();
+}
+
+// The module ignores triggers while its echo pin is high
+static void simPing() {
+  if (simEchoFall != 0 || simEcho == nullptr) return;
+  simPings++;
+  int cm = simEcho();
+  if (cm < 0) return;
+  uint64_t rise = simNowUs + SIM_ECHO_DELAY_US;
+  simSchedule(rise, simEchoEdge, (void *)1);
+  simEchoFall = simSchedule(rise + (uint64_t)(cm * SIM_US_PER_CM), simEchoEdge, nullptr);
+}
+
+void pinMode(uint8_t, uint8_t) {}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+  if (pin >= SIM_PINS) return;
+  bool fell = simLevel[pin] == HIGH && val == LOW;
+  simLevel[pin] = val;
+  if (fell && pin == simTrig) simPing();
+}
+
+int digitalRead(uint8_t pin) {
+  if (pin == simWakePin) return simButtonLow ? LOW : HIGH;   // Pulled up
+  return pin < SIM_PINS ? simLevel[pin] : LOW;
+}
+
+void attachInterrupt(int pin, void (*isr)(), int) {
+  if (pin >= 0 && pin < SIM_PINS) simIsr[pin] = isr;
+}
+
+void detachInterrupt(int pin) {
+  if (pin >= 0 && pin < SIM_PINS) simIsr[pin] = nullptr;
+}
+
+// ============================================================================
+// MISC PERIPHERALS
+// ============================================================================
+
+static uint32_t simRand = 1;
+
+void randomSeed(unsigned long seed) { simRand = seed ? seed : 1; }
+
+long random(long hi) {
+  simRand = simRand * 1103515245u + 12345u;
+  return hi > 0 ? (long)((simRand >> 8) % (uint32_t)hi) : 0;
+}
+
+long random(long lo, long hi) { return hi > lo ? lo + random(hi - lo) : lo; }
+
+uint32_t ledcSetup(uint8_t, uint32_t freq, uint8_t) { return freq; }
+void ledcAttachPin(uint8_t, uint8_t) {}
+void ledcWrite(uint8_t, uint32_t) {}
+uint32_t ledcWriteTone(uint8_t, uint32_t freq) {
+  simToneHz = freq;
+  return freq;
+}
+
+size_t simFsBytes(const char *prefix) {
+  size_t n = 0;
+  for (auto &f : SPIFFS.files) {
+    if (f.first.compare(0, strlen(prefix), prefix) == 0) n += f.second->size();
+  }
+  return n;
+}
+
+void simReset() {
+  simEvents.clear();
+  simNowUs = 0;
+  simEchoFall = 0;
+  memset(simLevel, 0, sizeof(simLevel));
+  SPIFFS.files.clear();
+  simNvs().clear();
+  simPings = simShows = simToneHz = 0;
+  simEspNowRecv = nullptr;
+  simRadioOn = simButtonLow = false;
+  simSleptUs = 0;
+  simCpuMhz = 240;
+  simWakePin = -1;
+}
+
+// ============================================================================
+// ESP_TIMER
+// ============================================================================
+
+struct esp_timer {
+  void (*callback)(void *);
+  void *arg;
+  int event;          // Pending event id, 0 = idle
+};
+
+static void simTimerFire(void *arg) {
+  esp_timer *t = (esp_timer *)arg;
+  t->event = 0;
+  t->callback(t->arg);
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *out) {
+  *out = new esp_timer{ args->callback, args->arg, 0 };
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t t, uint64_t us) {
+  if (t->event) simCancel(t->event);
+  t->event = simSchedule(simNowUs + us, simTimerFire, t);
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t t) {
+  if (t->event) simCancel(t->event);
+  t->event = 0;
+  return ESP_OK;
+}
+
+int64_t esp_timer_get_time() { return (int64_t)simNowUs; }
+
+// ============================================================================
+// ESP-NOW
+// ============================================================================
+
+esp_err_t esp_now_init() { return ESP_OK; }
+esp_err_t esp_now_add_peer(const esp_now_peer_info_t *) { return ESP_OK; }
+
+esp_err_t esp_now_register_recv_cb(esp_now_recv_cb_t cb) {
+  simEspNowRecv = cb;
+  return ESP_OK;
+}
+
+esp_err_t esp_now_send(const uint8_t *, const uint8_t *data, size_t len) {
+  if (simEspNowSent) simEspNowSent(data, len);
+  return ESP_OK;
+}
+
+void simEspNowDeliver(const uint8_t *mac, const uint8_t *data, int len) {
+  if (simEspNowRecv) simEspNowRecv(mac, data, len);
+}
+
+// ============================================================================
+// POWER
+// ============================================================================
+
+bool setCpuFrequencyMhz(uint32_t mhz) {
+  simCpuMhz = mhz;
+  return true;
+}
+
+uint32_t EspClass::getCpuFreqMHz() { return simCpuMhz; }
+
+esp_err_t gpio_wakeup_enable(gpio_num_t pin, gpio_int_type_t) {
+  simWakePin = pin;
+  return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_gpio_wakeup() { return ESP_OK; }
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t us) {
+  simWakeUs = us;
+  return ESP_OK;
+}
+
+esp_err_t esp_light_sleep_start() {
+  if (simWakePin >= 0 && simButtonLow) return ESP_OK;
+  uint64_t start = simNowUs;
+  simAdvance(simWakeUs);
+  simSleptUs += simNowUs - start;
+  return ESP_OK;
+}
+
+// ============================================================================
+// FREERTOS
+// ============================================================================
+
+static int simMutex;
+
+SemaphoreHandle_t xSemaphoreCreateMutex() { return &simMutex; }
+BaseType_t xSemaphoreTake(SemaphoreHandle_t, TickType_t) { return pdTRUE; }
+BaseType_t xSemaphoreGive(SemaphoreHandle_t) { return pdTRUE; }
+
+// Tasks never start on the host, so neither does the command queue
+QueueHandle_t xQueueCreate(UBaseType_t, UBaseType_t) { return nullptr; }
+BaseType_t xQueueSend(QueueHandle_t, const void *, TickType_t) { return pdFALSE; }
+BaseType_t xQueueReceive(QueueHandle_t, void *, TickType_t) { return pdFALSE; }
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t, const char *, uint32_t, void *,
+                                   UBaseType_t, TaskHandle_t *, BaseType_t) { return pdFALSE; }
+void vTaskDelete(TaskHandle_t) {}
+void vTaskDelay(TickType_t ticks) { delay(ticks); }
+TickType_t xTaskGetTickCount() { return millis(); }
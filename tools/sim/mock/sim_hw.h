@@ -0,0 +1,80 @@
+/*
+ * ============================================================================
+ * RADAR TURRET SIMULATED HARDWARE
+ * ============================================================================
+ *
+ * What the mocks in this directory share with the simulator (sim.cpp):
+ *
+ *   clock      one simulated microsecond counter behind millis(),
+ *              micros(), esp_timer and the cycle counter. delay() and
+ *              delayMicroseconds() move it forward and fire whatever
+ *              falls due on the way (echo edges, esp_timer callbacks),
+ *              in time order, with the clock set to the event's time.
+ *   sonar      simSonar(trig, echo) names the HC-SR04 pins. A falling
+ *              edge on trig asks simEcho() for the range the horn sees
+ *              and schedules the echo pin's rising and falling edges;
+ *              each edge calls the interrupt attached to the pin.
+ *   servos     Servo::write() slews at SIM_SERVO_US_PER_DEG, so the
+ *              horn angle at ping time is where the servo really is.
+ *   strip      Adafruit_NeoPixel::show() costs its wire time.
+ *   storage    SPIFFS and Preferences live in memory.
+ *   radio      esp_now_send() hands frames to simEspNowSent;
+ *              simEspNowDeliver() receives one as if another turret
+ *              sent it. simRadioOn follows the AP.
+ *   power      light sleep moves the clock to the timer wakeup and
+ *              adds to simSleptUs, unless simButtonLow (the wake pin)
+ *              is held; setCpuFrequencyMhz() sets simCpuMhz.
+ *
+ * Nothing here knows about the radar; sim.cpp supplies the scene.
+ *
+ * ============================================================================
+ */
+
+#ifndef SIM_HW_H
+#define SIM_HW_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define SIM_SERVO_US_PER_DEG  2000    // Matches motion.h's model
+#define SIM_ECHO_DELAY_US     450     // Trigger to echo rise (burst out)
+#define SIM_US_PER_CM         58.8f   // Echo pulse width per cm of range
+#define SIM_SHOW_US_PER_PIXEL 30      // WS2812 wire time
+#define SIM_SHOW_LATCH_US     50
+
+typedef void (*SimEventFn)(void *arg);
+
+// Clock
+extern uint64_t simNowUs;
+void simAdvance(uint64_t us);
+int simSchedule(uint64_t atUs, SimEventFn fn, void *arg);
+void simCancel(int id);
+void simReset();                    // Clock to 0, events, storage and pins cleared
+
+// Sonar: returns the range in cm the horn sees for a ping fired now,
+// or a negative value for no echo
+extern int (*simEcho)();
+void simSonar(uint8_t trig, uint8_t echo);
+
+// Counters for the report
+extern uint32_t simPings;
+extern uint32_t simShows;
+extern uint32_t simToneHz;          // Last frequency written to the buzzer
+
+// Serial output goes to stdout only when set
+extern bool simSerialEcho;
+
+// ESP-NOW
+extern void (*simEspNowSent)(const uint8_t *data, size_t len);
+void simEspNowDeliver(const uint8_t *mac, const uint8_t *data, int len);
+
+// Power
+extern bool simRadioOn;
+extern bool simButtonLow;
+extern uint64_t simSleptUs;
+extern uint32_t simCpuMhz;
+
+// Bytes stored under paths starting with prefix
+size_t simFsBytes(const char *prefix);
+
+#endif // SIM_HW_H
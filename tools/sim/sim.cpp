@@ -0,0 +1,821 @@
+/*
+ * ============================================================================
+ * RADAR TURRET HOST SIMULATOR
+ * ============================================================================
+ *
+ * Runs the radar core (radar.h) on the host against the simulated
+ * hardware in mock/, with a scene in place of the room, and scores it.
+ * Every change to the hot path (radarSense, radarAdvance, radarHold,
+ * the echo, background, tracker and log code under them) can be checked
+ * here before it is flashed:
+ *
+ *   loop rate      radar passes per second of host time (what the hot
+ *                  path costs) and per simulated second (how the
+ *                  scheduler paces it)
+ *   latency        target appearing to its first track, which is also
+ *                  the lock and the log record
+ *   false locks    locks started by a reading that matches no target,
+ *                  per simulated hour
+ *   log            every new track must reach the log (logEvent)
+ *   settle         no ping on a fine step (MOTION_PING_AHEAD_DEG or
+ *                  less) before its travel plus SERVO_SETTLE_US (motion.h)
+ *
+ * The core runs exactly as loop() drives it without THREADED_MODE. A
+ * pass costs SIM_PASS_US of simulated time on top of what the mocks
+ * charge (trigger pulse, LED wire time), and idle time is slept with
+ * delay(), which is when echo edges and esp_timer callbacks fire. Each
+ * scenario runs in its own process, so it starts from power-on state.
+ *
+ * USAGE:
+ *   make                       builds ./sim
+ *   make test                  regression suite, non-zero exit on a miss
+ *   ./sim [scenario...]        report for the named scenarios (all)
+ *   ./sim -c [scenario...]     same, checked against the limits
+ *   ./sim -t trace.csv         replays a recorded trace
+ *   ./sim -r out.csv scenario  also writes every ping as a trace
+ *   ./sim -s <seed> -v         other noise seed, echo the core's Serial
+ *
+ * SCENES:
+ *   A 4m x 3m room seen from the middle of one wall, with a chair inside
+ *   detection range that the background model has to learn. The horn
+ *   sees the closest thing within SIM_BEAM_DEG of where the servo
+ *   really is when the trigger falls. Scenarios add Gaussian range
+ *   noise, missed echoes, short ghost echoes and targets that stand or
+ *   walk for SIM_TARGET_MS, one at a time, after a warm-up.
+ *
+ *   The replay scenario captures its run with trace.h, then replays the
+ *   file through the pipeline from a fresh background model (as
+ *   /trace_replay does) and scores only the replay, which must not
+ *   ping the sensor at all.
+ *
+ *   The mesh scenario makes the simulated turret the mesh coordinator
+ *   (mesh.h) and adds a second turret over ESP-NOW that reports every
+ *   target SIM_REMOTE_LAG_MS after it appears. It scores how soon the
+ *   arrow points at a target (cued before the local sweep finds it),
+ *   how many targets fuse into one with both turrets in it, and fused
+ *   pictures where both turrets' reports of a target stayed apart.
+ *
+ *   The power scenario runs low-power mode (power.h) with the radio
+ *   parked after SIM_RADIO_IDLE_MS, a button press at two thirds of the
+ *   run to bring it back, and scores the time spent in light sleep on
+ *   top of the usual detection limits.
+ *
+ * TRACES:
+ *   One ping per line, "t_ms,angle,dist" (dist -1 = no echo). Lines
+ *   starting with # are comments, except
+ *     # target <on_ms> <off_ms> <angle> <dist>
+ *   which is the ground truth to score against. A trace ping becomes the
+ *   range the horn sees at that degree from that time on, so the core's
+ *   own sweep timing still decides what it reads. -r writes this format.
+ *
+ * ============================================================================
+ */
+
+#include <Arduino.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <chrono>
+#include <random>
+#include <vector>
+#include "profile.h"
+#include "radar.h"
+
+#define SIM_PASS_US       20        // Simulated cost of one loop pass
+#define SIM_BEAM_DEG      7         // Half the sonar cone
+#define SIM_WARMUP_MS     15000     // Background learning before targets
+#define SIM_TARGET_MS     4000      // How long a target stays
+#define SIM_TARGET_GAP_MS 8000      // Quiet time after it (lock ends)
+#define SIM_TARGETS_MAX   64
+#define SIM_MATCH_DEG     (SIM_BEAM_DEG + 4)
+#define SIM_MATCH_CM      12
+#define SIM_STEP_MS       20        // Sweep step (SENTRY)
+#define SIM_REMOTE_LAG_MS 200       // Mesh: the other turret's detection delay
+#define SIM_REMOTE_CM     5         // ... and its position noise, 1 sigma
+#define SIM_ARROW_DEG     8         // Arrow on target
+#define SIM_FUSED_CM      40        // Fused target on a real one
+#define SIM_RADIO_IDLE_MS 60000     // Power: AP parked after this long
+#define SIM_PRESS_MS      200       // ... and a button press this long
+
+struct SimTarget {
+  uint32_t onMs, offMs;
+  float angle, dist;
+  float dps;                // Walking speed, bounces between 20 and 160
+};
+
+struct Scenario {
+  const char *name;
+  const char *about;
+  uint32_t seconds;         // Simulated run time
+  float noiseCm;            // Range noise, 1 sigma
+  float dropout;            // Chance a ping gets no echo
+  float ghost;              // Chance of a short spurious echo
+  uint8_t targets;
+  float dps;                // Target speed, 0 = standing
+
+  // Regression limits (-c)
+  float minFound;           // Share of targets tracked
+  uint32_t maxP95Ms;        // Detection latency
+  float maxFalsePerHour;    // False locks
+
+  bool replay;              // Capture the run (trace.h), replay it, score the replay
+  bool mesh;                // Coordinator with a second turret (mesh.h)
+  uint32_t maxArrowP95Ms;   // Mesh: target appearing to the arrow on it
+  bool power;               // Low-power mode (power.h)
+  float minAsleep;          // Power: share of the run in light sleep
+};
+
+const Scenario SCENARIOS[] = {
+  // name        about                                  s    noise dropout ghost  tgts dps  found  p95   false/h
+  { "quiet",     "empty room, clean sensor",            600, 0.5f, 0.01f, 0.0f,    0,  0, 0,     0,    0 },
+  { "noisy",     "empty room, noisy sensor and ghosts", 600, 2.0f, 0.10f, 0.005f,  0,  0, 0,     0,    45 },
+  { "intruder",  "people standing still",               300, 0.5f, 0.01f, 0.0f,   24,  0, 0.95f, 1500, 12 },
+  { "walker",    "people walking across",               300, 0.5f, 0.01f, 0.0f,   24, 30, 0.95f, 2000, 12 },
+  { "cluttered", "walkers with a noisy sensor",         300, 2.0f, 0.10f, 0.005f, 24, 30, 0.90f, 3000, 30 },
+  { "replay",    "intruders captured, then replayed",   120, 0.5f, 0.01f, 0.0f,    8,  0, 0.95f, 2000, 12, true },
+  { "mesh",      "intruders a second turret sees too",  300, 0.5f, 0.01f, 0.0f,   24,  0, 0.95f, 1500, 12, false, true, 1200 },
+  { "power",     "intruders in low-power mode",         600, 0.5f, 0.01f, 0.0f,   24,  0, 0.95f, 3000, 12, false, false, 0, true, 0.2f },
+};
+const int SCENARIO_COUNT = sizeof(SCENARIOS) / sizeof(SCENARIOS[0]);
+
+struct SimResult {
+  double hostSec;
+  uint64_t passes;
+  uint32_t simMs;
+  uint32_t pings, sweeps, shows;
+  uint32_t unsettled;                  // Pings on a fine step still moving
+  uint32_t targets, found, duplicates;
+  uint32_t locks, falseLocks, alerts;
+  uint32_t newTracks, logged, logDropped;
+  uint32_t traced, traceDropped;       // Replay scenarios: the capture
+  uint32_t meshSent, pictures;         // Mesh: packets out, fused pictures
+  uint32_t merged, split;              // Targets fused from both, pictures with one unfused
+  uint32_t arrowed;
+  uint32_t arrowLatency[SIM_TARGETS_MAX];
+  uint64_t sleptUs;                    // Power: light sleep
+  uint32_t sleeps, radioParks, cpuMhz;
+  uint32_t latency[SIM_TARGETS_MAX];   // ms, found targets only
+  uint32_t missed;
+  SimTarget miss[SIM_TARGETS_MAX];
+};
+
+// Scene (child process only)
+static const Scenario *scene = nullptr;
+static SimTarget targets[SIM_TARGETS_MAX];
+static uint8_t targetCount = 0;
+static bool targetFound[SIM_TARGETS_MAX];
+static bool targetArrowed[SIM_TARGETS_MAX];
+static bool targetMerged[SIM_TARGETS_MAX];
+static int wallBeam[ANGLE_CELLS];           // Closest static echo per horn angle
+static std::mt19937 rng;
+static FILE *recordFile = nullptr;
+static SimResult res;
+
+// CSV trace replay (-t)
+struct CsvPing {
+  uint32_t ms;
+  int angle, dist;
+};
+static std::vector<CsvPing> csv;
+static size_t csvNext = 0;
+static int csvRange[ANGLE_CELLS];
+static const char *csvPath = nullptr;
+
+Servo servoScan, servoArrow;
+Adafruit_NeoPixel strip(Board::numLeds, Board::pinNeopixel, NEO_GRB + NEO_KHZ800);
+int8_t jobLeds, jobControl;
+
+const struct {
+  int maxDist = 50;
+  int lockTime = 2000;
+  int minAngle = 15;
+  int maxAngle = 165;
+  int samples = 3;
+} benchConfig;
+
+// ============================================================================
+// SCENE
+// ============================================================================
+
+static float uniform(float lo, float hi) {
+  return lo + (hi - lo) * (rng() / 4294967296.0f);
+}
+
+static float gaussian() {
+  float u = max(uniform(0, 1), 1e-7f);
+  return sqrtf(-2.0f * logf(u)) * cosf(6.2831853f * uniform(0, 1));
+}
+
+// Room walls: back wall 300cm ahead, side walls 200cm left and right,
+// plus a chair 42cm out around 122 degrees
+static void sceneBuild() {
+  int wall[ANGLE_CELLS];
+  for (int a = 0; a < ANGLE_CELLS; a++) {
+    float r = a * 3.14159265f / 180.0f;
+    float back = sinf(r) > 0.01f ? 300.0f / sinf(r) : 1e9f;
+    float side = fabsf(cosf(r)) > 0.01f ? 200.0f / fabsf(cosf(r)) : 1e9f;
+    wall[a] = (int)min(back, side);
+    if (a >= 118 && a <= 126) wall[a] = 42;
+  }
+  for (int a = 0; a < ANGLE_CELLS; a++) {
+    wallBeam[a] = 100000;
+    for (int k = max(0, a - SIM_BEAM_DEG); k <= min(ANGLE_CELLS - 1, a + SIM_BEAM_DEG); k++) {
+      wallBeam[a] = min(wallBeam[a], wall[k]);
+    }
+  }
+}
+
+static float targetAngle(const SimTarget &t, uint32_t ms) {
+  float a = t.angle + t.dps * (ms - t.onMs) / 1000.0f;
+  // Bounce between 20 and 160
+  float span = 140.0f;
+  float x = fmodf(a - 20.0f, 2 * span);
+  if (x < 0) x += 2 * span;
+  return 20.0f + (x <= span ? x : 2 * span - x);
+}
+
+static bool targetActive(const SimTarget &t, uint32_t ms) {
+  return ms >= t.onMs && ms < t.offMs;
+}
+
+static void sceneTargets() {
+  targetCount = min(scene->targets, (uint8_t)SIM_TARGETS_MAX);
+  for (uint8_t i = 0; i < targetCount; i++) {
+    SimTarget &t = targets[i];
+    t.onMs = SIM_WARMUP_MS + i * (SIM_TARGET_MS + SIM_TARGET_GAP_MS) + (uint32_t)uniform(0, 1000);
+    t.offMs = t.onMs + SIM_TARGET_MS;
+    // Somewhere the background model can tell it from the room
+    do {
+      t.angle = uniform(25, 155);
+      t.dist = uniform(12, benchConfig.maxDist - 8);
+    } while (t.dist > wallBeam[(int)t.angle] - BG_MIN_MARGIN_CM - 4);
+    t.dps = scene->dps * (uniform(0, 1) < 0.5f ? -1 : 1);
+  }
+}
+
+// What the horn hears for a ping fired now (mock sonar hook)
+static int sceneEcho() {
+  uint32_t ms = millis();
+  float horn = servoScan.simAngle();
+  int a = constrain((int)(horn + 0.5f), 0, ANGLE_CELLS - 1);
+  int cm;
+
+  int step = servoScan.simStep();
+  if (step > 0 && step <= MOTION_PING_AHEAD_DEG &&
+      simNowUs - servoScan.simWriteUs() < (uint64_t)step * SERVO_US_PER_DEG + SERVO_SETTLE_US) {
+    res.unsettled++;
+  }
+
+  if (csvPath) {
+    while (csvNext < csv.size() && csv[csvNext].ms <= ms) {
+      const CsvPing &p = csv[csvNext++];
+      if (p.angle >= 0 && p.angle < ANGLE_CELLS) csvRange[p.angle] = p.dist;
+    }
+    cm = -1;
+    for (int k = 0; k <= 3 && cm < 0; k++) {
+      if (a - k >= 0 && csvRange[a - k] > 0) cm = csvRange[a - k];
+      else if (a + k < ANGLE_CELLS && csvRange[a + k] > 0) cm = csvRange[a + k];
+    }
+  } else {
+    float r = wallBeam[a];
+    for (uint8_t i = 0; i < targetCount; i++) {
+      if (!targetActive(targets[i], ms)) continue;
+      if (fabsf(targetAngle(targets[i], ms) - horn) <= SIM_BEAM_DEG) r = min(r, targets[i].dist);
+    }
+    r += gaussian() * scene->noiseCm;
+    cm = r > 400 || uniform(0, 1) < scene->dropout ? -1 : max(2, (int)(r + 0.5f));
+    if (uniform(0, 1) < scene->ghost) cm = (int)uniform(5, 60);
+  }
+
+  if (recordFile) fprintf(recordFile, "%u,%d,%d\n", ms, a, cm);
+  return cm;
+}
+
+// Index of the live target a reading belongs to, or -1
+static int sceneMatch(float angle, float dist, uint32_t ms) {
+  for (uint8_t i = 0; i < targetCount; i++) {
+    const SimTarget &t = targets[i];
+    if (ms < t.onMs || ms > t.offMs + 500) continue;
+    if (fabsf(targetAngle(t, min(ms, t.offMs)) - angle) > SIM_MATCH_DEG) continue;
+    if (fabsf(t.dist - dist) > SIM_MATCH_CM) continue;
+    return i;
+  }
+  return -1;
+}
+
+// ============================================================================
+// TRACES
+// ============================================================================
+
+static bool csvLoad(const char *path) {
+  FILE *f = fopen(path, "r");
+  if (!f) {
+    fprintf(stderr, "sim: cannot open %s\n", path);
+    return false;
+  }
+  char line[128];
+  while (fgets(line, sizeof(line), f)) {
+    unsigned on, off;
+    float a, d;
+    if (line[0] == '#') {
+      if (sscanf(line, "# target %u %u %f %f", &on, &off, &a, &d) == 4 && targetCount < SIM_TARGETS_MAX) {
+        targets[targetCount++] = { on, off, a, d, 0 };
+      }
+      continue;
+    }
+    CsvPing p;
+    if (sscanf(line, "%u,%d,%d", &p.ms, &p.angle, &p.dist) == 3) csv.push_back(p);
+  }
+  fclose(f);
+  for (int a = 0; a < ANGLE_CELLS; a++) csvRange[a] = -1;
+  return !csv.empty();
+}
+
+// ============================================================================
+// BENCH MODE
+// ============================================================================
+
+// Like SENTRY in new.ino: dim idle glow, distance colour and tone
+static void benchIdle() {
+  ledsFill(Adafruit_NeoPixel::Color(0, 0, 8));
+}
+
+static void benchAlert(int dist) {
+  res.alerts++;
+  ledsFill(dist < 20 ? Adafruit_NeoPixel::Color(255, 0, 0) : Adafruit_NeoPixel::Color(255, 128, 0));
+  audioTone(2000 - dist * 20);
+}
+
+const RadarMode BENCH_MODE = { "BENCH", LOG_NO_MODE, benchIdle, benchAlert };
+
+static void benchLock(bool locked) {
+  if (!locked) return;
+  res.locks++;
+  if (sceneMatch(pingAngle, lastDist, millis()) < 0) res.falseLocks++;
+}
+
+static void benchLeds() {
+  ledsFlush(!echoBusy);
+}
+
+// Like controlTick() in the sketches: the snapshot (and mesh tracks)
+static void benchControl() {
+  radarPublish(0, 0);
+}
+
+static void benchFs() {
+  SPIFFS.begin(true);
+  logBegin();
+  traceBegin();
+}
+
+// Only the mesh and the replay driver post commands on the host
+void runCommand(uint8_t cmd, int arg) {
+  if (cmd == CMD_CUE) arrowCue(arg);
+  if (cmd == CMD_TRACE_REPLAY) radarReplayStart();
+}
+
+// Scores every track the core started since the last pass
+static void benchScore() {
+  static unsigned long born[TRACK_MAX];
+  for (int i = 0; i < TRACK_MAX; i++) {
+    const Track &t = tracks[i];
+    if (!t.used || t.born == born[i]) continue;
+    born[i] = t.born;
+    res.newTracks++;
+
+    int m = sceneMatch(t.angle, t.dist, t.born);
+    if (m < 0) continue;
+    if (targetFound[m]) {
+      res.duplicates++;
+      continue;
+    }
+    targetFound[m] = true;
+    res.latency[res.found++] = t.born - targets[m].onMs;
+  }
+}
+
+// ============================================================================
+// MESH
+// ============================================================================
+
+static void benchMesh() {
+  meshBegin();
+  if (!scene->mesh) return;
+  MeshConfig c = { 1, true, 0, 0, 90 };   // Room frame = this turret's
+  meshConfigure(c);
+}
+
+static void remoteSent(const uint8_t *, size_t) {
+  res.meshSent++;
+}
+
+// The second turret: every target it has seen, in the room frame
+static void remoteReport() {
+  static unsigned long tSent = 0;
+  static uint16_t seq = 0;
+  uint32_t ms = millis();
+
+  uint8_t buf[MESH_PACKET_MAX];
+  MeshHeader h = { MESH_MAGIC, MESH_TRACKS, 2, 0, 0 };
+  MeshPoint *p = (MeshPoint *)(buf + sizeof(h));
+  for (uint8_t i = 0; i < targetCount && h.n < MESH_FUSED_MAX; i++) {
+    const SimTarget &t = targets[i];
+    if (!targetActive(t, ms) || ms < t.onMs + SIM_REMOTE_LAG_MS) continue;
+    float r = targetAngle(t, ms) * (float)DEG_TO_RAD;
+    p[h.n].x = (int16_t)lroundf(t.dist * cosf(r) + gaussian() * SIM_REMOTE_CM);
+    p[h.n].y = (int16_t)lroundf(t.dist * sinf(r) + gaussian() * SIM_REMOTE_CM);
+    p[h.n].nodes = p[h.n].pad = 0;
+    h.n++;
+  }
+  if (ms - tSent < (h.n > 0 ? MESH_SEND_MS : MESH_BEAT_MS)) return;
+  tSent = ms;
+  h.seq = seq++;
+  memcpy(buf, &h, sizeof(h));
+  static const uint8_t mac[6] = { 0x24, 0x0A, 0xC4, 0, 0, 2 };
+  simEspNowDeliver(mac, buf, sizeof(h) + h.n * sizeof(MeshPoint));
+}
+
+// Arrow on each target, and every new fused picture against the scene
+static void meshScore() {
+  uint32_t ms = millis();
+  for (uint8_t i = 0; i < targetCount; i++) {
+    const SimTarget &t = targets[i];
+    if (targetArrowed[i] || !targetActive(t, ms)) continue;
+    if (fabsf(servoArrow.simAngle() - targetAngle(t, ms)) > SIM_ARROW_DEG) continue;
+    targetArrowed[i] = true;
+    res.arrowLatency[res.arrowed++] = ms - t.onMs;
+  }
+
+  static uint32_t seen = 0;
+  if (meshFusedSeq == seen) return;
+  seen = meshFusedSeq;
+  res.pictures++;
+  bool split = false;
+  for (uint8_t i = 0; i < targetCount; i++) {
+    const SimTarget &t = targets[i];
+    if (!targetActive(t, ms)) continue;
+    float r = targetAngle(t, ms) * (float)DEG_TO_RAD;
+    int on = 0;
+    bool both = false;
+    for (uint8_t f = 0; f < meshFusedCount; f++) {
+      if (hypotf(meshFused[f].x - t.dist * cosf(r), meshFused[f].y - t.dist * sinf(r)) > SIM_FUSED_CM) continue;
+      on++;
+      both |= meshFused[f].nodes == 0x03;
+    }
+    if (both && !targetMerged[i]) {
+      targetMerged[i] = true;
+      res.merged++;
+    }
+    split |= on > 1 && !both;
+  }
+  if (split) res.split++;
+}
+
+// ============================================================================
+// POWER
+// ============================================================================
+
+static void benchWifi() {
+  WiFi.softAP("RADAR_TURRET", "12345678");
+}
+
+static void benchButton(void *arg) {
+  simButtonLow = arg != nullptr;
+}
+
+// ============================================================================
+// RUN
+// ============================================================================
+
+// loop() passes until endUs, or with replay until the replay is done
+static void simLoop(uint64_t endUs, bool replay) {
+  uint64_t startUs = simNowUs;
+  auto t0 = std::chrono::steady_clock::now();
+  while (replay ? traceReplaying : simNowUs < endUs) {
+    webStep();
+    uint32_t idle = radarStep();
+    benchScore();
+    if (scene->mesh) {
+      remoteReport();
+      meshScore();
+    }
+    res.passes++;
+    simAdvance(SIM_PASS_US);
+    if (idle > 0) radarIdle(idle);
+  }
+  res.hostSec += std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+  res.simMs += (simNowUs - startUs) / 1000;
+}
+
+// Replays the capture through the same pipeline, like /trace_replay,
+// and scores that pass alone against the same targets, moved in time
+static void simReplay() {
+  traceStop();
+  logFlush();
+  uint32_t logged = simFsBytes("/rec.") / sizeof(LogRecord);
+  uint32_t pings = simPings;
+  uint32_t sweeps = sweepId;
+
+  uint32_t shift = millis();      // The capture started at 0
+  for (uint8_t i = 0; i < targetCount; i++) {
+    targets[i].onMs += shift;
+    targets[i].offMs += shift;
+    targetFound[i] = false;
+  }
+
+  SimResult live = res;
+  memset(&res, 0, sizeof(res));
+  res.traced = traceCount();
+  res.traceDropped = traceDropped;
+
+  if (traceReplayBegin()) {
+    postCommand(CMD_TRACE_REPLAY);
+    simLoop(0, true);
+  }
+
+  logFlush();
+  res.pings = simPings - pings;
+  res.sweeps = sweepId - sweeps;
+  res.logged = simFsBytes("/rec.") / sizeof(LogRecord) - logged;
+  res.logDropped = logDropped - live.logDropped;
+}
+
+// Power-on to the end of the scenario, as setup() and loop() do it
+static void simRun(uint32_t seconds) {
+  Serial.begin(115200);
+  bootMark("serial");
+
+  echoBegin(Board::pinTrig, Board::pinEcho);
+  simSonar(Board::pinTrig, Board::pinEcho);
+  simEcho = sceneEcho;
+  if (Board::hasBuzzer) audioBegin(Board::pinBuzzer);
+
+  servoScan.attach(Board::pinServoScan, 500, 2400);
+  servoArrow.attach(Board::pinServoArrow, 500, 2400);
+  strip.begin();
+  ledsBegin(strip, Board::numLeds);
+  ledsBrightness(50);
+
+  radarBegin(servoScan, servoArrow, &BENCH_MODE, benchLock);
+  radarConfigure(benchConfig, SIM_STEP_MS);
+  if (scene->power) {
+    powerBegin(true, Board::pinButton, benchWifi);
+    powerRadioIdleMs = SIM_RADIO_IDLE_MS;
+    uint64_t pressUs = (uint64_t)seconds * 1000000ULL * 2 / 3;
+    simSchedule(pressUs, benchButton, (void *)1);
+    simSchedule(pressUs + SIM_PRESS_MS * 1000ULL, benchButton, nullptr);
+  }
+  radarCenter();
+  bootMark("hw");
+  bootDefer("fs", benchFs);
+  bootDefer("wifi", benchWifi);
+  bootDefer("mesh", benchMesh);
+  simEspNowSent = remoteSent;
+
+  jobLeds = schedAdd(benchLeds, LED_FRAME_MS);
+  jobControl = schedAdd(benchControl, 10);
+  powerRelax(jobLeds, LED_FRAME_MS);
+  powerRelax(jobControl, 10);
+  schedStart(jobLeds);
+  schedStart(jobControl);
+  bootRadarUp();
+  radarRun(true);
+
+  if (scene->replay) {
+    // Capture from the first reading
+    while (!bootPump()) {}
+    traceStart();
+  }
+
+  simLoop((uint64_t)seconds * 1000000ULL, false);
+  res.pings = simPings;
+  res.sweeps = sweepId;
+  if (scene->replay) simReplay();
+
+  logFlush();
+  res.shows = simShows;
+  res.sleptUs = powerSleptUs;
+  res.sleeps = powerSleeps;
+  res.radioParks = powerRadioParks;
+  res.cpuMhz = simCpuMhz;
+  res.targets = targetCount;
+  if (!scene->replay) {
+    res.logged = simFsBytes("/rec.") / sizeof(LogRecord);
+    res.logDropped = logDropped;
+  }
+  for (uint8_t i = 0; i < targetCount; i++) {
+    if (!targetFound[i]) res.miss[res.missed++] = targets[i];
+  }
+}
+
+// Runs one scenario (or the trace) in a child so each starts from reset
+static bool simFork(const Scenario *s, uint32_t seed, const char *recordPath, SimResult &out) {
+  int fd[2];
+  if (pipe(fd) != 0) return false;
+  fflush(stdout);
+
+  pid_t pid = fork();
+  if (pid == 0) {
+    close(fd[0]);
+    scene = s;
+    rng.seed(seed);
+    randomSeed(seed);
+    memset(&res, 0, sizeof(res));
+    sceneBuild();
+    uint32_t seconds = s->seconds;
+    if (csvPath) {
+      if (!csvLoad(csvPath)) _exit(1);
+      seconds = csv.back().ms / 1000 + 2;
+    } else {
+      sceneTargets();
+    }
+    if (recordPath) {
+      recordFile = fopen(recordPath, "w");
+      for (uint8_t i = 0; recordFile && i < targetCount; i++) {
+        fprintf(recordFile, "# target %u %u %.0f %.0f\n", targets[i].onMs, targets[i].offMs,
+                targets[i].angle, targets[i].dist);
+      }
+    }
+    simRun(seconds);
+    if (recordFile) fclose(recordFile);
+    fflush(stdout);
+    ssize_t n = write(fd[1], &res, sizeof(res));
+    _exit(n == (ssize_t)sizeof(res) ? 0 : 1);
+  }
+
+  close(fd[1]);
+  size_t got = 0;
+  while (got < sizeof(out)) {
+    ssize_t n = read(fd[0], (uint8_t *)&out + got, sizeof(out) - got);
+    if (n <= 0) break;
+    got += n;
+  }
+  close(fd[0]);
+  int status = 0;
+  waitpid(pid, &status, 0);
+  return got == sizeof(out) && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+static uint32_t percentile(const uint32_t *lat, uint32_t n, float q) {
+  if (n == 0) return 0;
+  std::vector<uint32_t> v(lat, lat + n);
+  std::sort(v.begin(), v.end());
+  return v[min((size_t)(q * v.size()), v.size() - 1)];
+}
+
+static void reportHeader() {
+  printf("%-10s %10s %6s %6s %6s %6s %6s %6s %6s %6s %5s %7s %6s\n",
+         "scenario", "passes/s", "sim/s", "sweeps", "found", "p50ms", "p95ms",
+         "maxms", "tracks", "locks", "false", "false/h", "logged");
+}
+
+// Prints one row; with check, also the limits it misses. Returns pass.
+static bool report(const char *name, const Scenario *s, const SimResult &r, bool check) {
+  float hours = r.simMs / 3600000.0f;
+  float falsePerHour = r.falseLocks / hours;
+  char found[16];
+  snprintf(found, sizeof(found), "%u/%u", r.found, r.targets);
+
+  printf("%-10s %10.0f %6.0f %6u %6s %6u %6u %6u %6u %6u %5u %7.1f %6u\n",
+         name, r.passes / r.hostSec, r.passes * 1000.0 / r.simMs, r.sweeps, found,
+         percentile(r.latency, r.found, 0.5f), percentile(r.latency, r.found, 0.95f),
+         percentile(r.latency, r.found, 1.0f),
+         r.newTracks, r.locks, r.falseLocks, falsePerHour, r.logged);
+  for (uint32_t i = 0; i < r.missed; i++) {
+    printf("  missed target at %u ms: %.0f deg, %.0f cm%s\n", r.miss[i].onMs, r.miss[i].angle,
+           r.miss[i].dist, r.miss[i].dps != 0 ? ", walking" : "");
+  }
+
+  if (s->mesh) {
+    printf("  mesh: arrow on %u/%u, p50 %u ms, p95 %u ms; merged %u/%u; %u of %u pictures split; %u sent\n",
+           r.arrowed, r.targets, percentile(r.arrowLatency, r.arrowed, 0.5f),
+           percentile(r.arrowLatency, r.arrowed, 0.95f), r.merged, r.targets, r.split,
+           r.pictures, r.meshSent);
+  }
+
+  if (s->power) {
+    printf("  power: asleep %.0f%% in %u sleeps, radio parked %ux, CPU %u MHz, %.1f pings/s\n",
+           r.sleptUs / 10.0 / r.simMs, r.sleeps, r.radioParks, r.cpuMhz, r.pings * 1000.0 / r.simMs);
+  }
+
+  if (!check) return true;
+  bool ok = true;
+  if (r.targets > 0 && r.found < s->minFound * r.targets) {
+    printf("  FAIL %s: found %u of %u targets, want %.0f%%\n", name, r.found, r.targets, s->minFound * 100);
+    ok = false;
+  }
+  if (r.found > 0 && percentile(r.latency, r.found, 0.95f) > s->maxP95Ms) {
+    printf("  FAIL %s: p95 latency %u ms, limit %u\n", name, percentile(r.latency, r.found, 0.95f), s->maxP95Ms);
+    ok = false;
+  }
+  if (falsePerHour > s->maxFalsePerHour) {
+    printf("  FAIL %s: %.1f false locks/h, limit %.0f\n", name, falsePerHour, s->maxFalsePerHour);
+    ok = false;
+  }
+  if (r.logged + r.logDropped != r.newTracks) {
+    printf("  FAIL %s: %u tracks but %u logged, %u dropped\n", name, r.newTracks, r.logged, r.logDropped);
+    ok = false;
+  }
+  if (s->replay && (r.traced == 0 || r.traceDropped > 0)) {
+    printf("  FAIL %s: captured %u samples, dropped %u\n", name, r.traced, r.traceDropped);
+    ok = false;
+  }
+  if (s->mesh && (r.arrowed < s->minFound * r.targets ||
+                  percentile(r.arrowLatency, r.arrowed, 0.95f) > s->maxArrowP95Ms)) {
+    printf("  FAIL %s: arrow on %u of %u targets, p95 %u ms, limit %u\n", name, r.arrowed, r.targets,
+           percentile(r.arrowLatency, r.arrowed, 0.95f), s->maxArrowP95Ms);
+    ok = false;
+  }
+  if (s->mesh && r.merged < s->minFound * r.targets) {
+    printf("  FAIL %s: merged %u of %u targets\n", name, r.merged, r.targets);
+    ok = false;
+  }
+  if (s->mesh && r.split * 50 > r.pictures) {
+    printf("  FAIL %s: %u of %u pictures split a target\n", name, r.split, r.pictures);
+    ok = false;
+  }
+  if (s->power && r.sleptUs / 1000.0 < s->minAsleep * r.simMs) {
+    printf("  FAIL %s: asleep %.0f%% of the run, want %.0f%%\n", name, r.sleptUs / 10.0 / r.simMs,
+           s->minAsleep * 100);
+    ok = false;
+  }
+  if (s->power && r.radioParks < 2) {
+    printf("  FAIL %s: radio parked %u times, want 2 (the button brings it back)\n", name, r.radioParks);
+    ok = false;
+  }
+  if (r.unsettled > 0) {
+    printf("  FAIL %s: %u pings on a fine step before it settled\n", name, r.unsettled);
+    ok = false;
+  }
+  if (s->replay && r.pings > 0) {
+    printf("  FAIL %s: replay fired %u live pings\n", name, r.pings);
+    ok = false;
+  }
+  return ok;
+}
+
+static void usage() {
+  fprintf(stderr, "usage: sim [-c] [-v] [-s seed] [-r out.csv] [-t trace.csv] [scenario...]\n");
+  for (int i = 0; i < SCENARIO_COUNT; i++) {
+    fprintf(stderr, "  %-10s %s\n", SCENARIOS[i].name, SCENARIOS[i].about);
+  }
+}
+
+int main(int argc, char **argv) {
+  bool check = false;
+  uint32_t seed = 1;
+  const char *recordPath = nullptr;
+  std::vector<const Scenario *> run;
+
+  for (int i = 1; i < argc; i++) {
+    const char *a = argv[i];
+    if (!strcmp(a, "-c")) check = true;
+    else if (!strcmp(a, "-v")) simSerialEcho = true;
+    else if (!strcmp(a, "-s") && i + 1 < argc) seed = strtoul(argv[++i], nullptr, 0);
+    else if (!strcmp(a, "-r") && i + 1 < argc) recordPath = argv[++i];
+    else if (!strcmp(a, "-t") && i + 1 < argc) csvPath = argv[++i];
+    else {
+      const Scenario *s = nullptr;
+      for (int k = 0; k < SCENARIO_COUNT; k++) {
+        if (!strcmp(a, SCENARIOS[k].name)) s = &SCENARIOS[k];
+      }
+      if (!s) {
+        usage();
+        return 2;
+      }
+      run.push_back(s);
+    }
+  }
+
+  if (csvPath) {
+    // Noise-free scene; the trace carries its own, no limits to check
+    static const Scenario replay = { "trace", "recorded trace", 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+    SimResult r;
+    if (!simFork(&replay, seed, recordPath, r)) return 1;
+    reportHeader();
+    report("trace", &replay, r, false);
+    return 0;
+  }
+
+  if (run.empty()) {
+    for (int i = 0; i < SCENARIO_COUNT; i++) run.push_back(&SCENARIOS[i]);
+  }
+  if (recordPath && run.size() != 1) {
+    fprintf(stderr, "sim: -r records one scenario\n");
+    return 2;
+  }
+
+  bool ok = true;
+  reportHeader();
+  for (const Scenario *s : run) {
+    SimResult r;
+    if (!simFork(s, seed, recordPath, r)) {
+      printf("  FAIL %s: simulation did not finish\n", s->name);
+      ok = false;
+      continue;
+    }
+    ok &= report(s->name, s, r, check);
+  }
+  if (check) printf(ok ? "PASS\n" : "FAIL\n");
+  return ok ? 0 : 1;
+}